@@ -0,0 +1,186 @@
+// Accepting against the ready-check timer. The stand-in reports a ready check
+// that has been open for T seconds; the deadline is read from that timer and
+// the AcceptScheduler runs the LCU accept and a simulated UI click (a fixed
+// sleep) fastest first, starting a path only when it can finish in time.
+//
+// Every ready check must be accepted while the time left when a path could
+// start exceeds its estimate plus its safety margin: with a working LCU
+// accept down to the last few milliseconds, with the accept answering 500
+// by the UI click while it fits. Once the remaining time is shorter than
+// the click, it is skipped and counted as a miss. Exits 1 if a path
+// finishes past the deadline, an accept reaches the stand-in after it, or
+// accepts and misses differ from what the time left allows.
+//
+//   bench_accept_deadline [--rounds N] [--ui-ms MS]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/accept_scheduler.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Slack for the scheduler's own clock read after the bench's
+constexpr std::chrono::milliseconds CLOCK_TOLERANCE{1};
+
+// Seconds the ready check has been open when it is read
+constexpr double TIMERS[] = {0.0, 4.0, 8.0, 10.0, 11.0, 11.5, 11.8, 11.9, 11.95, 12.0};
+
+struct Case {
+    int checks = 0;
+    int accepted = 0;
+    int misses = 0;
+    int ui_started = 0;
+    int late_paths = 0;     // Finished after the deadline
+    int late_accepts = 0;   // Accept POST reached the stand-in after the deadline
+    int wrong = 0;          // Accepted or missed against what the time left allows
+};
+
+std::string ReadyCheckBody(double timer) {
+    return R"({"declinerIds":[],"playerResponse":"None","state":"InProgress","timer":)" + std::to_string(timer) + "}";
+}
+
+// `lcu_accepts`: the accept POST succeeds; otherwise only the UI path can
+Case RunCase(tools::LCUMockServer& server, core::LCUSession& session, bool lcu_accepts,
+             std::chrono::milliseconds ui_duration, int rounds) {
+    const char* accept_path = core::GetLCUEndpoint(core::LCUEndpointId::ACCEPT_MATCHMAKING).path;
+    std::atomic<int64_t> last_post_ns{0};
+    server.ClearResponses();
+    for (const char* endpoint : core::READY_CHECK_ACCEPT_ENDPOINTS) {
+        server.SetResponse("POST", endpoint, {lcu_accepts ? 204 : 500, ""});
+    }
+    server.SetRequestObserver([&last_post_ns, accept_path](const std::string& method, const std::string& path) {
+        if (method == "POST" && path == accept_path) {
+            last_post_ns = Clock::now().time_since_epoch().count();
+        }
+    });
+
+    Case result;
+    core::ReadyCheckAcceptor acceptor(session);
+    core::AcceptScheduler scheduler;
+    Clock::time_point path_end;
+    Clock::time_point lcu_end;
+    bool lcu_ran = false;
+    bool ui_ran = false;
+
+    size_t lcu_path = scheduler.AddPath("LCU API", std::chrono::milliseconds(5), [&](Clock::time_point deadline) {
+        lcu_ran = true;
+        bool accepted = acceptor.Accept(Clock::now(), deadline).accepted;
+        path_end = Clock::now();
+        lcu_end = path_end;
+        result.late_paths += path_end > deadline ? 1 : 0;
+        return accepted;
+    });
+    size_t ui_path = scheduler.AddPath("UI automation", ui_duration, [&](Clock::time_point deadline) {
+        ui_ran = true;
+        result.ui_started++;
+        std::this_thread::sleep_for(ui_duration);
+        path_end = Clock::now();
+        result.late_paths += path_end > deadline ? 1 : 0;
+        return true;
+    });
+
+    for (int round = 0; round < rounds; ++round) {
+        for (double timer : TIMERS) {
+            server.SetResponse("GET", core::READY_CHECK_URI, {200, ReadyCheckBody(timer)});
+            last_post_ns = 0;
+            lcu_ran = false;
+            ui_ran = false;
+
+            // Read before the request: the timer is at least as old as that
+            Clock::time_point read_at = Clock::now();
+            core::HttpResponse response = session.Get(core::READY_CHECK_URI);
+            core::ReadyCheckView view;
+            if (!response.IsSuccess() || !core::ParseReadyCheck(response.body, view)) {
+                result.wrong++;
+                continue;
+            }
+            Clock::time_point deadline = core::GetReadyCheckDeadline(view.timer, read_at);
+
+            // What each path needs left to be started, as the scheduler sees it
+            size_t path = lcu_accepts ? lcu_path : ui_path;
+            auto needed = scheduler.GetEstimate(path) + scheduler.GetSafetyMargin(path) + CLOCK_TOLERANCE;
+            Clock::time_point before = Clock::now();
+            core::ScheduledAccept scheduled = scheduler.Run(deadline);
+            result.checks++;
+            result.accepted += scheduled.accepted ? 1 : 0;
+            result.misses += scheduled.deadline_missed ? 1 : 0;
+
+            if (lcu_accepts && last_post_ns > deadline.time_since_epoch().count()) {
+                result.late_accepts++;
+            }
+
+            // Time for the path that accepts must be an accept, none must be
+            // a miss; the slow UI path must not start within its own duration
+            // of the deadline. The UI path gets what the failed LCU accept left.
+            Clock::time_point start = !lcu_accepts && lcu_ran ? lcu_end : before;
+            double remaining = core::ReadyCheckView::DURATION_SECONDS - timer;
+            double ui_seconds = std::chrono::duration<double>(ui_duration).count();
+            bool must_accept = deadline - start > needed;
+            bool must_miss = remaining <= 0.0 || (!lcu_accepts && remaining < ui_seconds);
+            if ((must_accept && !scheduled.accepted) || (must_miss && !scheduled.deadline_missed) ||
+                (must_miss && ui_ran)) {
+                std::fprintf(stderr, "  timer %.2f: accepted %d, missed %d, UI ran %d\n", timer,
+                             scheduled.accepted, scheduled.deadline_missed, ui_ran);
+                result.wrong++;
+            }
+        }
+    }
+    server.SetRequestObserver(nullptr);
+    return result;
+}
+
+void Print(const char* label, const Case& result) {
+    std::printf("%-30s %3d checks: %3d accepted, %3d missed, UI started %3d, late paths %d, "
+                "late accepts %d, wrong %d\n",
+                label, result.checks, result.accepted, result.misses, result.ui_started,
+                result.late_paths, result.late_accepts, result.wrong);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int rounds = bench::ParseIntArg(argc, argv, "--rounds", 2);
+    std::chrono::milliseconds ui_duration(bench::ParseIntArg(argc, argv, "--ui-ms", 300));
+
+    tools::LCUMockServer server;
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials({server.GetPort(), server.GetAuthToken()});
+
+    Case lcu = RunCase(server, session, true, ui_duration, rounds);
+    Case ui = RunCase(server, session, false, ui_duration, rounds);
+
+    std::printf("ready checks read at timer 0..12s, UI click %lldms, %d rounds:\n",
+                static_cast<long long>(ui_duration.count()), rounds);
+    Print("  LCU accept answers", lcu);
+    Print("  LCU accept fails, UI only", ui);
+
+    server.Stop();
+    const Case* cases[] = {&lcu, &ui};
+    for (const Case* result : cases) {
+        if (result->late_paths > 0 || result->late_accepts > 0 || result->wrong > 0) {
+            std::fprintf(stderr, "accepts ran past the ready-check deadline or misses were miscounted\n");
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,360 @@
+// Accept-path latency against the local LCU stand-in.
+//
+// First the accept call alone: the old GUI sequence (read the ready check,
+// then walk the accept endpoints in order) versus the fast ReadyCheckAcceptor
+// (POST first, cached endpoint, verify afterwards), for a current client
+// build where the primary endpoint answers and an older build where only the
+// lobby endpoint does.
+//
+// Then end to end: the AutoAcceptEngine finds the stand-in through its
+// lockfile and follows a gameflow timeline, with the event stream and in
+// polling fallback. Latency runs from the ready check appearing on the
+// stand-in to the accept POST arriving there; --latency, --jitter and
+// --error-rate inject faults into every HTTP request of that part.
+//
+// Last, a client whose gameflow phase lags: it still reads "None" while two
+// ready checks in a row are up. Both must be found by scanning the other
+// endpoints, and a plain "None" outside the queue must not be scanned.
+//
+//   bench_accept_latency [--iterations N] [--cycles N] [--timeline PATH]
+//                        [--latency MS] [--jitter MS] [--error-rate PERCENT]
+
+#include "bench_common.h"
+#include "lcu_mock_gameflow.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/auto_accept_engine.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include "league_auto_accept/models/performance_metrics.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <random>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"None","state":"InProgress","suppressUx":false,"timer":3.0})";
+constexpr const char* READY_CHECK_ACCEPTED =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"Accepted","state":"InProgress","suppressUx":false,"timer":3.0})";
+
+// Pre-acceptor GUI: GET the ready check, then try each accept endpoint in order
+bool LegacyAccept(core::LCUSession& session) {
+    core::HttpResponse status = session.Get(core::READY_CHECK_URI);
+    if (status.IsSuccess() && status.body.find("\"playerResponse\":\"Accepted\"") != std::string::npos) {
+        return true;
+    }
+
+    for (const char* endpoint : core::READY_CHECK_ACCEPT_ENDPOINTS) {
+        if (session.Post(endpoint).IsSuccess()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+struct ScenarioResult {
+    bench::LatencySamples legacy;
+    bench::LatencySamples fast;
+    std::array<long long, core::ACCEPT_STAGE_COUNT> stage_total_us{};
+    int fast_posts = 0;
+    int failures = 0;
+};
+
+ScenarioResult RunScenario(tools::LCUMockServer& server, const core::LCUCredentials& credentials,
+                           const char* accept_endpoint, int iterations) {
+    server.ClearResponses();
+    server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+    server.SetResponse("POST", accept_endpoint, {204, ""});
+    server.SetRequestObserver([&server, accept_endpoint](const std::string& method, const std::string& path) {
+        if (method == "POST" && path == accept_endpoint) {
+            server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_ACCEPTED});
+        }
+    });
+
+    ScenarioResult result;
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials(credentials);
+    core::ReadyCheckAcceptor acceptor(session);
+
+    // Warm the keep-alive connection so both paths start equal
+    session.Get(core::READY_CHECK_URI);
+
+    for (int i = 0; i < iterations; ++i) {
+        server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+        auto start = std::chrono::steady_clock::now();
+        if (!LegacyAccept(session)) result.failures++;
+        result.legacy.Add(std::chrono::steady_clock::now() - start);
+
+        server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+        start = std::chrono::steady_clock::now();
+        core::AcceptResult accept = acceptor.Accept(start);
+        auto accepted_at = std::chrono::steady_clock::now();
+        if (!accept.accepted || !acceptor.Verify(accept)) result.failures++;
+
+        // Accept latency ends once the POST succeeded; verification is off the critical path
+        result.fast.Add(accepted_at - start);
+        result.fast_posts += accept.attempts;
+        for (size_t stage = 0; stage < core::ACCEPT_STAGE_COUNT; ++stage) {
+            result.stage_total_us[stage] += accept.stage_latency[stage].count();
+        }
+    }
+
+    server.SetRequestObserver(nullptr);
+    return result;
+}
+
+void PrintScenario(const char* title, const ScenarioResult& result, int iterations) {
+    std::printf("%s\n", title);
+    result.legacy.Print("  GET + sequential POSTs");
+    result.fast.Print("  fast accept");
+    if (result.fast.PercentileMicros(50) > 0.0) {
+        std::printf("  p50 speedup: %.1fx, POSTs per fast accept: %.2f, failures: %d\n",
+                    result.legacy.PercentileMicros(50) / result.fast.PercentileMicros(50),
+                    static_cast<double>(result.fast_posts) / iterations, result.failures);
+    }
+    std::printf("  fast stages (mean):");
+    for (size_t stage = 0; stage < core::ACCEPT_STAGE_COUNT; ++stage) {
+        std::printf(" %s=%.1fus", core::AcceptStageToString(static_cast<core::AcceptStage>(stage)),
+                    static_cast<double>(result.stage_total_us[stage]) / iterations);
+    }
+    std::printf("\n\n");
+}
+
+// Event stream that never connects, to keep the engine on its polling fallback
+class OfflineEventStream : public core::LCUEventStream {
+public:
+    bool Connect(const core::LCUCredentials&) override { return false; }
+    void Close() override {}
+    bool IsConnected() const override { return false; }
+    bool Subscribe(const std::string&) override { return false; }
+    bool ReadMessage(std::string&) override { return false; }
+    void Interrupt() override {}
+    std::string GetLastError() const override { return "offline"; }
+};
+
+struct EngineResult {
+    bench::LatencySamples latency;   // Ready check up -> accept POST received
+    core::LatencyHistogram::Snapshot accept_post;   // Engine-side POST latency
+    int ready_checks = 0;
+    int accepted = 0;
+    int requests = 0;
+};
+
+bool WaitFor(const std::function<bool()>& condition, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return true;
+}
+
+bool RunEngine(tools::LCUMockServer& server, const std::string& lockfile_path,
+               const std::vector<tools::PhaseStep>& timeline, int cycles, bool use_event_stream,
+               EngineResult& result) {
+    tools::MockGameflow gameflow(server);
+    gameflow.SetPhase("Lobby");
+
+    core::EngineConfig config;
+    config.lockfile_paths = {lockfile_path};
+    auto metrics = std::make_shared<models::PerformanceMetrics>();
+    std::unique_ptr<core::LCUEventStream> stream;
+    if (use_event_stream) {
+        stream = core::CreatePlatformEventStream();
+    } else {
+        stream = std::make_unique<OfflineEventStream>();
+    }
+    core::AutoAcceptEngine engine(config, core::CreatePlatformTransport(config.request_timeout),
+                                  std::move(stream), metrics);
+    engine.Start();
+
+    bool ready = WaitFor([&]() {
+        return engine.IsClientConnected() &&
+               (!use_event_stream || (engine.IsEventStreamConnected() && server.GetSubscriberCount() > 0));
+    }, std::chrono::seconds(5));
+    if (!ready) {
+        engine.Stop();
+        return false;
+    }
+
+    // Start each cycle at a random point of the engine's poll interval
+    std::mt19937 random(7);
+    std::uniform_int_distribution<int> offset_ms(0, static_cast<int>(config.poll_schedule.active.count()));
+    int requests_before = server.GetRequestCount();
+    for (int cycle = 0; cycle < cycles; ++cycle) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(offset_ms(random)));
+        gameflow.Play(timeline);
+    }
+    result.requests = server.GetRequestCount() - requests_before;
+    engine.Stop();
+
+    for (std::chrono::microseconds latency : gameflow.GetAcceptLatencies()) {
+        result.latency.Add(latency);
+    }
+    result.ready_checks = gameflow.GetReadyCheckCount();
+    result.accepted = gameflow.GetAcceptCount();
+    result.accept_post = metrics->GetAcceptanceHistogram();
+    return true;
+}
+
+struct LaggingResult {
+    int accepted = 0;
+    int idle_scans = 0;   // Ready-check GETs while "None" was not after a queue
+};
+
+void SetPhaseResource(tools::LCUMockServer& server, const char* phase) {
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, std::string("\"") + phase + "\""});
+}
+
+bool RunLaggingGameflow(tools::LCUMockServer& server, const std::string& lockfile_path, LaggingResult& result) {
+    server.ClearResponses();
+    SetPhaseResource(server, "Lobby");
+    for (const char* endpoint : core::READY_CHECK_ACCEPT_ENDPOINTS) {
+        server.SetResponse("POST", endpoint, {204, ""});
+    }
+
+    std::atomic<int> ready_check_gets{0};
+    std::atomic<int> accepts{0};
+    server.SetRequestObserver([&](const std::string& method, const std::string& path) {
+        if (method == "GET" && path == core::READY_CHECK_URI) {
+            ready_check_gets++;
+        } else if (method == "POST" && path != core::GAMEFLOW_PHASE_URI) {
+            accepts++;
+            server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_ACCEPTED});
+        }
+    });
+
+    core::EngineConfig config;
+    config.lockfile_paths = {lockfile_path};
+    config.poll_schedule.active = std::chrono::milliseconds(20);
+    config.poll_schedule.idle = std::chrono::milliseconds(20);
+    core::AutoAcceptEngine engine(config, core::CreatePlatformTransport(config.request_timeout),
+                                  std::make_unique<OfflineEventStream>());
+    engine.Start();
+    if (!WaitFor([&]() { return engine.IsClientConnected() && engine.GetCurrentPhase() == "Lobby"; },
+                 std::chrono::seconds(5))) {
+        engine.Stop();
+        server.SetRequestObserver(nullptr);
+        return false;
+    }
+
+    // Out of the queue "None" is believed
+    SetPhaseResource(server, "None");
+    WaitFor([&]() { return engine.GetCurrentPhase() == "None"; }, std::chrono::seconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    result.idle_scans = ready_check_gets.load();
+
+    // Queue, then two ready checks the gameflow phase never shows
+    SetPhaseResource(server, "Matchmaking");
+    WaitFor([&]() { return engine.GetCurrentPhase() == "Matchmaking"; }, std::chrono::seconds(1));
+    for (int ready_check = 1; ready_check <= 2; ++ready_check) {
+        server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+        SetPhaseResource(server, "None");
+        WaitFor([&]() { return accepts.load() >= ready_check; }, std::chrono::seconds(2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        server.SetResponse("GET", core::READY_CHECK_URI,
+                           {404, R"({"errorCode":"RPC_ERROR","httpStatus":404,"message":"No ready check"})"});
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    engine.Stop();
+    server.SetRequestObserver(nullptr);
+
+    result.accepted = accepts.load();
+    return true;
+}
+
+void PrintEngine(const char* title, const EngineResult& result, int cycles) {
+    std::printf("%s\n", title);
+    result.latency.Print("  ready check -> accept POST");
+    std::printf("  accepted %d of %d ready checks, %.1f HTTP requests per cycle\n", result.accepted,
+                result.ready_checks, static_cast<double>(result.requests) / cycles);
+    std::printf("  engine POST latency: p50=%lldus p90=%lldus p99=%lldus p99.9=%lldus\n\n",
+                static_cast<long long>(result.accept_post.GetP50().count()),
+                static_cast<long long>(result.accept_post.GetP90().count()),
+                static_cast<long long>(result.accept_post.GetP99().count()),
+                static_cast<long long>(result.accept_post.GetP999().count()));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int iterations = bench::ParseIntArg(argc, argv, "--iterations", 300);
+    int cycles = bench::ParseIntArg(argc, argv, "--cycles", 6);
+    std::string timeline_path = bench::ParseStringArg(argc, argv, "--timeline",
+                                                      LAA_TIMELINES_DIR "/queue_pop.timeline");
+    tools::MockFaults faults;
+    faults.latency = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--latency", 0));
+    faults.jitter = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--jitter", 0));
+    faults.error_rate = bench::ParseIntArg(argc, argv, "--error-rate", 0) / 100.0;
+
+    std::vector<tools::PhaseStep> timeline;
+    if (!tools::MockGameflow::LoadTimeline(timeline_path, timeline)) {
+        std::fprintf(stderr, "Failed to load timeline %s\n", timeline_path.c_str());
+        return 1;
+    }
+
+    tools::LCUMockServer server;
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    std::printf("LCU stand-in on 127.0.0.1:%d, %d accepts per path\n\n", server.GetPort(), iterations);
+
+    ScenarioResult current = RunScenario(server, credentials, core::READY_CHECK_ACCEPT_ENDPOINTS[0], iterations);
+    PrintScenario("Current client build (matchmaking endpoint):", current, iterations);
+
+    ScenarioResult older = RunScenario(server, credentials, core::READY_CHECK_ACCEPT_ENDPOINTS[1], iterations);
+    PrintScenario("Older client build (lobby endpoint only):", older, iterations);
+
+    // End to end through the engine
+    server.ClearResponses();
+    server.SetFaults(faults);
+    std::filesystem::path lockfile_dir = std::filesystem::temp_directory_path() /
+                                         ("laa_accept_bench_" + std::to_string(server.GetPort()));
+    std::filesystem::create_directories(lockfile_dir);
+    std::string lockfile_path = (lockfile_dir / "lockfile").string();
+    if (!server.WriteLockfile(lockfile_path)) {
+        std::fprintf(stderr, "Failed to write lockfile %s\n", lockfile_path.c_str());
+        return 1;
+    }
+
+    std::printf("Engine end to end: %d cycles of %s, faults: +%lldms (jitter %lldms), %.0f%% errors\n\n",
+                cycles, std::filesystem::path(timeline_path).filename().string().c_str(),
+                static_cast<long long>(faults.latency.count()), static_cast<long long>(faults.jitter.count()),
+                faults.error_rate * 100.0);
+
+    EngineResult pushed;
+    EngineResult polled;
+    bool engine_ok = RunEngine(server, lockfile_path, timeline, cycles, true, pushed) &&
+                     RunEngine(server, lockfile_path, timeline, cycles, false, polled);
+    server.SetFaults(tools::MockFaults());
+    LaggingResult lagging;
+    engine_ok = engine_ok && RunLaggingGameflow(server, lockfile_path, lagging);
+    std::filesystem::remove_all(lockfile_dir);
+    server.Stop();
+    if (!engine_ok) {
+        std::fprintf(stderr, "Engine did not connect to the stand-in\n");
+        return 1;
+    }
+    PrintEngine("Event stream:", pushed, cycles);
+    PrintEngine("Polling fallback:", polled, cycles);
+    std::printf("Lagging gameflow phase: accepted %d of 2 scanned ready checks, %d scans of an idle \"None\"\n",
+                lagging.accepted, lagging.idle_scans);
+
+    // Injected errors may legitimately cost an accept
+    bool all_accepted = pushed.accepted == pushed.ready_checks && polled.accepted == polled.ready_checks;
+    bool faults_injected = faults.error_rate > 0.0;
+    bool lagging_ok = lagging.accepted == 2 && lagging.idle_scans == 0;
+    return (current.failures == 0 && older.failures == 0 && (all_accepted || faults_injected) && lagging_ok) ? 0 : 1;
+}
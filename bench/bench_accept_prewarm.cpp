@@ -0,0 +1,114 @@
+// Accept POST latency depending on the state of the connection when the
+// ready check pops: none yet (a fresh session), a keep-alive connection the
+// client closed while the queue was idle (found out by the accept itself,
+// which is then replayed), and one pre-warmed on entering the queue, with the
+// accept prepared. The stand-in drops connections idle for --idle-timeout.
+// Exits 1 if a pre-warmed accept fails or needs a new handshake.
+//
+//   bench_accept_prewarm [--iterations N] [--idle-timeout MS]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include <csignal>
+#include <cstdio>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+struct Scenario {
+    bench::LatencySamples latency;
+    int handshakes = 0;
+    int failures = 0;
+};
+
+void Print(const char* label, const Scenario& scenario) {
+    scenario.latency.Print(label);
+    std::printf("%-34s %d handshakes during accepts, %d failed\n", "", scenario.handshakes, scenario.failures);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int iterations = bench::ParseIntArg(argc, argv, "--iterations", 20);
+    std::chrono::milliseconds idle_timeout(bench::ParseIntArg(argc, argv, "--idle-timeout", 100));
+    const char* endpoint = core::READY_CHECK_ACCEPT_ENDPOINTS[0];
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"Matchmaking\""});
+    server.SetResponse("POST", endpoint, {204, ""});
+    tools::MockFaults faults;
+    faults.idle_timeout = idle_timeout;
+    server.SetFaults(faults);
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    std::printf("LCU stand-in on 127.0.0.1:%d, closing connections idle for %lldms\n\n", server.GetPort(),
+                static_cast<long long>(idle_timeout.count()));
+
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials(credentials);
+    core::ReadyCheckAcceptor acceptor(session);
+    const auto queue_wait = idle_timeout + std::chrono::milliseconds(50);
+
+    Scenario cold;
+    Scenario stale;
+    Scenario prewarmed;
+    for (int i = 0; i < iterations; ++i) {
+        // First request of a session
+        {
+            core::LCUSession fresh(core::CreatePlatformTransport());
+            fresh.UpdateCredentials(credentials);
+            core::ReadyCheckAcceptor fresh_acceptor(fresh);
+            int handshakes = server.GetHandshakeCount();
+            auto start = std::chrono::steady_clock::now();
+            cold.failures += fresh_acceptor.Accept(start).accepted ? 0 : 1;
+            cold.latency.Add(std::chrono::steady_clock::now() - start);
+            cold.handshakes += server.GetHandshakeCount() - handshakes;
+        }
+
+        // In the queue long enough for the client to drop the connection
+        session.Get(core::GAMEFLOW_PHASE_URI);
+        std::this_thread::sleep_for(queue_wait);
+        int handshakes = server.GetHandshakeCount();
+        auto start = std::chrono::steady_clock::now();
+        stale.failures += acceptor.Accept(start).accepted ? 0 : 1;
+        stale.latency.Add(std::chrono::steady_clock::now() - start);
+        stale.handshakes += server.GetHandshakeCount() - handshakes;
+
+        // Same wait, but the queue entry (or a keep-warm pass) checked the connection
+        session.Get(core::GAMEFLOW_PHASE_URI);
+        std::this_thread::sleep_for(queue_wait);
+        session.Prewarm(core::HttpMethod::POST, acceptor.GetNextEndpoint(), core::GAMEFLOW_PHASE_URI);
+        handshakes = server.GetHandshakeCount();
+        start = std::chrono::steady_clock::now();
+        prewarmed.failures += acceptor.Accept(start).accepted ? 0 : 1;
+        prewarmed.latency.Add(std::chrono::steady_clock::now() - start);
+        prewarmed.handshakes += server.GetHandshakeCount() - handshakes;
+    }
+
+    std::printf("accept POST, %d ready checks each:\n", iterations);
+    Print("  new session", cold);
+    Print("  connection dropped while idle", stale);
+    Print("  pre-warmed", prewarmed);
+    if (prewarmed.latency.PercentileMicros(50) > 0.0) {
+        std::printf("  p50 saved: %.1fus against a new session, %.1fus against a dropped connection\n",
+                    cold.latency.PercentileMicros(50) - prewarmed.latency.PercentileMicros(50),
+                    stale.latency.PercentileMicros(50) - prewarmed.latency.PercentileMicros(50));
+    }
+
+    server.Stop();
+    if (prewarmed.failures > 0 || prewarmed.handshakes > 0) {
+        std::fprintf(stderr, "pre-warmed accept check failed\n");
+        return 1;
+    }
+    return 0;
+}
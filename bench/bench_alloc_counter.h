@@ -0,0 +1,119 @@
+#pragma once
+
+// Replaces the global operator new / delete to count heap allocations.
+// Include from the one translation unit of a benchmark only.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace league_auto_accept {
+namespace bench {
+
+struct AllocationCount {
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+namespace detail {
+inline thread_local bool counting_allocations = false;
+inline thread_local AllocationCount allocation_count;
+}
+
+// Counts the allocations the calling thread makes while the scope is alive;
+// other threads, e.g. the LCU stand-in's, are not counted
+class AllocationScope {
+public:
+    AllocationScope() {
+        detail::allocation_count = AllocationCount{};
+        detail::counting_allocations = true;
+    }
+    ~AllocationScope() { detail::counting_allocations = false; }
+
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+    AllocationCount Get() const { return detail::allocation_count; }
+};
+
+} // namespace bench
+} // namespace league_auto_accept
+
+// The replacements below pair operator new with free() on purpose: malloc
+// backs both. GCC cannot tell once they are inlined into a caller and warns.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    using namespace league_auto_accept::bench;
+    if (detail::counting_allocations) {
+        detail::allocation_count.allocations++;
+        detail::allocation_count.bytes += size;
+    }
+    if (void* memory = std::malloc(size != 0 ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// Over-aligned requests, e.g. from std::pmr::new_delete_resource()
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    using namespace league_auto_accept::bench;
+    if (detail::counting_allocations) {
+        detail::allocation_count.allocations++;
+        detail::allocation_count.bytes += size;
+    }
+    std::size_t align = static_cast<std::size_t>(alignment);
+    std::size_t rounded = (size + align - 1) / align * align;
+    if (void* memory = std::aligned_alloc(align, rounded != 0 ? rounded : align)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return operator new(size, alignment);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace bench {
+
+// Collects latency samples and prints a one-line distribution summary
+class LatencySamples {
+public:
+    void Add(std::chrono::nanoseconds sample) { samples_.push_back(sample.count()); }
+    size_t Count() const { return samples_.size(); }
+    void Clear() { samples_.clear(); }
+
+    double PercentileMicros(double percentile) const {
+        if (samples_.empty()) return 0.0;
+        std::vector<long long> sorted = samples_;
+        std::sort(sorted.begin(), sorted.end());
+        size_t index = static_cast<size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+        return static_cast<double>(sorted[std::min(index, sorted.size() - 1)]) / 1000.0;
+    }
+
+    double MeanMicros() const {
+        if (samples_.empty()) return 0.0;
+        long double total = 0;
+        for (long long sample : samples_) total += sample;
+        return static_cast<double>(total / samples_.size()) / 1000.0;
+    }
+
+    void Print(const std::string& label) const {
+        std::printf("%-34s n=%-6zu mean=%9.1fus p50=%9.1fus p90=%9.1fus p99=%9.1fus max=%9.1fus\n",
+                    label.c_str(), samples_.size(), MeanMicros(), PercentileMicros(50),
+                    PercentileMicros(90), PercentileMicros(99), PercentileMicros(100));
+    }
+
+private:
+    std::vector<long long> samples_;
+};
+
+inline int ParseIntArg(int argc, char* argv[], const std::string& name, int default_value) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (name == argv[i]) {
+            return std::stoi(argv[i + 1]);
+        }
+    }
+    return default_value;
+}
+
+inline std::string ParseStringArg(int argc, char* argv[], const std::string& name, const std::string& default_value) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (name == argv[i]) {
+            return argv[i + 1];
+        }
+    }
+    return default_value;
+}
+
+} // namespace bench
+} // namespace league_auto_accept
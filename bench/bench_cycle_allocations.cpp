@@ -0,0 +1,193 @@
+// Heap allocations per detection pass of the AutoAcceptEngine, driven with
+// RunOnce() against the LCU stand-in on its polling fallback: a quiet queue
+// poll, a pass that accepts a ready check, a pass that fails and logs, and a
+// pass in a phase this build does not know. Each runs once with the pass's
+// transient strings on the heap (cycle_arena_size 0, as before the arena)
+// and once in the per-pass arena. Only the detection thread is counted.
+// Exits 1 if an arena pass allocates or any pass misbehaves.
+//
+//   bench_cycle_allocations [--passes N]
+
+#include "bench_alloc_counter.h"
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/auto_accept_engine.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include <csignal>
+#include <cstdio>
+#include <filesystem>
+#include <functional>
+#include <string>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"None","state":"InProgress",)"
+    R"("suppressUx":false,"timer":8.0})";
+constexpr const char* READY_CHECK_ACCEPTED =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"Accepted","state":"InProgress",)"
+    R"("suppressUx":false,"timer":8.0})";
+// Longer than a short string, as a new phase name from a client update may be
+constexpr const char* NEW_PHASE = "\"ReconnectingToSpectatorLobby\"";
+
+// Event stream that never connects, to keep the engine on its polling fallback
+class OfflineEventStream : public core::LCUEventStream {
+public:
+    bool Connect(const core::LCUCredentials&) override { return false; }
+    void Close() override {}
+    bool IsConnected() const override { return false; }
+    bool Subscribe(const std::string&) override { return false; }
+    bool ReadMessage(std::string&) override { return false; }
+    void Interrupt() override {}
+    std::string GetLastError() const override { return "offline"; }
+};
+
+struct Passes {
+    bench::AllocationCount allocations;
+    int passes = 0;
+    int log_lines = 0;
+    int accepts = 0;
+};
+
+struct Engine {
+    core::AutoAcceptEngine engine;
+    int log_lines = 0;
+    int accepts = 0;
+
+    Engine(const core::EngineConfig& config)
+        : engine(config, core::CreatePlatformTransport(config.request_timeout),
+                 std::make_unique<OfflineEventStream>()) {
+        // Counted, not kept: what a front-end does with a line is its own cost
+        engine.SetLogCallback([this](std::string_view) { log_lines++; });
+        engine.SetAcceptCallback([this](const core::AcceptResult& result) { accepts += result.accepted; });
+    }
+};
+
+// `setup` puts the stand-in in place before each counted pass, uncounted
+Passes Run(Engine& engine, int passes, const std::function<void()>& setup) {
+    for (int i = 0; i < 5; ++i) {
+        setup();
+        engine.engine.RunOnce();
+    }
+
+    Passes result;
+    int log_lines = engine.log_lines;
+    int accepts = engine.accepts;
+    for (int i = 0; i < passes; ++i) {
+        setup();
+        bench::AllocationScope scope;
+        engine.engine.RunOnce();
+        bench::AllocationCount count = scope.Get();
+        result.allocations.allocations += count.allocations;
+        result.allocations.bytes += count.bytes;
+    }
+    result.passes = passes;
+    result.log_lines = engine.log_lines - log_lines;
+    result.accepts = engine.accepts - accepts;
+    return result;
+}
+
+struct Scenarios {
+    Passes queue;
+    Passes ready_check;
+    Passes failing;
+    Passes new_phase;
+};
+
+Scenarios RunAll(tools::LCUMockServer& server, const std::string& lockfile_path, size_t arena_size, int passes) {
+    core::EngineConfig config;
+    config.lockfile_paths = {lockfile_path};
+    config.cycle_arena_size = arena_size;
+    Engine engine(config);
+    const char* accept_path = core::READY_CHECK_ACCEPT_ENDPOINTS[0];
+    Scenarios scenarios;
+
+    server.ClearResponses();
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"Matchmaking\""});
+    scenarios.queue = Run(engine, passes, []() {});
+
+    // Out of the queue and back into a fresh ready check before each pass;
+    // accepting flips it, so the engine's verify read sees that
+    server.SetResponse("POST", accept_path, {204, ""});
+    server.SetRequestObserver([&server, accept_path](const std::string& method, const std::string& path) {
+        if (method == "POST" && path == accept_path) {
+            server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_ACCEPTED});
+        }
+    });
+    scenarios.ready_check = Run(engine, passes, [&server, &engine]() {
+        server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"Matchmaking\""});
+        engine.engine.RunOnce();
+        server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"ReadyCheck\""});
+        server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+    });
+    server.SetRequestObserver(nullptr);
+
+    // An error body: not retryable, so every pass logs and the breaker stays closed
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI,
+                       {404, R"({"errorCode":"RPC_ERROR","httpStatus":404,"message":"No gameflow phase"})"});
+    scenarios.failing = Run(engine, passes, []() {});
+
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, NEW_PHASE});
+    scenarios.new_phase = Run(engine, passes, []() {});
+    return scenarios;
+}
+
+void Print(const char* label, const Passes& heap, const Passes& arena) {
+    std::printf("  %-26s heap %5.2f allocations, %7.1f bytes; arena %5.2f allocations, %7.1f bytes per pass\n",
+                label, static_cast<double>(heap.allocations.allocations) / heap.passes,
+                static_cast<double>(heap.allocations.bytes) / heap.passes,
+                static_cast<double>(arena.allocations.allocations) / arena.passes,
+                static_cast<double>(arena.allocations.bytes) / arena.passes);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int passes = bench::ParseIntArg(argc, argv, "--passes", 200);
+
+    tools::LCUMockServer server;
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    std::filesystem::path lockfile_dir = std::filesystem::temp_directory_path() /
+                                         ("laa_cycle_bench_" + std::to_string(server.GetPort()));
+    std::filesystem::create_directories(lockfile_dir);
+    std::string lockfile_path = (lockfile_dir / "lockfile").string();
+    if (!server.WriteLockfile(lockfile_path)) {
+        std::fprintf(stderr, "Failed to write lockfile %s\n", lockfile_path.c_str());
+        return 1;
+    }
+
+    Scenarios heap = RunAll(server, lockfile_path, 0, passes);
+    Scenarios arena = RunAll(server, lockfile_path, core::EngineConfig().cycle_arena_size, passes);
+    server.Stop();
+    std::filesystem::remove_all(lockfile_dir);
+
+    std::printf("detection passes on the polling fallback, %d each:\n", passes);
+    Print("queue poll", heap.queue, arena.queue);
+    Print("ready check accepted", heap.ready_check, arena.ready_check);
+    Print("phase read failing", heap.failing, arena.failing);
+    Print("unknown phase", heap.new_phase, arena.new_phase);
+    std::printf("  log lines per pass: ready check %.1f, failing %.1f; accepted %d + %d of %d\n",
+                static_cast<double>(arena.ready_check.log_lines) / passes,
+                static_cast<double>(arena.failing.log_lines) / passes,
+                heap.ready_check.accepts, arena.ready_check.accepts, passes);
+
+    bool ok = heap.ready_check.accepts == passes && arena.ready_check.accepts == passes &&
+              arena.failing.log_lines == passes;
+    for (const Passes* pass : {&arena.queue, &arena.ready_check, &arena.failing, &arena.new_phase}) {
+        ok = ok && pass->allocations.allocations == 0;
+    }
+    if (!ok) {
+        std::fprintf(stderr, "an arena pass allocated, or a ready check was missed or a failure not logged\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Detection loop timing: sleeping a period after each pass, as the loops did,
+// versus DeadlineTicker's absolute deadlines, with and without an elevated
+// thread priority. Each pass spins for a random share of the period and
+// other threads keep the CPU busy. Reports how far wakes land from the ideal
+// grid (start + n * period) and how much each interval is off the period.
+// Exits 1 if the ticker drifts off the grid by more than a period.
+//
+//   bench_deadline_ticker [--ticks N] [--period-ms N] [--load-threads N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/deadline_ticker.h"
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace league_auto_accept;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Busy work standing in for an LCU request or a detection pass
+void Spin(std::chrono::nanoseconds duration) {
+    Clock::time_point end = Clock::now() + duration;
+    while (Clock::now() < end) {
+    }
+}
+
+struct RunResult {
+    bench::LatencySamples grid_offsets;      // |wake - (start + n * period)|
+    bench::LatencySamples interval_errors;   // |wake - previous wake - period|
+    std::chrono::nanoseconds final_offset{0};
+    uint64_t missed = 0;
+};
+
+enum class Mode { SLEEP_FOR, DEADLINE, DEADLINE_ELEVATED };
+
+RunResult Run(Mode mode, int ticks, std::chrono::milliseconds period) {
+    RunResult result;
+    uint32_t random = 12345;
+    auto next_work = [&random, period]() {
+        random = random * 1103515245u + 12345u;
+        return std::chrono::nanoseconds(period) * static_cast<int>((random >> 8) % 40) / 100;
+    };
+
+    bool elevated = mode == Mode::DEADLINE_ELEVATED &&
+                    core::SetCurrentThreadPriority(core::ThreadPriority::ELEVATED);
+    if (mode == Mode::DEADLINE_ELEVATED && !elevated) {
+        std::printf("  (cannot elevate priority here; running at normal priority)\n");
+    }
+
+    Clock::time_point start = Clock::now();
+    core::DeadlineTicker ticker(period, start);
+    Clock::time_point previous = start;
+    for (int i = 1; i <= ticks; ++i) {
+        Spin(next_work());
+        if (mode == Mode::SLEEP_FOR) {
+            std::this_thread::sleep_for(period);
+        } else {
+            ticker.SleepUntilNextTick();
+        }
+
+        Clock::time_point now = Clock::now();
+        std::chrono::nanoseconds offset = now - (start + period * i);
+        std::chrono::nanoseconds interval_error = (now - previous) - std::chrono::nanoseconds(period);
+        result.grid_offsets.Add(offset < offset.zero() ? -offset : offset);
+        result.interval_errors.Add(interval_error < interval_error.zero() ? -interval_error : interval_error);
+        result.final_offset = offset;
+        previous = now;
+    }
+    result.missed = ticker.GetStats().missed;
+
+    if (elevated) {
+        core::SetCurrentThreadPriority(core::ThreadPriority::NORMAL);
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int ticks = bench::ParseIntArg(argc, argv, "--ticks", 200);
+    std::chrono::milliseconds period(bench::ParseIntArg(argc, argv, "--period-ms", 20));
+    int load_threads = bench::ParseIntArg(argc, argv, "--load-threads", 2);
+
+    std::atomic<bool> loading{true};
+    std::vector<std::thread> load;
+    for (int i = 0; i < load_threads; ++i) {
+        load.emplace_back([&loading]() {
+            while (loading.load(std::memory_order_relaxed)) {
+                Spin(std::chrono::microseconds(500));
+            }
+        });
+    }
+
+    std::printf("%d ticks of %lldms, passes 0-40%% of the period, %d busy threads\n\n", ticks,
+                static_cast<long long>(period.count()), load_threads);
+
+    const struct {
+        Mode mode;
+        const char* name;
+    } modes[] = {
+        {Mode::SLEEP_FOR, "sleep_for after the pass"},
+        {Mode::DEADLINE, "DeadlineTicker"},
+        {Mode::DEADLINE_ELEVATED, "DeadlineTicker, elevated"},
+    };
+
+    bool ok = true;
+    for (const auto& mode : modes) {
+        std::printf("%s\n", mode.name);
+        RunResult result = Run(mode.mode, ticks, period);
+        result.grid_offsets.Print("  offset from grid");
+        result.interval_errors.Print("  interval error");
+        std::printf("    last wake %+.1fms off the grid, %llu deadlines missed\n\n",
+                    static_cast<double>(result.final_offset.count()) / 1e6,
+                    static_cast<unsigned long long>(result.missed));
+        if (mode.mode != Mode::SLEEP_FOR && result.final_offset > std::chrono::nanoseconds(period)) {
+            ok = false;
+        }
+    }
+
+    loading = false;
+    for (std::thread& thread : load) {
+        thread.join();
+    }
+
+    if (!ok) {
+        std::fprintf(stderr, "deadline ticker drifted off its grid\n");
+        return 1;
+    }
+    return 0;
+}
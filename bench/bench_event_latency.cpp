@@ -0,0 +1,227 @@
+// End-to-end ready-check latency against the local LCU stand-in: time from the
+// client publishing the ready check to the accept POST arriving, for the
+// WebSocket event stream versus polling the gameflow phase.
+//
+// Each cycle replays a recorded Lobby -> Matchmaking -> ReadyCheck sequence
+// after a random delay so polling is sampled at every point of its interval.
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/json_scan.h"
+#include "league_auto_accept/core/lcu_event_listener.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <functional>
+#include <random>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* ACCEPT_PATH = "/lol-matchmaking/v1/ready-check/accept";
+constexpr std::chrono::milliseconds ACCEPT_TIMEOUT{2000};
+constexpr std::chrono::milliseconds EVENT_RESYNC_INTERVAL{1000};
+
+// Records when the accept POST reaches the stand-in
+class AcceptObserver {
+public:
+    void OnRequest(const std::string& method, const std::string& path) {
+        if (method != "POST" || path != ACCEPT_PATH) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!accepted_) {
+            accepted_ = true;
+            accept_time_ = std::chrono::steady_clock::now();
+            cv_.notify_all();
+        }
+    }
+
+    void Reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        accepted_ = false;
+    }
+
+    bool WaitForAccept(std::chrono::steady_clock::time_point& accept_time) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!cv_.wait_for(lock, ACCEPT_TIMEOUT, [this]() { return accepted_; })) return false;
+        accept_time = accept_time_;
+        return true;
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool accepted_ = false;
+    std::chrono::steady_clock::time_point accept_time_;
+};
+
+// Shared accept decision so both modes react to the same phases
+class ReadyCheckHandler {
+public:
+    explicit ReadyCheckHandler(core::LCUSession& session) : session_(session) {}
+
+    void OnPhase(std::string_view phase) {
+        if (phase != "ReadyCheck") {
+            handled_ = false;
+            return;
+        }
+        if (!handled_) {
+            handled_ = true;
+            session_.Post(ACCEPT_PATH);
+        }
+    }
+
+    void PollPhase() {
+        core::HttpResponse response = session_.Get(core::GAMEFLOW_PHASE_URI);
+        std::string_view phase;
+        if (response.IsSuccess() && core::UnquoteJsonString(response.body, phase)) {
+            OnPhase(phase);
+        }
+    }
+
+private:
+    core::LCUSession& session_;
+    bool handled_ = false;
+};
+
+struct ModeResult {
+    bench::LatencySamples latency;
+    int misses = 0;
+    int requests = 0;
+};
+
+ModeResult RunCycles(tools::LCUMockServer& server, AcceptObserver& observer,
+                     const std::vector<tools::MockEvent>& recording, int cycles, int poll_interval_ms) {
+    ModeResult result;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> jitter(0, poll_interval_ms);
+    int requests_before = server.GetRequestCount();
+
+    for (int cycle = 0; cycle < cycles; ++cycle) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(jitter(rng)));
+        observer.Reset();
+
+        std::chrono::steady_clock::time_point published{};
+        for (const tools::MockEvent& mock_event : recording) {
+            std::this_thread::sleep_for(mock_event.delay);
+
+            core::LCUEvent event{mock_event.uri, mock_event.event_type, mock_event.data, {}};
+            std::string phase;
+            if (published == std::chrono::steady_clock::time_point{} &&
+                core::GetPhaseFromEvent(event, phase) && phase == "ReadyCheck") {
+                published = std::chrono::steady_clock::now();
+            }
+            server.PublishEvent(mock_event.uri, mock_event.data, mock_event.event_type);
+        }
+
+        std::chrono::steady_clock::time_point accepted;
+        if (observer.WaitForAccept(accepted)) {
+            result.latency.Add(accepted - published);
+        } else {
+            result.misses++;
+        }
+    }
+
+    result.requests = server.GetRequestCount() - requests_before;
+    return result;
+}
+
+ModeResult RunWithClient(tools::LCUMockServer& server, AcceptObserver& observer,
+                         const std::vector<tools::MockEvent>& recording, int cycles, int poll_interval_ms,
+                         const std::function<void(std::atomic<bool>&)>& client_loop) {
+    std::atomic<bool> running{true};
+    std::thread client([&]() { client_loop(running); });
+    ModeResult result = RunCycles(server, observer, recording, cycles, poll_interval_ms);
+    running = false;
+    client.join();
+    return result;
+}
+
+void PrintResult(const char* label, const ModeResult& result, int cycles) {
+    result.latency.Print(label);
+    std::printf("%-34s misses=%d HTTP requests=%d (%.1f per cycle)\n", "", result.misses, result.requests,
+                static_cast<double>(result.requests) / cycles);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int cycles = bench::ParseIntArg(argc, argv, "--cycles", 20);
+    int poll_interval_ms = bench::ParseIntArg(argc, argv, "--poll-interval", 250);
+    std::string recording_path = bench::ParseStringArg(argc, argv, "--recording",
+                                                       LAA_RECORDINGS_DIR "/queue_to_ready_check.events");
+
+    std::vector<tools::MockEvent> recording;
+    if (!tools::LCUMockServer::LoadEventRecording(recording_path, recording)) {
+        std::fprintf(stderr, "Failed to load event recording %s\n", recording_path.c_str());
+        return 1;
+    }
+
+    tools::LCUMockServer server;
+    AcceptObserver observer;
+    server.SetResponse("POST", ACCEPT_PATH, {204, ""});
+    server.SetRequestObserver([&](const std::string& method, const std::string& path) {
+        observer.OnRequest(method, path);
+    });
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    std::printf("LCU stand-in on 127.0.0.1:%d, %d cycles of %zu events, poll interval %dms\n\n",
+                server.GetPort(), cycles, recording.size(), poll_interval_ms);
+
+    ModeResult polling = RunWithClient(server, observer, recording, cycles, poll_interval_ms,
+        [&](std::atomic<bool>& running) {
+            core::LCUSession session(core::CreatePlatformTransport());
+            session.UpdateCredentials(credentials);
+            ReadyCheckHandler handler(session);
+            while (running) {
+                handler.PollPhase();
+                std::this_thread::sleep_for(std::chrono::milliseconds(poll_interval_ms));
+            }
+        });
+
+    core::LCUEventListener listener(core::CreatePlatformEventStream());
+    listener.UpdateCredentials(credentials);
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while ((!listener.IsConnected() || server.GetSubscriberCount() == 0) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    if (!listener.IsConnected()) {
+        std::fprintf(stderr, "Event stream did not connect: %s\n", listener.GetLastError().c_str());
+        return 1;
+    }
+
+    ModeResult events = RunWithClient(server, observer, recording, cycles, poll_interval_ms,
+        [&](std::atomic<bool>& running) {
+            core::LCUSession session(core::CreatePlatformTransport());
+            session.UpdateCredentials(credentials);
+            ReadyCheckHandler handler(session);
+            core::LCUEvent event;
+            std::string phase;
+            while (running) {
+                if (listener.WaitForEvent(event, EVENT_RESYNC_INTERVAL)) {
+                    if (core::GetPhaseFromEvent(event, phase)) handler.OnPhase(phase);
+                } else if (running) {
+                    handler.PollPhase();
+                }
+            }
+        });
+    listener.Stop();
+
+    PrintResult("gameflow polling", polling, cycles);
+    PrintResult("WebSocket events", events, cycles);
+    if (events.latency.PercentileMicros(50) > 0.0) {
+        std::printf("\np50 speedup: %.1fx\n", polling.latency.PercentileMicros(50) / events.latency.PercentileMicros(50));
+    }
+    std::printf("Events received: %d\n", listener.GetEventCount());
+
+    server.Stop();
+    return (polling.misses == 0 && events.misses == 0) ? 0 : 1;
+}
@@ -0,0 +1,245 @@
+// Per-poll phase handling over a simulated play session: the string
+// if-chain parse, string compares against the last phase and the nested
+// transition switch the loop used to run, versus the perfect-hashed phase
+// id, integer compares and the transition bitset table. Exits 1 if a wire
+// name does not map back to its phase, the two parsers or transition checks
+// disagree, or observers fire on anything but a change of phase.
+//
+//   bench_gameflow_phase [--games N] [--rounds N]
+
+#include "bench_common.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace league_auto_accept;
+using models::GameflowPhase;
+
+namespace {
+
+struct PhaseSpan {
+    const char* phase;
+    int polls;
+};
+
+// One queue-to-lobby cycle of a ranked game, in polls at the active interval
+constexpr PhaseSpan GAME_CYCLE[] = {
+    {"Lobby", 240},
+    {"Matchmaking", 480},
+    {"ReadyCheck", 40},
+    {"ChampSelect", 360},
+    {"GameStart", 80},
+    {"InProgress", 7200},
+    {"WaitingForStats", 60},
+    {"PreEndOfGame", 40},
+    {"EndOfGame", 180},
+    {"None", 120}
+};
+
+// Phases the old parser and transition switch knew
+constexpr GameflowPhase LEGACY_PHASES[] = {
+    GameflowPhase::NONE, GameflowPhase::LOBBY, GameflowPhase::MATCHMAKING, GameflowPhase::READY_CHECK,
+    GameflowPhase::CHAMPION_SELECT, GameflowPhase::GAME_START, GameflowPhase::IN_PROGRESS,
+    GameflowPhase::WAITING_FOR_STATS, GameflowPhase::PRE_END_OF_GAME, GameflowPhase::END_OF_GAME
+};
+
+bool LegacyParse(std::string_view phase_str, GameflowPhase& phase) {
+    if (phase_str == "None") phase = GameflowPhase::NONE;
+    else if (phase_str == "Lobby") phase = GameflowPhase::LOBBY;
+    else if (phase_str == "Matchmaking") phase = GameflowPhase::MATCHMAKING;
+    else if (phase_str == "ReadyCheck") phase = GameflowPhase::READY_CHECK;
+    else if (phase_str == "ChampSelect") phase = GameflowPhase::CHAMPION_SELECT;
+    else if (phase_str == "GameStart") phase = GameflowPhase::GAME_START;
+    else if (phase_str == "InProgress" || phase_str == "InGame") phase = GameflowPhase::IN_PROGRESS;
+    else if (phase_str == "WaitingForStats") phase = GameflowPhase::WAITING_FOR_STATS;
+    else if (phase_str == "PreEndOfGame") phase = GameflowPhase::PRE_END_OF_GAME;
+    else if (phase_str == "EndOfGame") phase = GameflowPhase::END_OF_GAME;
+    else return false;
+    return true;
+}
+
+bool LegacyIsValidTransition(GameflowPhase from, GameflowPhase to) {
+    if (from == GameflowPhase::NONE || to == GameflowPhase::NONE) {
+        return true;
+    }
+
+    switch (from) {
+    case GameflowPhase::LOBBY:
+        return to == GameflowPhase::MATCHMAKING || to == GameflowPhase::CHAMPION_SELECT ||
+               to == GameflowPhase::GAME_START || to == GameflowPhase::IN_PROGRESS;
+    case GameflowPhase::MATCHMAKING:
+        return to == GameflowPhase::READY_CHECK || to == GameflowPhase::LOBBY;
+    case GameflowPhase::READY_CHECK:
+        return to == GameflowPhase::CHAMPION_SELECT || to == GameflowPhase::MATCHMAKING ||
+               to == GameflowPhase::LOBBY;
+    case GameflowPhase::CHAMPION_SELECT:
+        return to == GameflowPhase::GAME_START || to == GameflowPhase::IN_PROGRESS ||
+               to == GameflowPhase::MATCHMAKING || to == GameflowPhase::LOBBY;
+    case GameflowPhase::GAME_START:
+        return to == GameflowPhase::IN_PROGRESS || to == GameflowPhase::LOBBY;
+    case GameflowPhase::IN_PROGRESS:
+        return to == GameflowPhase::WAITING_FOR_STATS || to == GameflowPhase::PRE_END_OF_GAME ||
+               to == GameflowPhase::END_OF_GAME || to == GameflowPhase::LOBBY;
+    case GameflowPhase::WAITING_FOR_STATS:
+        return to == GameflowPhase::PRE_END_OF_GAME || to == GameflowPhase::END_OF_GAME ||
+               to == GameflowPhase::LOBBY;
+    case GameflowPhase::PRE_END_OF_GAME:
+        return to == GameflowPhase::END_OF_GAME || to == GameflowPhase::LOBBY;
+    case GameflowPhase::END_OF_GAME:
+        return to == GameflowPhase::LOBBY || to == GameflowPhase::MATCHMAKING;
+    default:
+        return false;
+    }
+}
+
+struct PassCounts {
+    long long changes = 0;
+    long long invalid = 0;
+    long long queued = 0;   // Polls in Matchmaking or ReadyCheck
+};
+
+// What a poll cost before: parse by string, compare strings, validate with the switch
+PassCounts RunLegacy(const std::vector<std::string_view>& polls) {
+    PassCounts counts;
+    std::string current;
+    GameflowPhase current_phase = GameflowPhase::NONE;
+    for (std::string_view poll : polls) {
+        GameflowPhase phase = GameflowPhase::NONE;
+        LegacyParse(poll, phase);
+        if (poll != current) {
+            current.assign(poll);
+            counts.changes++;
+            counts.invalid += LegacyIsValidTransition(current_phase, phase) ? 0 : 1;
+            current_phase = phase;
+        }
+        counts.queued += (poll == "Matchmaking" || poll == "ReadyCheck") ? 1 : 0;
+    }
+    return counts;
+}
+
+// The same with phase ids: one hash, integer compares, a table lookup on changes
+PassCounts RunInterned(const std::vector<std::string_view>& polls) {
+    PassCounts counts;
+    GameflowPhase current_phase = GameflowPhase::NONE;
+    bool known = false;
+    for (std::string_view poll : polls) {
+        GameflowPhase phase = models::GameflowPhaseFromWire(poll);
+        if (phase != current_phase || !known) {
+            known = true;
+            counts.changes++;
+            counts.invalid += models::IsValidGameflowTransition(current_phase, phase) ? 0 : 1;
+            current_phase = phase;
+        }
+        counts.queued += (phase == GameflowPhase::MATCHMAKING || phase == GameflowPhase::READY_CHECK) ? 1 : 0;
+    }
+    return counts;
+}
+
+template <typename Pass>
+double TimePasses(const Pass& pass, const std::vector<std::string_view>& polls, int rounds, PassCounts& counts) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; ++i) {
+        counts = pass(polls);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (static_cast<double>(polls.size()) * rounds);
+}
+
+int CheckParsing() {
+    int failures = 0;
+    for (size_t i = 0; i + 1 < models::GAMEFLOW_PHASE_COUNT; ++i) {
+        GameflowPhase phase = static_cast<GameflowPhase>(i);
+        if (models::GameflowPhaseFromWire(models::GameflowPhaseName(phase)) != phase) {
+            std::fprintf(stderr, "%s does not map back to its phase\n",
+                         std::string(models::GameflowPhaseName(phase)).c_str());
+            failures++;
+        }
+    }
+
+    const char* legacy_names[] = {"None", "Lobby", "Matchmaking", "ReadyCheck", "ChampSelect", "GameStart",
+                                  "InProgress", "InGame", "WaitingForStats", "PreEndOfGame", "EndOfGame"};
+    for (const char* name : legacy_names) {
+        GameflowPhase legacy = GameflowPhase::UNKNOWN;
+        LegacyParse(name, legacy);
+        if (models::GameflowPhaseFromWire(name) != legacy) {
+            std::fprintf(stderr, "parsers disagree on %s\n", name);
+            failures++;
+        }
+    }
+
+    const char* not_phases[] = {"", "Unknown", "readycheck", "ReadyChecks", "Lobb", "InGamf", "N", "\"Lobby\""};
+    for (const char* name : not_phases) {
+        if (models::GameflowPhaseFromWire(name) != GameflowPhase::UNKNOWN) {
+            std::fprintf(stderr, "\"%s\" parsed as a phase\n", name);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int CheckTransitions() {
+    int failures = 0;
+    for (GameflowPhase from : LEGACY_PHASES) {
+        for (GameflowPhase to : LEGACY_PHASES) {
+            if (models::IsValidGameflowTransition(from, to) != LegacyIsValidTransition(from, to)) {
+                std::fprintf(stderr, "transition %s -> %s differs from the switch\n",
+                             std::string(models::GameflowPhaseName(from)).c_str(),
+                             std::string(models::GameflowPhaseName(to)).c_str());
+                failures++;
+            }
+        }
+    }
+    return failures;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int games = bench::ParseIntArg(argc, argv, "--games", 5);
+    int rounds = bench::ParseIntArg(argc, argv, "--rounds", 50);
+
+    int failures = CheckParsing() + CheckTransitions();
+
+    std::vector<std::string_view> polls;
+    for (int game = 0; game < games; ++game) {
+        for (const PhaseSpan& span : GAME_CYCLE) {
+            polls.insert(polls.end(), span.polls, span.phase);
+        }
+    }
+
+    PassCounts legacy;
+    PassCounts interned;
+    double legacy_ns = TimePasses(RunLegacy, polls, rounds, legacy);
+    double interned_ns = TimePasses(RunInterned, polls, rounds, interned);
+
+    // Observers through GameflowState, which also stamps every poll
+    long long notified = 0;
+    models::GameflowState state;
+    state.AddTransitionObserver([&notified](GameflowPhase, GameflowPhase) { notified++; });
+    long long changed = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::string_view poll : polls) {
+        changed += state.ApplyObservedPhase(models::GameflowPhaseFromWire(poll)) ? 1 : 0;
+    }
+    std::chrono::duration<double, std::nano> state_elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf("%zu polls over %d games, %d rounds:\n", polls.size(), games, rounds);
+    std::printf("  %-34s %8.1f ns/poll  (%lld changes, %lld invalid)\n", "strings + transition switch",
+                legacy_ns, legacy.changes, legacy.invalid);
+    std::printf("  %-34s %8.1f ns/poll  (%lld changes, %lld invalid)\n", "phase ids + transition table",
+                interned_ns, interned.changes, interned.invalid);
+    std::printf("  %-34s %8.1f ns/poll  (%lld notified)\n", "GameflowState::ApplyObservedPhase",
+                state_elapsed.count() / static_cast<double>(polls.size()), notified);
+
+    if (legacy.changes != interned.changes || legacy.invalid != interned.invalid ||
+        legacy.queued != interned.queued) {
+        std::fprintf(stderr, "phase ids see a different session than the strings\n");
+        failures++;
+    }
+    if (notified != changed || notified != interned.changes) {
+        std::fprintf(stderr, "observers fired %lld times for %lld changes\n", notified, interned.changes);
+        failures++;
+    }
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,232 @@
+// Ready-check detection with the LCU and a simulated screen detector (a
+// fixed-cost capture and match, in slices that check for cancellation)
+// against the local LCU stand-in, which always has a ready check up.
+//
+// Serial is the old hybrid: the LCU first, the screen only after the LCU
+// came back without one. The HybridDetector reads a healthy LCU alone, lets
+// the screen look when a read fails, and races both once reads keep failing
+// or turn slow, first find wins. As in LCUClient, the LCU lane reads through
+// a request pool and the detection thread keeps its own session.
+//
+// The last scenario has only the ready-check read slow: the screen wins
+// while that read is still in flight and the detection thread accepts at
+// once, which must not wait for the lane's read.
+// Exits 1 if the screen detector runs while the LCU is healthy, a race is
+// not faster than serial for a slow LCU, a ready check is missed, the
+// winner is not what GameflowState records, or an accept after a screen win
+// fails or waits for the read in flight.
+//
+//   bench_hybrid_detection [--rounds N] [--vision-ms MS] [--slow-ms MS]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/hybrid_detector.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_request_pool.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"playerResponse":"None","state":"InProgress","timer":2.0})";
+// Between detection passes, as the loop's interval would
+constexpr std::chrono::milliseconds PASS_INTERVAL{50};
+
+core::DetectorVerdict ReadyCheckVerdict(const core::HttpResponse& response) {
+    if (!response.IsSuccess()) {
+        return core::DetectorVerdict::FAILED;
+    }
+    return response.body.find("\"InProgress\"") != std::string::npos ? core::DetectorVerdict::FOUND
+                                                                      : core::DetectorVerdict::NOT_FOUND;
+}
+
+struct Detectors {
+    core::LCUSession& session;      // The detection thread's
+    core::LCURequestPool& lane;     // The LCU lane's
+    std::chrono::milliseconds vision_cost;
+    std::atomic<int> vision_runs{0};
+
+    core::DetectorVerdict Lcu() {
+        return ReadyCheckVerdict(session.Get(core::READY_CHECK_URI));
+    }
+
+    core::DetectorVerdict LcuLane() {
+        core::AsyncRequestResult result = lane.Submit(core::HttpMethod::GET, core::READY_CHECK_URI).Get();
+        if (result.status != core::AsyncRequestStatus::COMPLETED) {
+            return core::DetectorVerdict::FAILED;
+        }
+        return ReadyCheckVerdict(result.response);
+    }
+
+    core::DetectorVerdict Vision(const std::atomic<bool>& cancelled) {
+        vision_runs++;
+        Clock::time_point done = Clock::now() + vision_cost;
+        while (Clock::now() < done) {
+            if (cancelled) {
+                return core::DetectorVerdict::NOT_FOUND;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return core::DetectorVerdict::FOUND;
+    }
+};
+
+struct Scenario {
+    bench::LatencySamples serial;
+    bench::LatencySamples hybrid;
+    core::HybridDetector::Stats stats;
+    int serial_vision_runs = 0;
+    int hybrid_vision_runs = 0;
+    bench::LatencySamples accepts;   // After a screen win, with the LCU read in flight
+    int missed = 0;
+    int misrecorded = 0;
+    int failed_accepts = 0;
+};
+
+// `accept_after_screen`: accept on the detection thread's session as soon as
+// the screen wins a race
+Scenario Run(tools::LCUMockServer& server, const tools::MockFaults& faults, std::chrono::milliseconds vision_cost,
+             int rounds, bool accept_after_screen = false) {
+    Scenario scenario;
+    server.SetFaults(faults);
+
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials(credentials);
+    core::RequestPoolConfig lane_config;
+    lane_config.workers = 1;
+    core::LCURequestPool lane(lane_config);
+    lane.UpdateCredentials(credentials);
+    Detectors detectors{session, lane, vision_cost};
+    const std::atomic<bool> never{false};
+
+    for (int round = 0; round < rounds; ++round) {
+        Clock::time_point start = Clock::now();
+        bool found = detectors.Lcu() == core::DetectorVerdict::FOUND ||
+                     detectors.Vision(never) == core::DetectorVerdict::FOUND;
+        scenario.serial.Add(Clock::now() - start);
+        scenario.missed += found ? 0 : 1;
+        std::this_thread::sleep_for(PASS_INTERVAL);
+    }
+    scenario.serial_vision_runs = detectors.vision_runs.exchange(0);
+
+    models::GameflowState state;
+    {
+        // Lanes are joined before the session goes; a slow read still ends
+        core::HybridDetector detector(
+            [&detectors](const std::atomic<bool>&) { return detectors.LcuLane(); },
+            [&detectors](const std::atomic<bool>& cancelled) { return detectors.Vision(cancelled); });
+
+        for (int round = 0; round < rounds; ++round) {
+            core::HybridDetection detection = detector.Detect(true);
+            if (!detection.found) {
+                scenario.missed++;
+            } else {
+                scenario.hybrid.Add(detection.latency);
+                state.SetDetectionSource(detection.source, detection.latency);
+                scenario.misrecorded += state.GetDetectionSource() != detection.source ||
+                                        state.GetDetectionLatency() != detection.latency;
+            }
+            if (accept_after_screen && detection.found &&
+                detection.source == models::DetectionSource::UI_AUTOMATION) {
+                Clock::time_point accept_start = Clock::now();
+                core::HttpResponse response =
+                    session.Post(core::GetLCUEndpoint(core::LCUEndpointId::ACCEPT_MATCHMAKING).path);
+                scenario.accepts.Add(Clock::now() - accept_start);
+                scenario.failed_accepts += response.status_code == 204 ? 0 : 1;
+            }
+            std::this_thread::sleep_for(PASS_INTERVAL);
+        }
+        scenario.stats = detector.GetStats();
+    }
+    scenario.hybrid_vision_runs = detectors.vision_runs.load();
+    return scenario;
+}
+
+void Print(const char* label, const Scenario& scenario) {
+    std::printf("%s\n", label);
+    scenario.serial.Print("    serial, LCU then screen");
+    scenario.hybrid.Print("    hybrid race");
+    std::printf("    screen runs: serial %d, hybrid %d; races %llu, LCU wins %llu, screen wins %llu, "
+                "cancelled %llu, busy skips %llu, missed %d\n",
+                scenario.serial_vision_runs, scenario.hybrid_vision_runs,
+                static_cast<unsigned long long>(scenario.stats.races),
+                static_cast<unsigned long long>(scenario.stats.lcu_wins),
+                static_cast<unsigned long long>(scenario.stats.vision_wins),
+                static_cast<unsigned long long>(scenario.stats.cancelled),
+                static_cast<unsigned long long>(scenario.stats.busy_skips), scenario.missed);
+    if (scenario.accepts.Count() > 0) {
+        scenario.accepts.Print("    accept after a screen win");
+        std::printf("    failed accepts %d\n", scenario.failed_accepts);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int rounds = bench::ParseIntArg(argc, argv, "--rounds", 20);
+    std::chrono::milliseconds vision_cost(bench::ParseIntArg(argc, argv, "--vision-ms", 40));
+    std::chrono::milliseconds slow(bench::ParseIntArg(argc, argv, "--slow-ms", 300));
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    tools::MockFaults healthy;
+    tools::MockFaults slow_lcu;
+    slow_lcu.latency = slow;
+    tools::MockFaults failing_lcu;
+    failing_lcu.error_rate = 1.0;
+
+    Scenario fast = Run(server, healthy, vision_cost, rounds);
+    Scenario slowed = Run(server, slow_lcu, vision_cost, rounds);
+    Scenario failing = Run(server, failing_lcu, vision_cost, rounds);
+
+    // Only the ready-check read is slow, so an accept that waits on it shows
+    server.SetResponse("POST", core::GetLCUEndpoint(core::LCUEndpointId::ACCEPT_MATCHMAKING).path, {204, ""});
+    server.SetRequestObserver([slow](const std::string& method, const std::string& path) {
+        if (method == "GET" && path == core::READY_CHECK_URI) {
+            std::this_thread::sleep_for(slow);
+        }
+    });
+    Scenario accepting = Run(server, healthy, vision_cost, rounds, true);
+    server.SetRequestObserver(nullptr);
+    server.Stop();
+
+    std::printf("ready check up throughout, screen detection %lldms, %d passes each:\n",
+                static_cast<long long>(vision_cost.count()), rounds);
+    Print("  healthy LCU", fast);
+    Print("  slow LCU", slowed);
+    Print("  LCU failing every read", failing);
+    Print("  slow ready-check read, accept after a screen win", accepting);
+
+    // An accept queued behind the lane's read would take most of a slow read
+    double slow_micros = std::chrono::duration<double, std::micro>(slow).count();
+    bool ok = fast.hybrid_vision_runs == 0 &&
+              slowed.hybrid.PercentileMicros(50) < slowed.serial.PercentileMicros(50) &&
+              slowed.stats.vision_wins > 0 && accepting.accepts.Count() > 0 && accepting.failed_accepts == 0 &&
+              accepting.accepts.PercentileMicros(100) < slow_micros / 2;
+    for (const Scenario* scenario : {&fast, &slowed, &failing, &accepting}) {
+        ok = ok && scenario->missed == 0 && scenario->misrecorded == 0;
+    }
+    if (!ok) {
+        std::fprintf(stderr, "hybrid detection ran the screen needlessly, was not faster, missed a ready check, "
+                             "or an accept after a screen win failed or waited\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// Cost of recording into the latency histograms behind PerformanceMetrics,
+// with one and several recording threads, and how far their percentiles are
+// from the exact ones over the same samples. Also checks the rolling window
+// and merging. Exits 1 if a percentile is off by more than a bucket's width.
+//
+//   bench_latency_histogram [--samples N] [--threads N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/latency_histogram.h"
+#include "league_auto_accept/models/performance_metrics.h"
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+// Accept latencies: mostly a few milliseconds, with a long tail
+std::vector<uint64_t> MakeSamples(size_t count) {
+    std::mt19937_64 random(42);
+    std::lognormal_distribution<double> body(std::log(3000.0), 0.5);
+    std::uniform_real_distribution<double> tail(50000.0, 400000.0);
+    std::uniform_int_distribution<int> roll(0, 999);
+
+    std::vector<uint64_t> samples(count);
+    for (uint64_t& sample : samples) {
+        sample = roll(random) < 5 ? static_cast<uint64_t>(tail(random)) : static_cast<uint64_t>(body(random));
+    }
+    return samples;
+}
+
+uint64_t ExactPercentile(std::vector<uint64_t> sorted, double percentile) {
+    size_t rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+double NanosPerRecord(std::chrono::nanoseconds elapsed, size_t records) {
+    return static_cast<double>(elapsed.count()) / static_cast<double>(records);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t sample_count = static_cast<size_t>(bench::ParseIntArg(argc, argv, "--samples", 1000000));
+    int thread_count = bench::ParseIntArg(argc, argv, "--threads", 4);
+
+    std::vector<uint64_t> samples = MakeSamples(sample_count);
+    bool ok = true;
+
+    // Recording cost
+    core::LatencyHistogram histogram;
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t sample : samples) {
+        histogram.RecordValue(sample);
+    }
+    double single_ns = NanosPerRecord(std::chrono::steady_clock::now() - start, samples.size());
+
+    core::LatencyHistogram shared;
+    std::vector<std::thread> threads;
+    start = std::chrono::steady_clock::now();
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&shared, &samples, t, thread_count]() {
+            for (size_t i = static_cast<size_t>(t); i < samples.size(); i += static_cast<size_t>(thread_count)) {
+                shared.RecordValue(samples[i]);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    double shared_ns = NanosPerRecord(std::chrono::steady_clock::now() - start, samples.size());
+
+    std::printf("%zu samples, %zu buckets (%zu bytes per histogram)\n\n", samples.size(),
+                core::LatencyHistogram::BUCKET_COUNT, sizeof(core::LatencyHistogram));
+    std::printf("record, 1 thread                  %.1f ns/sample\n", single_ns);
+    std::printf("record, %d threads shared          %.1f ns/sample\n", thread_count, shared_ns);
+
+    core::LatencyHistogram::Snapshot snapshot = histogram.TakeSnapshot();
+    core::LatencyHistogram::Snapshot shared_snapshot = shared.TakeSnapshot();
+    ok = ok && snapshot.GetCount() == samples.size() && shared_snapshot.GetCount() == samples.size();
+    for (size_t i = 0; i < core::LatencyHistogram::BUCKET_COUNT; ++i) {
+        ok = ok && snapshot.GetBucketCount(i) == shared_snapshot.GetBucketCount(i);
+    }
+
+    // Accuracy against the exact distribution
+    std::vector<uint64_t> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    std::printf("\n%-8s %12s %12s %8s\n", "", "exact", "histogram", "error");
+    for (double percentile : {50.0, 90.0, 99.0, 99.9, 100.0}) {
+        uint64_t exact = ExactPercentile(sorted, percentile);
+        auto estimate = static_cast<uint64_t>(snapshot.GetPercentile(percentile).count());
+        double error = (static_cast<double>(estimate) - static_cast<double>(exact)) / static_cast<double>(exact);
+        std::printf("p%-7g %10lluus %10lluus %7.2f%%\n", percentile, static_cast<unsigned long long>(exact),
+                    static_cast<unsigned long long>(estimate), error * 100.0);
+        ok = ok && estimate >= exact && error <= 1.0 / core::LatencyHistogram::SUB_BUCKET_COUNT;
+    }
+
+    // Rolling window: old slots drop out, recent ones stay
+    core::RollingLatencyHistogram rolling;
+    auto base = std::chrono::steady_clock::time_point(std::chrono::hours(1000));
+    for (int minute = 0; minute < 20; ++minute) {
+        rolling.Record(std::chrono::microseconds(minute < 10 ? 100000 : 1000), base + std::chrono::minutes(minute));
+    }
+    auto now = base + std::chrono::minutes(19);
+    core::LatencyHistogram::Snapshot recent = rolling.TakeSnapshot(std::chrono::minutes(5), now);
+    core::LatencyHistogram::Snapshot widest = rolling.TakeSnapshot(std::chrono::minutes(60), now);
+    std::printf("\nrolling: last 5 min n=%llu p99=%lldus, widest n=%llu\n",
+                static_cast<unsigned long long>(recent.GetCount()), static_cast<long long>(recent.GetP99().count()),
+                static_cast<unsigned long long>(widest.GetCount()));
+    ok = ok && recent.GetCount() == 6 && recent.GetP99().count() == 1000 &&
+         widest.GetCount() == core::RollingLatencyHistogram::SLOT_COUNT;
+
+    // Targets follow the percentile, not the last sample
+    models::PerformanceMetrics metrics;
+    for (int i = 0; i < 98; ++i) {
+        metrics.RecordAcceptanceLatency(std::chrono::milliseconds(20));
+    }
+    metrics.RecordAcceptanceLatency(std::chrono::milliseconds(900));
+    metrics.RecordAcceptanceLatency(std::chrono::milliseconds(900));
+    metrics.RecordAcceptanceLatency(std::chrono::milliseconds(20));
+    bool tail_fails = !metrics.MeetsAcceptanceTarget();
+
+    models::PerformanceMetrics merged;
+    merged.MergeLatencyStats(metrics);
+    merged.MergeLatencyStats(metrics);
+    bool merge_ok = merged.GetAcceptanceCount() == 2 * metrics.GetAcceptanceCount() &&
+                    merged.GetAcceptanceLatencyPercentile(99.0) == metrics.GetAcceptanceLatencyPercentile(99.0);
+    std::printf("acceptance p99 with 2%% at 900ms: %lldus, target met: %s; merge: %s\n",
+                static_cast<long long>(metrics.GetAcceptanceLatencyPercentile(99.0).count()),
+                tail_fails ? "no" : "yes", merge_ok ? "ok" : "wrong");
+    ok = ok && tail_fails && merge_ok;
+
+    if (!ok) {
+        std::fprintf(stderr, "latency histogram returned wrong results\n");
+        return 1;
+    }
+    return 0;
+}
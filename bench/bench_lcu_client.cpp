@@ -0,0 +1,194 @@
+// The Application's LCUClient against the LCU stand-in: it finds the
+// stand-in through its lockfile ($LAA_LOCKFILE), then the hybrid
+// detector's LCU lane reads the ready check on a thread of its own while
+// the detection thread accepts it, as after a screen win. The lane reads
+// through the request pool and the accepts through the client's session,
+// so neither waits on or corrupts the other.
+//
+// A pushed ready check's timer must bound the accept: pushed with 50ms
+// left, an accept started after that sends nothing.
+//
+// Then the ready check starts answering 503: the retries of one call open
+// its breaker, and the call must stop there instead of retrying into it.
+// Later calls are turned away without a request.
+// Exits 1 if the client does not connect, an accept fails, the lane
+// misses the ready check, an accept goes out past the pushed timer, or a retry is made or counted as refused once
+// the breaker is open.
+//
+//   bench_lcu_client [--accepts N]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/lcu_client.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"None","state":"InProgress","suppressUx":false,"timer":1.0})";
+
+struct LaneResult {
+    bench::LatencySamples accepts;
+    int accept_failures = 0;
+    int reads = 0;
+    int reads_found = 0;
+};
+
+LaneResult RunLaneAndAccepts(LCUClient& client, int accepts) {
+    LaneResult result;
+    std::atomic<bool> stop{false};
+    std::atomic<int> reads{0};
+    std::atomic<int> found{0};
+    std::thread lane([&]() {
+        while (!stop.load()) {
+            core::DetectorVerdict verdict = client.DetectReadyCheck();
+            reads++;
+            found += verdict == core::DetectorVerdict::FOUND ? 1 : 0;
+        }
+    });
+
+    for (int i = 0; i < accepts; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        core::AcceptResult accept = client.AcceptCurrentReadyCheck(start);
+        result.accepts.Add(std::chrono::steady_clock::now() - start);
+        result.accept_failures += accept.accepted ? 0 : 1;
+    }
+    stop = true;
+    lane.join();
+
+    result.reads = reads.load();
+    result.reads_found = found.load();
+    return result;
+}
+
+// The ready check is pushed with `left` to go; the accept starts once it is gone
+bool CheckPushedTimer(tools::LCUMockServer& server, LCUClient& client, std::chrono::milliseconds left) {
+    std::atomic<int> posts{0};
+    server.SetRequestObserver([&posts](const std::string& method, const std::string&) {
+        posts += method == "POST" ? 1 : 0;
+    });
+
+    auto pushed_at = std::chrono::steady_clock::now();
+    double timer = core::ReadyCheckView::DURATION_SECONDS - std::chrono::duration<double>(left).count();
+    client.UpdateReadyCheckTimer(timer, pushed_at);
+    auto deadline = client.GetReadyCheckDeadline(pushed_at);
+    std::this_thread::sleep_for(left + std::chrono::milliseconds(10));
+    core::AcceptResult accept = client.AcceptCurrentReadyCheck(pushed_at);
+    server.SetRequestObserver(nullptr);
+
+    auto error = std::chrono::abs(deadline - (pushed_at + left));
+    std::printf("\nReady check pushed with %lldms left, accepted %lldms later: %s, %d POSTs\n",
+                static_cast<long long>(left.count()), static_cast<long long>(left.count() + 10),
+                accept.accepted ? "accepted" : (accept.deadline_reached ? "deadline reached" : "failed"),
+                posts.load());
+    return error < std::chrono::milliseconds(1) && !accept.accepted && accept.deadline_reached && posts.load() == 0;
+}
+
+struct BreakerResult {
+    int calls = 0;
+    int requests = 0;           // Reaching the stand-in
+    uint64_t attempts = 0;      // Made by the retry policy
+    uint64_t refused = 0;       // Counted by the breaker
+    int refused_answers = 0;    // Calls answered as kept back by the breaker
+};
+
+BreakerResult RunOpeningBreaker(tools::LCUMockServer& server, LCUClient& client, int calls) {
+    core::RetryPolicyConfig retry;
+    retry.max_attempts = 6;
+    retry.initial_backoff = std::chrono::milliseconds(1);
+    retry.max_backoff = std::chrono::milliseconds(2);
+    client.SetRetryPolicy(retry);
+
+    std::atomic<int> requests{0};
+    server.SetRequestObserver([&requests](const std::string& method, const std::string& path) {
+        if (method == "GET" && path == LCUClient::READY_CHECK_ENDPOINT) {
+            requests++;
+        }
+    });
+    server.SetResponse("GET", LCUClient::READY_CHECK_ENDPOINT,
+                       {503, R"({"errorCode":"RPC_ERROR","httpStatus":503,"message":"Service Unavailable"})"});
+
+    BreakerResult result;
+    uint64_t refused_before = client.GetHealth().GetHealth(core::LCUEndpointId::READY_CHECK).refused;
+    for (int i = 0; i < calls; ++i) {
+        LCUResponse response = client.GetReadyCheckStatus();
+        result.refused_answers += response.error_message.find("next probe") != std::string::npos ? 1 : 0;
+    }
+    server.SetRequestObserver(nullptr);
+
+    result.calls = calls;
+    result.requests = requests.load();
+    result.attempts = client.GetRetryStats().attempts;
+    result.refused = client.GetHealth().GetHealth(core::LCUEndpointId::READY_CHECK).refused - refused_before;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int accepts = bench::ParseIntArg(argc, argv, "--accepts", 300);
+
+    tools::LCUMockServer server;
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+    server.SetResponse("GET", LCUClient::GAMEFLOW_ENDPOINT, {200, "\"ReadyCheck\""});
+    server.SetResponse("GET", LCUClient::READY_CHECK_ENDPOINT, {200, READY_CHECK_PENDING});
+    server.SetResponse("POST", LCUClient::READY_CHECK_ACCEPT_ENDPOINT, {204, ""});
+
+    std::filesystem::path lockfile_dir = std::filesystem::temp_directory_path() /
+                                         ("laa_client_bench_" + std::to_string(server.GetPort()));
+    std::filesystem::create_directories(lockfile_dir);
+    std::string lockfile_path = (lockfile_dir / "lockfile").string();
+    if (!server.WriteLockfile(lockfile_path)) {
+        std::fprintf(stderr, "Failed to write lockfile %s\n", lockfile_path.c_str());
+        return 1;
+    }
+    ::setenv("LAA_LOCKFILE", lockfile_path.c_str(), 1);
+
+    bool ok = true;
+    {
+        LCUClient client;
+        if (!client.Connect()) {
+            std::fprintf(stderr, "LCUClient did not connect to the stand-in on port %d\n", server.GetPort());
+            ok = false;
+        } else {
+            std::printf("LCUClient connected to 127.0.0.1:%d, phase %s\n\n", client.GetConnectionInfo().GetPort(),
+                        std::string(models::GameflowPhaseName(client.GetCurrentGameflowPhase())).c_str());
+
+            LaneResult lane = RunLaneAndAccepts(client, accepts);
+            std::printf("Accepts while the LCU lane reads the ready check:\n");
+            lane.accepts.Print("  accept");
+            std::printf("  %d of %d accepted, lane read %d times, found it %d times\n", accepts - lane.accept_failures,
+                        accepts, lane.reads, lane.reads_found);
+            ok = lane.accept_failures == 0 && lane.reads > 0 && lane.reads_found == lane.reads;
+
+            ok = CheckPushedTimer(server, client, std::chrono::milliseconds(50)) && ok;
+
+            // Default breaker: three failures in a row open it, the first probe 2s later
+            const int calls = 6;
+            const int open_after = core::LCUHealthConfig().open_after_failures;
+            BreakerResult breaker = RunOpeningBreaker(server, client, calls);
+            std::printf("\nReady check answering 503, %d calls of up to 6 attempts:\n", calls);
+            std::printf("  %d requests sent, %llu attempts, %llu refused by the breaker, %d answered as refused\n",
+                        breaker.requests, static_cast<unsigned long long>(breaker.attempts),
+                        static_cast<unsigned long long>(breaker.refused), breaker.refused_answers);
+            ok = ok && breaker.requests == open_after && breaker.attempts == static_cast<uint64_t>(open_after) &&
+                 breaker.refused == static_cast<uint64_t>(calls - 1) && breaker.refused_answers == calls;
+        }
+    }
+
+    std::filesystem::remove_all(lockfile_dir);
+    server.Stop();
+    return ok ? 0 : 1;
+}
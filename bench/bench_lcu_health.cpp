@@ -0,0 +1,216 @@
+// Polling a client that stops answering for a while: the old loop, which
+// sent every poll and logged every failure, versus polls through the
+// LCUHealthMonitor's circuit breaker, which waits for the next probe once it
+// opens. Requests are real, against the LCU stand-in answering 503 while
+// "down"; time between polls is simulated, so a minute runs in moments.
+// Exits 1 if the breaker loop sends more than a tenth of the old loop's
+// requests while the client is down, logs more than its state changes,
+// takes longer than the probe cap to notice the client is back, reports
+// a score that does not match the breaker, a probe that never reports
+// back keeps the breaker half-open past the probe interval, or a request
+// releases a probe it does not hold.
+//
+//   bench_lcu_health [--seconds N] [--down-from S] [--down-for S] [--interval-ms MS]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_health.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+
+using namespace league_auto_accept;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Timeline {
+    std::chrono::milliseconds length;
+    std::chrono::milliseconds down_from;
+    std::chrono::milliseconds down_until;
+    std::chrono::milliseconds interval;
+};
+
+struct Loop {
+    int wakeups = 0;
+    int requests = 0;
+    int down_wakeups = 0;
+    int down_requests = 0;
+    int log_lines = 0;
+    // From the client coming back to the first answered poll
+    std::chrono::milliseconds recovery{-1};
+    bool score_matched = true;
+};
+
+// Puts the stand-in up or down to match the simulated time
+void Follow(tools::LCUMockServer& server, const Timeline& timeline, std::chrono::milliseconds at, bool& down) {
+    bool should_be_down = at >= timeline.down_from && at < timeline.down_until;
+    if (should_be_down != down) {
+        tools::MockFaults faults;
+        faults.error_rate = should_be_down ? 1.0 : 0.0;
+        faults.error_status = 503;
+        server.SetFaults(faults);
+        down = should_be_down;
+    }
+}
+
+// Every poll goes out and every failure is logged
+Loop RunNaive(tools::LCUMockServer& server, core::LCUSession& session, const Timeline& timeline) {
+    Loop loop;
+    bool down = false;
+    for (std::chrono::milliseconds at(0); at < timeline.length; at += timeline.interval) {
+        Follow(server, timeline, at, down);
+        loop.wakeups++;
+        loop.requests++;
+        loop.down_wakeups += down ? 1 : 0;
+        loop.down_requests += down ? 1 : 0;
+
+        bool ok = session.Get(core::GAMEFLOW_PHASE_URI).IsSuccess();
+        loop.log_lines += ok ? 0 : 1;
+        if (ok && at >= timeline.down_until && loop.recovery.count() < 0) {
+            loop.recovery = at - timeline.down_until;
+        }
+    }
+    return loop;
+}
+
+// As the engine polls: through the breaker, sleeping until the next probe
+// while it is open, logging its changes only
+Loop RunBreaker(tools::LCUMockServer& server, core::LCUSession& session, const Timeline& timeline) {
+    Loop loop;
+    bool down = false;
+    core::LCUHealthMonitor health;
+    const core::LCUEndpointId endpoint = core::LCUEndpointId::GAMEFLOW_PHASE;
+    Clock::time_point start = Clock::now();
+
+    std::chrono::milliseconds at(0);
+    while (at < timeline.length) {
+        Follow(server, timeline, at, down);
+        Clock::time_point now = start + at;
+        loop.wakeups++;
+        loop.down_wakeups += down ? 1 : 0;
+
+        core::BreakerState before = health.GetState(endpoint);
+        if (health.AllowRequest(endpoint, now)) {
+            loop.requests++;
+            loop.down_requests += down ? 1 : 0;
+            core::HttpResponse response = session.Get(core::GAMEFLOW_PHASE_URI);
+            core::BreakerState after = health.RecordResponse(endpoint, response, response.latency, now);
+            loop.log_lines += after != before;
+
+            if (response.IsSuccess() && at >= timeline.down_until && loop.recovery.count() < 0) {
+                loop.recovery = at - timeline.down_until;
+            }
+        }
+
+        core::EndpointHealth state = health.GetHealth(endpoint);
+        if ((state.state == core::BreakerState::OPEN) != (state.score == 0.0)) {
+            loop.score_matched = false;
+        }
+
+        auto until_probe = std::chrono::ceil<std::chrono::milliseconds>(health.GetTimeUntilProbe(endpoint, now));
+        at += std::max(timeline.interval, until_probe);
+    }
+
+    core::EndpointHealth end = health.GetHealth(endpoint);
+    std::printf("  breaker at the end: %s, success rate %.2f, latency %lldus, score %.2f, opened %llu\n",
+                core::BreakerStateToString(end.state), end.success_rate,
+                static_cast<long long>(end.latency.count()), end.score,
+                static_cast<unsigned long long>(end.opened));
+    loop.score_matched = loop.score_matched && end.state == core::BreakerState::CLOSED && end.score > 0.9;
+    return loop;
+}
+
+// Probes let through but never recorded: one released as unsent, one lost.
+// Either way the next probe must go out, and its answer close the breaker.
+// A late release from a probe already given up, or from a request let
+// through while closed, must leave the probe that took over alone.
+bool CheckLostProbes() {
+    core::LCUHealthConfig config;
+    core::LCUHealthMonitor health(config);
+    const core::LCUEndpointId endpoint = core::LCUEndpointId::READY_CHECK;
+    Clock::time_point now = Clock::now();
+    uint64_t not_probe = 1;
+    bool closed_no_probe = health.AllowRequest(endpoint, now, &not_probe) && not_probe == 0;
+    for (int i = 0; i < config.open_after_failures; ++i) {
+        health.RecordResult(endpoint, false, std::chrono::milliseconds(1), now);
+    }
+
+    now += config.probe_interval;
+    uint64_t probe = 0;
+    bool released = health.AllowRequest(endpoint, now, &probe) && probe != 0;
+    health.ReleaseProbe(endpoint, probe, now);
+    released = released && health.AllowRequest(endpoint, now, &probe) && probe != 0;
+
+    // That probe is lost: refused while it may still report, given up after
+    uint64_t lost_probe = probe;
+    bool lost = !health.AllowRequest(endpoint, now + config.probe_interval / 2) &&
+                health.AllowRequest(endpoint, now + config.probe_interval, &probe) && probe != lost_probe;
+    now += config.probe_interval;
+    health.ReleaseProbe(endpoint, lost_probe, now);
+    health.ReleaseProbe(endpoint, not_probe, now);
+    bool kept = health.GetState(endpoint) == core::BreakerState::HALF_OPEN && !health.AllowRequest(endpoint, now);
+    bool closed = health.RecordResult(endpoint, true, std::chrono::milliseconds(1), now) ==
+                  core::BreakerState::CLOSED;
+
+    std::printf("  unsent probe released: %s; lost probe given up: %s; late releases ignored: %s; "
+                "breaker closed after: %s\n",
+                released ? "yes" : "no", lost ? "yes" : "no", kept ? "yes" : "no", closed ? "yes" : "no");
+    return closed_no_probe && released && lost && kept && closed;
+}
+
+void Print(const char* label, const Loop& loop) {
+    std::printf("%-24s %4d wake-ups, %4d requests; while down %4d wake-ups, %4d requests; "
+                "%3d log lines, back after %lldms\n",
+                label, loop.wakeups, loop.requests, loop.down_wakeups, loop.down_requests, loop.log_lines,
+                static_cast<long long>(loop.recovery.count()));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    Timeline timeline;
+    timeline.length = std::chrono::seconds(bench::ParseIntArg(argc, argv, "--seconds", 60));
+    timeline.down_from = std::chrono::seconds(bench::ParseIntArg(argc, argv, "--down-from", 5));
+    timeline.down_until = timeline.down_from + std::chrono::seconds(bench::ParseIntArg(argc, argv, "--down-for", 30));
+    timeline.interval = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--interval-ms", 250));
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"Matchmaking\""});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials({server.GetPort(), server.GetAuthToken()});
+
+    std::printf("%llds of polls every %lldms, client answering 503 from %llds to %llds:\n",
+                static_cast<long long>(timeline.length.count() / 1000),
+                static_cast<long long>(timeline.interval.count()),
+                static_cast<long long>(timeline.down_from.count() / 1000),
+                static_cast<long long>(timeline.down_until.count() / 1000));
+    Loop naive = RunNaive(server, session, timeline);
+    server.SetFaults(tools::MockFaults());
+    Loop breaker = RunBreaker(server, session, timeline);
+    server.Stop();
+
+    Print("  every poll sent", naive);
+    Print("  circuit breaker", breaker);
+    bool probes_recovered = CheckLostProbes();
+
+    core::LCUHealthConfig defaults;
+    if (breaker.down_requests * 10 > naive.down_requests || breaker.log_lines > 4 || breaker.recovery.count() < 0 ||
+        breaker.recovery > defaults.max_probe_interval + timeline.interval || !breaker.score_matched ||
+        !probes_recovered) {
+        std::fprintf(stderr, "breaker kept polling, logged, recovered late, misreported health "
+                             "or stayed half-open\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,121 @@
+// Lockfile discovery per detection pass: reading every candidate path each
+// time (FindLockfile) versus the cached LockfileWatcher. Also measures how
+// quickly the watcher notices a rewritten, deleted and recreated lockfile.
+// Exits 1 if the watcher reads files in steady state or misses a change.
+//
+//   bench_lockfile_discovery [--iterations N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/lockfile_watcher.h"
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr std::chrono::milliseconds CHANGE_TIMEOUT{2000};
+
+void WriteLockfile(const std::string& path, int port) {
+    std::ofstream file(path, std::ios::trunc);
+    file << "LeagueClient:4242:" << port << ":bench-token:https";
+}
+
+// Time until the watcher reports `expected_port` (0: no lockfile)
+bool WaitForPort(core::LockfileWatcher& watcher, int expected_port, std::chrono::nanoseconds& elapsed) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < CHANGE_TIMEOUT) {
+        core::LockfileInfo info;
+        bool found = watcher.GetLockfile(info);
+        if ((expected_port == 0 && !found) || (found && info.port == expected_port)) {
+            elapsed = std::chrono::steady_clock::now() - start;
+            return true;
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+    int iterations = bench::ParseIntArg(argc, argv, "--iterations", 20000);
+
+    // Six candidates like the Windows list; the lockfile is the last one
+    std::filesystem::path root = std::filesystem::temp_directory_path() /
+                                 ("laa_lockfile_bench_" + std::to_string(std::rand()));
+    std::vector<std::string> paths;
+    for (int i = 0; i < 6; ++i) {
+        std::filesystem::path directory = root / ("install" + std::to_string(i));
+        std::filesystem::create_directories(directory);
+        paths.push_back((directory / "lockfile").string());
+    }
+    WriteLockfile(paths.back(), 50001);
+
+    bench::LatencySamples find_samples;
+    for (int i = 0; i < iterations; ++i) {
+        core::LockfileInfo info;
+        auto start = std::chrono::steady_clock::now();
+        bool found = core::FindLockfile(paths, info);
+        find_samples.Add(std::chrono::steady_clock::now() - start);
+        if (!found) {
+            std::fprintf(stderr, "FindLockfile failed\n");
+            return 1;
+        }
+    }
+
+    core::LockfileWatcher watcher(paths);
+    core::LockfileInfo info;
+    watcher.GetLockfile(info); // First call watches and scans
+
+    int scans_before = watcher.GetScanCount();
+    bench::LatencySamples watcher_samples;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        bool found = watcher.GetLockfile(info);
+        watcher_samples.Add(std::chrono::steady_clock::now() - start);
+        if (!found || info.port != 50001) {
+            std::fprintf(stderr, "LockfileWatcher returned a wrong lockfile\n");
+            return 1;
+        }
+    }
+    int steady_scans = watcher.GetScanCount() - scans_before;
+
+    std::printf("Lockfile discovery per pass (%zu candidates, lockfile in the last):\n", paths.size());
+    find_samples.Print("  FindLockfile every pass");
+    watcher_samples.Print("  LockfileWatcher (cached)");
+    std::printf("  steady-state scans: %d over %d passes, fully watched: %s\n",
+                steady_scans, iterations, watcher.IsFullyWatched() ? "yes" : "no");
+
+    // Client restart: new port, then exit, then a fresh start
+    bool ok = steady_scans == 0;
+    std::chrono::nanoseconds elapsed{};
+    struct Step { const char* label; int port; };
+    const Step steps[] = {{"rewritten", 50002}, {"deleted", 0}, {"recreated", 50003}};
+    std::printf("\nChange detection:\n");
+    for (const Step& step : steps) {
+        if (step.port == 0) {
+            std::filesystem::remove(paths.back());
+        } else {
+            WriteLockfile(paths.back(), step.port);
+        }
+
+        if (WaitForPort(watcher, step.port, elapsed)) {
+            std::printf("  %-10s noticed after %8.1fus\n", step.label, elapsed.count() / 1000.0);
+        } else {
+            std::printf("  %-10s NOT noticed within %lldms\n", step.label,
+                        static_cast<long long>(CHANGE_TIMEOUT.count()));
+            ok = false;
+        }
+    }
+    std::printf("  total scans: %d\n", watcher.GetScanCount());
+
+    watcher.Stop();
+    std::filesystem::remove_all(root);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,175 @@
+// Cost of handing a log line from worker threads to the UI thread: the
+// lock-free LogRing versus a mutex-guarded deque, with a consumer draining in
+// batches meanwhile. Also replays lines into a LogHistory the size of the GUI's
+// log and checks what it keeps. Exits 1 if a line goes missing without being
+// counted as dropped, or arrives out of order.
+//
+//   bench_log_ring [--lines N] [--producers N] [--capacity N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/log_history.h"
+#include "league_auto_accept/core/log_ring.h"
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+// Baseline: every push and every drain takes the same lock
+class LockedLogQueue {
+public:
+    void Push(std::string message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.push_back({std::chrono::system_clock::now(), std::move(message)});
+    }
+
+    size_t Drain(std::vector<core::LogEntry>& entries) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t drained = entries_.size();
+        for (core::LogEntry& entry : entries_) {
+            entries.push_back(std::move(entry));
+        }
+        entries_.clear();
+        return drained;
+    }
+
+private:
+    std::mutex mutex_;
+    std::deque<core::LogEntry> entries_;
+};
+
+struct RunResult {
+    bench::LatencySamples push_latency;   // One sample per 64 pushes
+    size_t received = 0;
+    size_t batches = 0;
+    bool ordered = true;
+};
+
+// "<producer> <sequence> ..." keeps per-producer order checkable
+template <typename Queue, typename PushFunction>
+RunResult Run(Queue& queue, PushFunction push, int producers, int lines_per_producer) {
+    RunResult result;
+    std::atomic<int> producers_done{0};
+    std::vector<std::vector<std::chrono::nanoseconds>> samples(static_cast<size_t>(producers));
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            std::string prefix = std::to_string(p) + " ";
+            for (int i = 0; i < lines_per_producer; ++i) {
+                std::string line = prefix + std::to_string(i) + " Polling every 250ms (Matchmaking)";
+                if (i % 64 == 0) {
+                    auto start = std::chrono::steady_clock::now();
+                    push(queue, std::move(line));
+                    samples[static_cast<size_t>(p)].push_back(std::chrono::steady_clock::now() - start);
+                } else {
+                    push(queue, std::move(line));
+                }
+            }
+            producers_done++;
+        });
+    }
+
+    std::vector<int> next_sequence(static_cast<size_t>(producers), 0);
+    std::vector<core::LogEntry> batch;
+    for (;;) {
+        bool finished = producers_done.load() == producers;
+        batch.clear();
+        if (queue.Drain(batch) > 0) {
+            result.batches++;
+        }
+        for (const core::LogEntry& entry : batch) {
+            size_t space = entry.message.find(' ');
+            size_t producer = std::stoul(entry.message.substr(0, space));
+            int sequence = std::stoi(entry.message.substr(space + 1));
+            // Gaps are lines the ring dropped; going back would be reordering
+            result.ordered = result.ordered && sequence >= next_sequence[producer];
+            next_sequence[producer] = sequence + 1;
+            result.received++;
+        }
+        if (finished && batch.empty()) break;
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (const auto& producer_samples : samples) {
+        for (std::chrono::nanoseconds sample : producer_samples) {
+            result.push_latency.Add(sample);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int lines = bench::ParseIntArg(argc, argv, "--lines", 200000);
+    int producers = bench::ParseIntArg(argc, argv, "--producers", 3);
+    int capacity = bench::ParseIntArg(argc, argv, "--capacity", 1 << 16);
+    int lines_per_producer = lines / producers;
+    size_t expected = static_cast<size_t>(lines_per_producer) * static_cast<size_t>(producers);
+
+    std::printf("%zu lines from %d producers, ring capacity %d\n\n", expected, producers, capacity);
+
+    core::LogRing ring(static_cast<size_t>(capacity));
+    auto start = std::chrono::steady_clock::now();
+    RunResult ring_result = Run(ring, [](core::LogRing& queue, std::string line) { queue.Push(std::move(line)); },
+                                producers, lines_per_producer);
+    double ring_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    LockedLogQueue locked;
+    start = std::chrono::steady_clock::now();
+    RunResult locked_result = Run(locked, [](LockedLogQueue& queue, std::string line) { queue.Push(std::move(line)); },
+                                  producers, lines_per_producer);
+    double locked_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ring_result.push_latency.Print("LogRing push");
+    std::printf("  total %.1fms, %zu received, %llu dropped, %zu batches, order %s\n", ring_ms,
+                ring_result.received, static_cast<unsigned long long>(ring.GetDroppedCount()), ring_result.batches,
+                ring_result.ordered ? "kept" : "BROKEN");
+    locked_result.push_latency.Print("mutex + deque push");
+    std::printf("  total %.1fms, %zu received, %zu batches, order %s\n\n", locked_ms,
+                locked_result.received, locked_result.batches, locked_result.ordered ? "kept" : "BROKEN");
+
+    bool ok = ring_result.ordered && locked_result.ordered &&
+              ring_result.received + ring.GetDroppedCount() == expected && locked_result.received == expected;
+
+    // A full ring drops instead of blocking the producer
+    core::LogRing small(4);
+    int accepted = 0;
+    for (int i = 0; i < 10; ++i) {
+        accepted += small.Push("line") ? 1 : 0;
+    }
+    std::vector<core::LogEntry> drained;
+    small.Drain(drained);
+    ok = ok && accepted == 4 && small.GetDroppedCount() == 6 && drained.size() == 4 && small.Push("again");
+
+    // The GUI's log view: a fixed line budget, evictions reported in characters
+    core::LogHistory history(500);
+    size_t evicted_total = 0;
+    size_t appended_total = 0;
+    for (int i = 0; i < 2000; ++i) {
+        std::string line = "[12:00:00] Game phase: Matchmaking " + std::to_string(i) + "\r\n";
+        appended_total += line.size();
+        evicted_total += history.Append(std::move(line));
+    }
+    bool history_ok = history.GetLineCount() == 500 &&
+                      history.GetTextLength() == appended_total - evicted_total &&
+                      history.GetText().size() == history.GetTextLength() &&
+                      history.GetLine(0).find(" 1500\r\n") != std::string::npos;
+    std::printf("LogHistory(500)  2000 lines appended, %zu kept, %zu chars shown, %s\n", history.GetLineCount(),
+                history.GetTextLength(), history_ok ? "consistent" : "INCONSISTENT");
+    ok = ok && history_ok;
+
+    if (!ok) {
+        std::fprintf(stderr, "log queue returned wrong results\n");
+        return 1;
+    }
+    return 0;
+}
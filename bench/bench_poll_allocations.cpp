@@ -0,0 +1,174 @@
+// Heap allocations of a steady-state poll on a kept-alive connection: paths
+// passed as std::string and the phase copied out, as the loop used to, versus
+// registry endpoints sent from the bytes serialised at Open() and the phase
+// read as a view. Bodies too long for a short string are read both copied
+// into the response and as views into the connection buffer, one of them
+// sent chunked. Only the polling thread is counted, not the stand-in.
+// Exits 1 if a registry poll or accept allocates, or a body read as a view
+// does.
+//
+//   bench_poll_allocations [--polls N]
+
+#include "bench_alloc_counter.h"
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include <csignal>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* UNREGISTERED_PATH = "/lol-summoner/v1/current-summoner";
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"None","state":"InProgress",)"
+    R"("suppressUx":false,"timer":4.0})";
+constexpr const char* GAMEFLOW_SESSION =
+    R"({"gameClient":{"running":false,"visible":false},"gameData":{"gameId":0,"isCustomGame":false,)"
+    R"("queue":{"id":420,"type":"RANKED_SOLO_5x5"}},"map":{"id":11,"name":"Summoner's Rift"},)"
+    R"("phase":"ReadyCheck"})";
+// Small enough that the session body comes in several chunks
+constexpr size_t SESSION_CHUNK_SIZE = 48;
+
+struct Scenario {
+    bench::LatencySamples latency;
+    bench::AllocationCount allocations;
+    int failures = 0;
+};
+
+// Warms the connection and buffers up, then counts the polls that follow
+Scenario Run(int polls, const std::function<bool()>& poll) {
+    Scenario scenario;
+    for (int i = 0; i < 10; ++i) {
+        poll();
+    }
+
+    // Reserved up front: recording a sample must not allocate while counting
+    std::vector<std::chrono::nanoseconds> samples(static_cast<size_t>(polls));
+    {
+        bench::AllocationScope scope;
+        for (int i = 0; i < polls; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            scenario.failures += poll() ? 0 : 1;
+            samples[static_cast<size_t>(i)] = std::chrono::steady_clock::now() - start;
+        }
+        scenario.allocations = scope.Get();
+    }
+    for (std::chrono::nanoseconds sample : samples) {
+        scenario.latency.Add(sample);
+    }
+    return scenario;
+}
+
+void Print(const char* label, const Scenario& scenario, int polls) {
+    scenario.latency.Print(label);
+    std::printf("%-34s %.2f allocations, %.1f bytes per poll, %d failed\n", "",
+                static_cast<double>(scenario.allocations.allocations) / polls,
+                static_cast<double>(scenario.allocations.bytes) / polls, scenario.failures);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int polls = bench::ParseIntArg(argc, argv, "--polls", 2000);
+    const char* accept_path = core::GetLCUEndpoint(core::LCUEndpointId::ACCEPT_MATCHMAKING).path;
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", core::GAMEFLOW_PHASE_URI, {200, "\"Matchmaking\""});
+    server.SetResponse("POST", accept_path, {204, ""});
+    server.SetResponse("GET", UNREGISTERED_PATH, {200, "{}"});
+    server.SetResponse("GET", core::READY_CHECK_URI, {200, READY_CHECK_PENDING});
+    const char* session_path = core::GetLCUEndpoint(core::LCUEndpointId::GAMEFLOW_SESSION).path;
+    server.SetResponse("GET", session_path, {200, GAMEFLOW_SESSION, SESSION_CHUNK_SIZE});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials({server.GetPort(), server.GetAuthToken()});
+
+    // What a poll cost before: the constant path became a std::string on
+    // every call and the phase was copied out of the body
+    Scenario copied = Run(polls, [&session]() {
+        core::HttpResponse response = session.Get(std::string(core::GAMEFLOW_PHASE_URI));
+        std::string_view phase;
+        if (!response.IsSuccess() || !core::ParseGameflowPhase(response.body, phase)) return false;
+        std::string copy(phase);
+        return models::GameflowPhaseFromWire(copy) == models::GameflowPhase::MATCHMAKING;
+    });
+
+    Scenario registry = Run(polls, [&session]() {
+        core::HttpResponse response = session.Get(core::GAMEFLOW_PHASE_URI);
+        std::string_view phase;
+        return response.IsSuccess() && core::ParseGameflowPhase(response.body, phase) &&
+               models::GameflowPhaseFromWire(phase) == models::GameflowPhase::MATCHMAKING;
+    });
+
+    Scenario accept = Run(polls, [&session, accept_path]() {
+        return session.Post(accept_path).IsSuccess();
+    });
+
+    Scenario unregistered = Run(polls, [&session]() {
+        return session.Get(UNREGISTERED_PATH).IsSuccess();
+    });
+
+    // The body copied into the response, as every poll used to
+    Scenario ready_copied = Run(polls, [&session]() {
+        core::HttpResponse response = session.Get(core::READY_CHECK_URI);
+        core::ReadyCheckView ready_check;
+        return response.IsSuccess() && core::ParseReadyCheck(response.body, ready_check) &&
+               ready_check.IsInProgress();
+    });
+
+    // Parsed where it was read, as the engine polls
+    Scenario ready_view = Run(polls, [&session]() {
+        core::HttpResponseView response = session.GetView(core::READY_CHECK_URI);
+        core::ReadyCheckView ready_check;
+        return response.IsSuccess() && core::ParseReadyCheck(response.body, ready_check) &&
+               ready_check.IsInProgress();
+    });
+
+    Scenario chunked_copied = Run(polls, [&session, session_path]() {
+        core::HttpResponse response = session.Get(session_path);
+        std::string_view phase;
+        return response.IsSuccess() && core::ParseSessionPhase(response.body, phase) && phase == "ReadyCheck";
+    });
+
+    Scenario chunked_view = Run(polls, [&session, session_path]() {
+        core::HttpResponseView response = session.GetView(session_path);
+        std::string_view phase;
+        return response.IsSuccess() && response.body == GAMEFLOW_SESSION &&
+               core::ParseSessionPhase(response.body, phase) && phase == "ReadyCheck";
+    });
+
+    std::printf("steady-state requests on one connection, %d each:\n", polls);
+    Print("  phase poll, path copied", copied, polls);
+    Print("  phase poll, registry", registry, polls);
+    Print("  accept POST, registry", accept, polls);
+    Print("  GET outside the registry", unregistered, polls);
+    Print("  ready check, body copied", ready_copied, polls);
+    Print("  ready check, body viewed", ready_view, polls);
+    Print("  chunked session, body copied", chunked_copied, polls);
+    Print("  chunked session, body viewed", chunked_view, polls);
+    std::printf("  %d handshakes in total\n", session.GetConnectionCount());
+
+    server.Stop();
+    bool ok = true;
+    for (const Scenario* scenario : {&registry, &accept, &ready_view, &chunked_view}) {
+        ok = ok && scenario->allocations.allocations == 0 && scenario->failures == 0;
+    }
+    if (!ok || ready_copied.failures > 0 || chunked_copied.failures > 0) {
+        std::fprintf(stderr, "registry requests or viewed bodies allocated, or a poll failed\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+// Poll requests over a simulated play session: the fixed interval the loop
+// used to poll at versus the phase-driven schedule. Time is simulated, so the
+// whole session replays in microseconds.
+//
+//   bench_poll_schedule [--games N] [--active MS] [--idle MS] [--dormant MS]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/poll_scheduler.h"
+#include <cstdio>
+
+using namespace league_auto_accept;
+
+namespace {
+
+struct PhaseSpan {
+    const char* phase;
+    std::chrono::seconds duration;
+};
+
+// One queue-to-lobby cycle of a ranked game
+constexpr PhaseSpan GAME_CYCLE[] = {
+    {"Lobby", std::chrono::seconds(60)},
+    {"Matchmaking", std::chrono::seconds(120)},
+    {"ReadyCheck", std::chrono::seconds(10)},
+    {"ChampSelect", std::chrono::seconds(90)},
+    {"GameStart", std::chrono::seconds(20)},
+    {"InProgress", std::chrono::seconds(30 * 60)},
+    {"WaitingForStats", std::chrono::seconds(15)},
+    {"PreEndOfGame", std::chrono::seconds(10)},
+    {"EndOfGame", std::chrono::seconds(45)},
+    {"None", std::chrono::seconds(30)}
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int games = bench::ParseIntArg(argc, argv, "--games", 5);
+
+    core::PollSchedule schedule;
+    schedule.active = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--active", 250));
+    schedule.idle = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--idle", 2000));
+    schedule.dormant = std::chrono::milliseconds(bench::ParseIntArg(argc, argv, "--dormant", 15000));
+    if (!schedule.IsValid()) {
+        std::fprintf(stderr, "intervals must be positive and increase from active to dormant\n");
+        return 1;
+    }
+
+    core::PollScheduler scheduler(schedule);
+
+    // The phase a poll sees is the one in effect at that moment; the next
+    // poll is due one interval for that phase later
+    std::chrono::steady_clock::time_point now{};
+    std::chrono::steady_clock::time_point phase_end = now;
+    std::chrono::steady_clock::duration session{};
+
+    std::printf("%-16s %10s %10s %10s\n", "phase", "interval", "fixed", "adaptive");
+    for (const PhaseSpan& span : GAME_CYCLE) {
+        std::chrono::milliseconds interval = scheduler.GetInterval(span.phase);
+        long long fixed = span.duration / schedule.active;
+        long long adaptive = (span.duration + interval - std::chrono::milliseconds(1)) / interval;
+        std::printf("%-16s %8lldms %10lld %10lld\n", span.phase,
+                    static_cast<long long>(interval.count()), fixed, adaptive);
+    }
+
+    for (int game = 0; game < games; ++game) {
+        for (const PhaseSpan& span : GAME_CYCLE) {
+            phase_end += span.duration;
+            session += span.duration;
+            std::chrono::milliseconds interval = scheduler.GetInterval(span.phase);
+            while (now < phase_end) {
+                scheduler.RecordPoll(now);
+                now += interval;
+            }
+        }
+    }
+
+    long long fixed_polls = session / schedule.active;
+    std::printf("\n%d games, %.1f hours simulated\n", games,
+                std::chrono::duration<double, std::ratio<3600>>(session).count());
+    std::printf("fixed %lldms interval:  %lld polls\n",
+                static_cast<long long>(schedule.active.count()), fixed_polls);
+    std::printf("phase-driven schedule:  %llu polls, %llu requests saved (%.1f%%)\n",
+                static_cast<unsigned long long>(scheduler.GetPollCount()),
+                static_cast<unsigned long long>(scheduler.GetRequestsSaved()),
+                fixed_polls > 0 ? 100.0 * static_cast<double>(scheduler.GetRequestsSaved()) / fixed_polls : 0.0);
+    return 0;
+}
@@ -0,0 +1,245 @@
+// Colour-band prefilter in front of the Accept button matcher, on recorded
+// client screenshots at 1080p and 1440p: the cost of counting band pixels
+// with the scalar, SSE2 and AVX2 loops, how many screens without a ready
+// check it rejects, and the detection time with and without it. Exits 1 if
+// the vector loops count differently from the scalar one or a screen with
+// the button is rejected.
+//
+//   bench_prefilter [--frames N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/color_prefilter.h"
+#include "league_auto_accept/core/image_file_capture_source.h"
+#include "league_auto_accept/core/roi_capture.h"
+#include "league_auto_accept/core/template_matcher.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+using namespace league_auto_accept;
+
+namespace {
+
+// Client layout the template was taken from
+constexpr int BASE_CLIENT_WIDTH = 1280;
+constexpr int BUTTON_WIDTH = 180;
+constexpr int BUTTON_HEIGHT = 44;
+
+struct Resolution {
+    const char* name;
+    int screen_width;
+    int screen_height;
+    int client_width;   // The client keeps 16:9
+};
+
+constexpr Resolution RESOLUTIONS[] = {
+    {"1080p", 1920, 1080, 1600},
+    {"1440p", 2560, 1440, 1920},
+};
+
+constexpr core::SimdLevel LEVELS[] = {core::SimdLevel::SCALAR, core::SimdLevel::SSE2, core::SimdLevel::AVX2};
+
+class Random {
+public:
+    explicit Random(uint32_t seed) : state_(seed) {}
+    uint32_t Next() {
+        state_ = state_ * 1103515245u + 12345u;
+        return state_ >> 8;
+    }
+    double Uniform(double low, double high) { return low + (high - low) * (Next() % 10001) / 10000.0; }
+
+private:
+    uint32_t state_;
+};
+
+void FillRect(core::Frame& frame, int x, int y, int width, int height, int blue, int green, int red) {
+    for (int row = std::max(y, 0); row < std::min(y + height, frame.height); ++row) {
+        uint8_t* pixel = frame.Row(row);
+        for (int column = std::max(x, 0); column < std::min(x + width, frame.width); ++column) {
+            pixel[column * 3] = static_cast<uint8_t>(blue);
+            pixel[column * 3 + 1] = static_cast<uint8_t>(green);
+            pixel[column * 3 + 2] = static_cast<uint8_t>(red);
+        }
+    }
+}
+
+// The ready-check Accept button, drawn (not resized) at `scale`
+void DrawButton(core::Frame& frame, int x, int y, double scale) {
+    int width = static_cast<int>(std::lround(BUTTON_WIDTH * scale));
+    int height = static_cast<int>(std::lround(BUTTON_HEIGHT * scale));
+    for (int row = 0; row < height; ++row) {
+        FillRect(frame, x, y + row, width, 1, 90 - 30 * row / height, 110 - 30 * row / height, 30);
+    }
+    int border = std::max(1, static_cast<int>(std::lround(2 * scale)));
+    FillRect(frame, x, y, width, border, 160, 200, 140);
+    FillRect(frame, x, y + height - border, width, border, 160, 200, 140);
+    FillRect(frame, x, y, border, height, 160, 200, 140);
+    FillRect(frame, x + width - border, y, border, height, 160, 200, 140);
+
+    int letter_width = static_cast<int>(std::lround(14 * scale));
+    int letter_height = static_cast<int>(std::lround(16 * scale));
+    int spacing = static_cast<int>(std::lround(20 * scale));
+    int text_x = x + (width - 5 * spacing - letter_width) / 2;
+    int text_y = y + (height - letter_height) / 2;
+    for (int letter = 0; letter < 6; ++letter) {
+        FillRect(frame, text_x + letter * spacing, text_y, letter_width, letter_height, 230, 240, 220);
+    }
+}
+
+struct Screen {
+    core::Frame pixels;
+    core::CaptureRect client;
+    bool ready_check = false;
+};
+
+Screen MakeScreen(const Resolution& resolution, bool ready_check, Random& random) {
+    Screen screen;
+    screen.ready_check = ready_check;
+    screen.pixels.Resize(resolution.screen_width, resolution.screen_height);
+    for (int y = 0; y < screen.pixels.height; ++y) {
+        uint8_t* row = screen.pixels.Row(y);
+        for (int x = 0; x < screen.pixels.width * 3; ++x) {
+            row[x] = static_cast<uint8_t>(40 + random.Next() % 24);
+        }
+    }
+
+    int client_height = resolution.client_width * 9 / 16;
+    screen.client = {(resolution.screen_width - resolution.client_width) / 2,
+                     (resolution.screen_height - client_height) / 2, resolution.client_width, client_height};
+    const core::CaptureRect& client = screen.client;
+    for (int y = client.y; y < client.y + client.height; ++y) {
+        uint8_t* pixel = screen.pixels.Row(y) + client.x * 3;
+        for (int x = 0; x < client.width; ++x, pixel += 3) {
+            int noise = static_cast<int>(random.Next() % 12);
+            pixel[0] = static_cast<uint8_t>(28 + noise + 20 * (y - client.y) / client.height);
+            pixel[1] = static_cast<uint8_t>(20 + noise);
+            pixel[2] = static_cast<uint8_t>(12 + noise);
+        }
+    }
+
+    // Lobby panels, buttons and portraits in the region outside a ready check
+    for (int panel = 0; panel < 8; ++panel) {
+        FillRect(screen.pixels, client.x + static_cast<int>(random.Next() % static_cast<uint32_t>(client.width)),
+                 client.y + client.height * 60 / 100 + static_cast<int>(random.Next() % (client.height / 4u)),
+                 static_cast<int>(client.width * random.Uniform(0.02, 0.12)),
+                 static_cast<int>(client.height * random.Uniform(0.01, 0.05)), 20 + random.Next() % 200,
+                 20 + random.Next() % 200, 20 + random.Next() % 200);
+    }
+
+    if (ready_check) {
+        double scale = static_cast<double>(client.width) / BASE_CLIENT_WIDTH * random.Uniform(0.97, 1.03);
+        DrawButton(screen.pixels, client.x + client.width * 43 / 100 + static_cast<int>(random.Next() % 41) - 20,
+                   client.y + client.height * 74 / 100 + static_cast<int>(random.Next() % 21) - 10, scale);
+    }
+    return screen;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int frames = bench::ParseIntArg(argc, argv, "--frames", 40);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                      ("laa_prefilter_bench_" + std::to_string(std::rand()));
+    std::filesystem::create_directories(directory);
+
+    core::Frame button;
+    button.Resize(BUTTON_WIDTH, BUTTON_HEIGHT);
+    DrawButton(button, 0, 0, 1.0);
+    core::PyramidMatchSettings settings;
+
+    core::SimdLevel supported = core::GetSupportedSimdLevel();
+    std::printf("%d screens per resolution (half with a ready check), widest loop %s\n\n", frames,
+                core::GetSimdLevelName(supported));
+
+    bool ok = true;
+    Random random(77);
+    for (const Resolution& resolution : RESOLUTIONS) {
+        double scale_factor = static_cast<double>(resolution.client_width) / BASE_CLIENT_WIDTH;
+        core::PyramidTemplateMatcher matcher(settings);
+        matcher.SetTemplate(button);
+        matcher.SetScaleFactor(scale_factor);
+        core::ColorBandPrefilter prefilter;
+        prefilter.SetTemplate(button);
+        prefilter.SetMinimumScale(scale_factor * settings.min_scale);
+
+        bench::LatencySamples count_samples[3];
+        bench::LatencySamples filter_samples;
+        bench::LatencySamples matcher_only_samples;
+        bench::LatencySamples filtered_samples;
+        int ready_rejected = 0;
+        int idle_rejected = 0;
+        int mismatched_counts = 0;
+        core::CaptureRect region;
+
+        for (int i = 0; i < frames; ++i) {
+            Screen screen = MakeScreen(resolution, i % 2 == 0, random);
+            std::string path = (directory / "screen.ppm").string();
+            core::ImageFileCaptureSource source;
+            if (!core::WritePpmImage(path, screen.pixels) || !source.AddImage(path)) {
+                std::fprintf(stderr, "cannot record screen: %s\n", source.GetLastError().c_str());
+                return 1;
+            }
+            core::RoiCapture capture(source);
+            region = capture.Capture(screen.client).rect;
+            const core::Frame& frame = capture.GetFrame();
+
+            // Whole-region counts, no early exit, so the loops do equal work
+            size_t scalar_count = 0;
+            for (int level = 0; level < 3 && LEVELS[level] <= supported; ++level) {
+                auto start = std::chrono::steady_clock::now();
+                size_t count = core::CountPixelsInBand(frame, prefilter.GetBand(), SIZE_MAX, LEVELS[level]);
+                count_samples[level].Add(std::chrono::steady_clock::now() - start);
+                if (level == 0) {
+                    scalar_count = count;
+                } else if (count != scalar_count) {
+                    mismatched_counts++;
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            bool passed = prefilter.MayContain(frame);
+            auto filtered = std::chrono::steady_clock::now() - start;
+            filter_samples.Add(filtered);
+
+            start = std::chrono::steady_clock::now();
+            core::PyramidTemplateMatcher::Match match = matcher.Find(frame);
+            auto matched = std::chrono::steady_clock::now() - start;
+            matcher_only_samples.Add(matched);
+            filtered_samples.Add(passed ? filtered + matched : filtered);
+
+            if (!passed) {
+                (screen.ready_check ? ready_rejected : idle_rejected)++;
+            }
+            if (passed && !screen.ready_check && match.found) {
+                std::fprintf(stderr, "matcher found a button on an idle screen\n");
+            }
+        }
+
+        int idle_frames = frames / 2;
+        int ready_frames = frames - idle_frames;
+        std::printf("%s: region %dx%d, band B %d-%d G %d-%d R %d-%d, %.0f%% of the template, %zu pixels needed\n",
+                    resolution.name, region.width, region.height, prefilter.GetBand().low[0],
+                    prefilter.GetBand().high[0], prefilter.GetBand().low[1], prefilter.GetBand().high[1],
+                    prefilter.GetBand().low[2], prefilter.GetBand().high[2],
+                    prefilter.GetTemplateCoverage() * 100.0, prefilter.GetRequiredPixels());
+        for (int level = 0; level < 3 && LEVELS[level] <= supported; ++level) {
+            count_samples[level].Print(std::string("  count, ") + core::GetSimdLevelName(LEVELS[level]));
+        }
+        filter_samples.Print("  prefilter (early exit)");
+        std::printf("    rejected %d/%d idle screens, %d/%d ready checks; mismatched counts %d\n", idle_rejected,
+                    idle_frames, ready_rejected, ready_frames, mismatched_counts);
+        matcher_only_samples.Print("  detection, matcher only");
+        filtered_samples.Print("  detection, prefilter + matcher");
+        std::printf("\n");
+        ok = ok && ready_rejected == 0 && mismatched_counts == 0;
+    }
+    std::filesystem::remove_all(directory);
+
+    if (!ok) {
+        std::fprintf(stderr, "prefilter rejected a ready check or the vector counts disagree\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+// League client process checks on a synthetic procfs tree with thousands of
+// processes: resolving every process on every check, as the monitor used to,
+// versus the diffed ProcessTracker. Exits 1 if the tracker loses the client
+// or misses started / exited processes.
+//
+//   bench_process_monitor [--processes N] [--checks N] [--churn N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/proc_process_source.h"
+#include "league_auto_accept/core/process_tracker.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* CLIENT_NAME = "LeagueClient.exe";
+constexpr uint32_t CLIENT_PROCESS_ID = 4242;
+constexpr uint32_t FIRST_PROCESS_ID = 100;
+
+void AddProcess(const std::filesystem::path& root, uint32_t process_id, const std::string& name) {
+    std::filesystem::path directory = root / std::to_string(process_id);
+    std::filesystem::create_directories(directory);
+    std::ofstream(directory / "comm") << name << "\n";
+    std::filesystem::create_symlink("/opt/synthetic/" + name, directory / "exe");
+}
+
+void RemoveProcess(const std::filesystem::path& root, uint32_t process_id) {
+    std::filesystem::remove_all(root / std::to_string(process_id));
+}
+
+// The old approach: every process resolved on every check
+bool FullScan(core::ProcessSource& source, std::vector<uint32_t>& ids, uint32_t& found_id) {
+    if (!source.ListProcessIds(ids)) return false;
+    bool found = false;
+    for (uint32_t process_id : ids) {
+        std::string name;
+        std::string path;
+        if (source.GetProcessName(process_id, name) && source.GetExecutablePath(process_id, path) &&
+            !found && core::EqualsIgnoreCase(name, CLIENT_NAME)) {
+            found_id = process_id;
+            found = true;
+        }
+    }
+    return found;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int process_count = bench::ParseIntArg(argc, argv, "--processes", 3000);
+    int checks = bench::ParseIntArg(argc, argv, "--checks", 50);
+    int churn = bench::ParseIntArg(argc, argv, "--churn", 5);
+
+    std::filesystem::path root = std::filesystem::temp_directory_path() /
+                                 ("laa_proc_bench_" + std::to_string(std::rand()));
+    std::filesystem::create_directories(root);
+
+    uint32_t next_id = FIRST_PROCESS_ID;
+    for (int i = 0; i < process_count; ++i, ++next_id) {
+        if (next_id == CLIENT_PROCESS_ID) ++next_id;
+        AddProcess(root, next_id, "svc" + std::to_string(i % 97));
+    }
+    AddProcess(root, CLIENT_PROCESS_ID, CLIENT_NAME);
+    // Unrelated entries a real /proc has too
+    std::filesystem::create_directories(root / "sys");
+    std::ofstream(root / "uptime") << "1.0 1.0\n";
+
+    std::printf("Synthetic /proc: %d processes, %d checks, %d started + %d exited per churn check\n\n",
+                process_count + 1, checks, churn, churn);
+
+    bool ok = true;
+    core::ProcProcessSource full_source(root.string());
+    std::vector<uint32_t> ids;
+    bench::LatencySamples full_samples;
+    for (int i = 0; i < checks; ++i) {
+        uint32_t found_id = 0;
+        auto start = std::chrono::steady_clock::now();
+        bool found = FullScan(full_source, ids, found_id);
+        full_samples.Add(std::chrono::steady_clock::now() - start);
+        ok = ok && found && found_id == CLIENT_PROCESS_ID;
+    }
+
+    core::ProcessTracker tracker(std::make_unique<core::ProcProcessSource>(root.string()));
+    auto start = std::chrono::steady_clock::now();
+    tracker.Update();
+    auto first_update = std::chrono::steady_clock::now() - start;
+
+    bench::LatencySamples steady_samples;
+    size_t steady_lookups = 0;
+    for (int i = 0; i < checks; ++i) {
+        uint32_t found_id = 0;
+        start = std::chrono::steady_clock::now();
+        bool found = tracker.Update() && tracker.FindProcess(CLIENT_NAME, found_id);
+        steady_samples.Add(std::chrono::steady_clock::now() - start);
+        steady_lookups += tracker.GetLastUpdateStats().name_lookups;
+        ok = ok && found && found_id == CLIENT_PROCESS_ID;
+    }
+
+    // Processes come and go between checks; only they cost a lookup
+    bench::LatencySamples churn_samples;
+    uint32_t oldest_id = FIRST_PROCESS_ID;
+    size_t churn_started = 0;
+    size_t churn_exited = 0;
+    for (int i = 0; i < checks; ++i) {
+        for (int j = 0; j < churn; ++j) {
+            if (oldest_id == CLIENT_PROCESS_ID) ++oldest_id;
+            RemoveProcess(root, oldest_id++);
+            AddProcess(root, next_id++, "worker");
+        }
+
+        uint32_t found_id = 0;
+        start = std::chrono::steady_clock::now();
+        bool found = tracker.Update() && tracker.FindProcess(CLIENT_NAME, found_id);
+        churn_samples.Add(std::chrono::steady_clock::now() - start);
+        churn_started += tracker.GetLastUpdateStats().started;
+        churn_exited += tracker.GetLastUpdateStats().exited;
+        ok = ok && found && found_id == CLIENT_PROCESS_ID;
+    }
+    ok = ok && churn_started == static_cast<size_t>(checks * churn) &&
+         churn_exited == static_cast<size_t>(checks * churn);
+
+    // The client exits
+    RemoveProcess(root, CLIENT_PROCESS_ID);
+    uint32_t found_id = 0;
+    bool still_found = tracker.Update() && tracker.FindProcess(CLIENT_NAME, found_id);
+    ok = ok && !still_found && tracker.GetProcessCount() == static_cast<size_t>(process_count);
+
+    full_samples.Print("full scan every check");
+    std::printf("  name + path lookups per check: %d\n", process_count + 1);
+    std::printf("tracker first update              %.1fus (%d name lookups)\n",
+                std::chrono::duration<double, std::micro>(first_update).count(), process_count + 1);
+    steady_samples.Print("tracker, no changes");
+    std::printf("  name lookups per check: %.1f\n", static_cast<double>(steady_lookups) / checks);
+    churn_samples.Print("tracker, with churn");
+    std::printf("  started %zu, exited %zu; client exit noticed: %s\n",
+                churn_started, churn_exited, still_found ? "no" : "yes");
+    std::printf("\np50 speedup without changes: %.1fx\n",
+                full_samples.PercentileMicros(50) / steady_samples.PercentileMicros(50));
+
+    std::filesystem::remove_all(root);
+    if (!ok) {
+        std::fprintf(stderr, "process tracker returned wrong results\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Concurrent LCU requests against the local LCU stand-in: a thread (and
+// connection) per request through std::async, as LCUClient's async methods
+// did, versus LCURequestPool's fixed workers. Samples the process's thread
+// count while thousands of requests are in flight, then checks cancellation,
+// deadlines and load shedding. Exits 1 if a pooled request fails, the thread
+// count grows beyond the pool, or a cancelled, expired or rejected request
+// is not reported as such.
+//
+//   bench_request_pool [--requests N] [--submitters N] [--workers N] [--baseline-requests N]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_request_pool.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <thread>
+#include <vector>
+
+using namespace league_auto_accept;
+
+namespace {
+
+constexpr const char* PHASE_PATH = "/lol-gameflow/v1/gameflow-phase";
+
+int ReadThreadCount() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "Threads:") {
+            int threads = 0;
+            status >> threads;
+            return threads;
+        }
+    }
+    return 0;
+}
+
+// Highest thread count seen while it runs
+class ThreadCountSampler {
+public:
+    ThreadCountSampler() : running_(true), peak_(ReadThreadCount()) {
+        thread_ = std::thread([this]() {
+            while (running_) {
+                int threads = ReadThreadCount();
+                if (threads > peak_) peak_ = threads;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+    }
+
+    int Finish() {
+        running_ = false;
+        thread_.join();
+        return peak_;
+    }
+
+private:
+    std::atomic<bool> running_;
+    std::atomic<int> peak_;
+    std::thread thread_;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int requests = bench::ParseIntArg(argc, argv, "--requests", 5000);
+    int submitters = bench::ParseIntArg(argc, argv, "--submitters", 8);
+    int workers = bench::ParseIntArg(argc, argv, "--workers", 4);
+    int baseline_requests = bench::ParseIntArg(argc, argv, "--baseline-requests", 300);
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", PHASE_PATH, {200, "\"Matchmaking\""});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    int idle_threads = ReadThreadCount();
+    std::printf("LCU stand-in on 127.0.0.1:%d, %d threads at rest\n\n", server.GetPort(), idle_threads);
+
+    bool ok = true;
+
+    // Thread per request; each needs its own connection, transports are not thread-safe
+    {
+        int handshakes = server.GetHandshakeCount();
+        ThreadCountSampler sampler;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::future<core::HttpResponse>> futures;
+        futures.reserve(static_cast<size_t>(baseline_requests));
+        for (int i = 0; i < baseline_requests; ++i) {
+            futures.push_back(std::async(std::launch::async, [&credentials]() {
+                core::LCUSession session(core::CreatePlatformTransport());
+                session.UpdateCredentials(credentials);
+                return session.Get(PHASE_PATH);
+            }));
+        }
+        int failures = 0;
+        for (auto& future : futures) {
+            failures += future.get().IsSuccess() ? 0 : 1;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        int peak = sampler.Finish();
+        std::printf("std::async per request: %d requests in %.1fms, peak %d threads (+%d), %d handshakes, %d failed\n",
+                    baseline_requests, std::chrono::duration<double, std::milli>(elapsed).count(), peak,
+                    peak - idle_threads, server.GetHandshakeCount() - handshakes, failures);
+    }
+
+    // The pool, fed from several threads at once
+    {
+        core::RequestPoolConfig config;
+        config.workers = static_cast<size_t>(workers);
+        config.max_queued = static_cast<size_t>(requests);
+        config.default_deadline = std::chrono::milliseconds(30000);
+        core::LCURequestPool pool(config);
+        pool.UpdateCredentials(credentials);
+
+        int handshakes = server.GetHandshakeCount();
+        ThreadCountSampler sampler;
+        auto start = std::chrono::steady_clock::now();
+        std::atomic<int> failures{0};
+        std::vector<std::thread> threads;
+        std::vector<bench::LatencySamples> samples(static_cast<size_t>(submitters));
+        for (int t = 0; t < submitters; ++t) {
+            threads.emplace_back([&, t]() {
+                int count = requests / submitters + (t < requests % submitters ? 1 : 0);
+                std::vector<core::AsyncLCURequest> pending;
+                std::vector<std::chrono::steady_clock::time_point> submitted;
+                for (int i = 0; i < count; ++i) {
+                    submitted.push_back(std::chrono::steady_clock::now());
+                    pending.push_back(pool.Submit(core::HttpMethod::GET, PHASE_PATH));
+                }
+                for (size_t i = 0; i < pending.size(); ++i) {
+                    core::AsyncRequestResult result = pending[i].Get();
+                    samples[static_cast<size_t>(t)].Add(std::chrono::steady_clock::now() - submitted[i]);
+                    if (!result.IsSuccess()) failures++;
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        int peak = sampler.Finish();
+
+        // Workers, submitters and the sampler, plus a server thread per worker connection
+        int allowed = idle_threads + workers * 2 + submitters + 1;
+        std::printf("pool, %d workers: %d requests from %d threads in %.1fms, peak %d threads (+%d, at most +%d), "
+                    "%d handshakes, %d failed\n",
+                    workers, requests, submitters, std::chrono::duration<double, std::milli>(elapsed).count(), peak,
+                    peak - idle_threads, allowed - idle_threads, server.GetHandshakeCount() - handshakes,
+                    failures.load());
+        samples[0].Print("  submit -> response (thread 0)");
+        ok = ok && failures == 0 && peak <= allowed;
+    }
+
+    // Cancellation, deadlines and shedding, with a slow server
+    {
+        tools::MockFaults faults;
+        faults.latency = std::chrono::milliseconds(20);
+        server.SetFaults(faults);
+
+        core::RequestPoolConfig config;
+        config.workers = 2;
+        config.max_queued = 16;
+        core::LCURequestPool pool(config);
+        pool.UpdateCredentials(credentials);
+
+        int served = server.GetRequestCount();
+        std::vector<core::AsyncLCURequest> pending;
+        for (int i = 0; i < 16; ++i) {
+            pending.push_back(pool.Submit(core::HttpMethod::GET, PHASE_PATH));
+        }
+        auto start = std::chrono::steady_clock::now();
+        int cancelled = 0;
+        for (core::AsyncLCURequest& request : pending) {
+            request.Cancel();
+            cancelled += request.Get().status == core::AsyncRequestStatus::CANCELLED ? 1 : 0;
+        }
+        double cancel_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        pool.Stop();
+        int sent = server.GetRequestCount() - served;
+        std::printf("\ncancel 16 queued: %d cancelled in %.2fms, %d reached the server (on the wire already)\n",
+                    cancelled, cancel_ms, sent);
+        ok = ok && cancelled == 16 && sent <= 2;
+
+        core::LCURequestPool deadline_pool(config);
+        deadline_pool.UpdateCredentials(credentials);
+        std::vector<core::AsyncLCURequest> short_deadline;
+        for (int i = 0; i < 8; ++i) {
+            short_deadline.push_back(
+                deadline_pool.Submit(core::HttpMethod::GET, PHASE_PATH, "", std::chrono::milliseconds(10)));
+        }
+        start = std::chrono::steady_clock::now();
+        int expired = 0;
+        for (core::AsyncLCURequest& request : short_deadline) {
+            expired += request.Get().status == core::AsyncRequestStatus::EXPIRED ? 1 : 0;
+        }
+        double expire_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::printf("10ms deadline, 20ms server: %d/8 expired, all back after %.1fms\n", expired, expire_ms);
+        ok = ok && expired == 8 && expire_ms < 20.0;
+
+        int rejected = 0;
+        std::vector<core::AsyncLCURequest> burst;
+        for (int i = 0; i < 100; ++i) {
+            burst.push_back(deadline_pool.Submit(core::HttpMethod::GET, PHASE_PATH));
+            rejected += burst.back().GetStatus() == core::AsyncRequestStatus::REJECTED ? 1 : 0;
+        }
+        for (core::AsyncLCURequest& request : burst) {
+            request.Cancel();
+        }
+        std::printf("burst of 100 into a 16-slot queue: %d rejected\n", rejected);
+        ok = ok && rejected > 0;
+    }
+
+    server.Stop();
+    if (!ok) {
+        std::fprintf(stderr, "request pool check failed\n");
+        return 1;
+    }
+    return 0;
+}
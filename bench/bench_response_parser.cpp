@@ -0,0 +1,200 @@
+// LCU response parsing on recorded payloads: the shared string_view parser
+// versus the substring search the GUI used, and nlohmann::json where it is
+// available. Reports ns per parse, heap allocations per parse, and whether
+// each approach found the right value.
+
+#include "bench_alloc_counter.h"
+#include "bench_common.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include <fstream>
+#include <sstream>
+
+#ifdef LAA_HAVE_NLOHMANN_JSON
+#include <nlohmann/json.hpp>
+#endif
+
+using namespace league_auto_accept;
+
+namespace {
+
+enum class PayloadKind { PHASE, SESSION_PHASE, READY_CHECK, SEARCH_READY_CHECK, ERROR_CODE };
+
+struct PayloadCase {
+    const char* file;
+    PayloadKind kind;
+    const char* expected;   // Extracted field; ready checks as "state/playerResponse"
+};
+
+constexpr PayloadCase PAYLOAD_CASES[] = {
+    {"gameflow_phase.json", PayloadKind::PHASE, "ReadyCheck"},
+    {"gameflow_session.json", PayloadKind::SESSION_PHASE, "ReadyCheck"},
+    {"ready_check.json", PayloadKind::READY_CHECK, "InProgress/None"},
+    {"ready_check_declined.json", PayloadKind::READY_CHECK, "PartyNotReady/Accepted"},
+    {"matchmaking_search.json", PayloadKind::SEARCH_READY_CHECK, "InProgress/None"},
+    {"error_response.json", PayloadKind::ERROR_CODE, "RPC_ERROR"},
+};
+
+// Compares against "first/second" without building a joined string
+bool MatchesPair(std::string_view first, std::string_view second, std::string_view expected) {
+    size_t slash = expected.find('/');
+    return expected.substr(0, slash) == first && expected.substr(slash + 1) == second;
+}
+
+bool ParseWithScanner(const std::string& body, PayloadKind kind, std::string_view expected) {
+    std::string_view value;
+    core::ReadyCheckView ready_check;
+    switch (kind) {
+    case PayloadKind::PHASE:
+        return core::ParseGameflowPhase(body, value) && value == expected;
+    case PayloadKind::SESSION_PHASE:
+        return core::ParseSessionPhase(body, value) && value == expected;
+    case PayloadKind::READY_CHECK:
+        return core::ParseReadyCheck(body, ready_check) &&
+               MatchesPair(ready_check.state, ready_check.player_response, expected);
+    case PayloadKind::SEARCH_READY_CHECK:
+        return core::ParseSearchReadyCheck(body, ready_check) &&
+               MatchesPair(ready_check.state, ready_check.player_response, expected);
+    case PayloadKind::ERROR_CODE:
+        return core::ParseErrorCode(body, value) && value == expected;
+    }
+    return false;
+}
+
+// The GUI's former approach: first quoted string after the key
+std::string FindQuotedAfter(const std::string& body, const std::string& key) {
+    size_t key_pos = body.find(key);
+    if (key_pos == std::string::npos) return "";
+    size_t quote_start = body.find("\"", key_pos + key.size());
+    if (quote_start == std::string::npos) return "";
+    size_t quote_end = body.find("\"", quote_start + 1);
+    if (quote_end == std::string::npos) return "";
+    return body.substr(quote_start + 1, quote_end - quote_start - 1);
+}
+
+bool ParseWithFind(const std::string& body, PayloadKind kind, std::string_view expected) {
+    switch (kind) {
+    case PayloadKind::PHASE: {
+        size_t start = body.find("\"");
+        if (start == std::string::npos) return false;
+        size_t end = body.find("\"", start + 1);
+        if (end == std::string::npos) return false;
+        return body.substr(start + 1, end - start - 1) == expected;
+    }
+    case PayloadKind::SESSION_PHASE:
+        return FindQuotedAfter(body, "\"phase\":") == expected;
+    case PayloadKind::READY_CHECK:
+    case PayloadKind::SEARCH_READY_CHECK:
+        return MatchesPair(FindQuotedAfter(body, "\"state\":"),
+                           FindQuotedAfter(body, "\"playerResponse\":"), expected);
+    case PayloadKind::ERROR_CODE:
+        return body.find("errorCode") != std::string::npos &&
+               FindQuotedAfter(body, "\"errorCode\":") == expected;
+    }
+    return false;
+}
+
+#ifdef LAA_HAVE_NLOHMANN_JSON
+bool ParseWithNlohmann(const std::string& body, PayloadKind kind, std::string_view expected) {
+    nlohmann::json json = nlohmann::json::parse(body, nullptr, false);
+    if (json.is_discarded()) return false;
+    switch (kind) {
+    case PayloadKind::PHASE:
+        return json.is_string() && json.get<std::string>() == expected;
+    case PayloadKind::SESSION_PHASE:
+        return json.value("phase", std::string()) == expected;
+    case PayloadKind::READY_CHECK:
+        return MatchesPair(json.value("state", std::string()), json.value("playerResponse", std::string()),
+                           expected);
+    case PayloadKind::SEARCH_READY_CHECK: {
+        const nlohmann::json& ready_check = json["readyCheck"];
+        return MatchesPair(ready_check.value("state", std::string()),
+                           ready_check.value("playerResponse", std::string()), expected);
+    }
+    case PayloadKind::ERROR_CODE:
+        return json.value("errorCode", std::string()) == expected;
+    }
+    return false;
+}
+#endif
+
+using ParseFunction = bool (*)(const std::string& body, PayloadKind kind, std::string_view expected);
+
+struct ApproachResult {
+    double ns_per_parse = 0.0;
+    double allocations_per_parse = 0.0;
+    bool correct = false;
+};
+
+ApproachResult Measure(ParseFunction parse, const std::string& body, const PayloadCase& payload,
+                       int iterations) {
+    ApproachResult result;
+    result.correct = parse(body, payload.kind, payload.expected);
+
+    bench::AllocationScope scope;
+    auto start = std::chrono::steady_clock::now();
+    int matches = 0;
+    for (int i = 0; i < iterations; ++i) {
+        matches += parse(body, payload.kind, payload.expected) ? 1 : 0;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    uint64_t allocations = scope.Get().allocations;
+
+    result.correct = result.correct && matches == iterations;
+    result.ns_per_parse = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+                          iterations;
+    result.allocations_per_parse = static_cast<double>(allocations) / iterations;
+    return result;
+}
+
+bool LoadPayload(const std::string& path, std::string& body) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    body = contents.str();
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int iterations = bench::ParseIntArg(argc, argv, "--iterations", 200000);
+    std::string payload_dir = bench::ParseStringArg(argc, argv, "--payloads", LAA_PAYLOADS_DIR);
+
+    struct Approach {
+        const char* name;
+        ParseFunction parse;
+    };
+    std::vector<Approach> approaches = {
+        {"string_view scanner", ParseWithScanner},
+        {"substring find", ParseWithFind},
+#ifdef LAA_HAVE_NLOHMANN_JSON
+        {"nlohmann::json", ParseWithNlohmann},
+#endif
+    };
+
+    std::printf("%d parses per approach and payload\n\n", iterations);
+
+    // The scanner must stay allocation-free and correct on every payload
+    bool scanner_correct = true;
+    for (const PayloadCase& payload : PAYLOAD_CASES) {
+        std::string body;
+        if (!LoadPayload(payload_dir + "/" + payload.file, body)) {
+            std::fprintf(stderr, "Failed to read payload %s/%s\n", payload_dir.c_str(), payload.file);
+            return 1;
+        }
+
+        std::printf("%s (%zu bytes)\n", payload.file, body.size());
+        for (const Approach& approach : approaches) {
+            ApproachResult result = Measure(approach.parse, body, payload, iterations);
+            std::printf("  %-22s %8.1f ns/parse %6.2f allocs/parse  %s\n", approach.name, result.ns_per_parse,
+                        result.allocations_per_parse, result.correct ? "ok" : "WRONG VALUE");
+            if (approach.parse == ParseWithScanner) {
+                scanner_correct = scanner_correct && result.correct && result.allocations_per_parse == 0.0;
+            }
+        }
+        std::printf("\n");
+    }
+
+    return scanner_correct ? 0 : 1;
+}
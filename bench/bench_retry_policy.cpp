@@ -0,0 +1,320 @@
+// LCU request retries under injected faults: LCUClient's old loop (fixed
+// delay, reconnecting inline on the calling thread) versus RetryPolicy
+// (jittered exponential backoff, per-endpoint budget, deadline) with a
+// BackgroundReconnector. Runs a flaky client, a ready check about to
+// expire, a client that never answers and a client restart. Exits 1 if a
+// retry starts past its deadline, the budget lets through more retries than
+// it holds, or a call stalls on a reconnect past its deadline.
+//
+//   bench_retry_policy [--calls N] [--error-rate PERCENT]
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/retry_policy.h"
+#include <csignal>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr const char* READY_CHECK_PATH = "/lol-matchmaking/v1/ready-check";
+constexpr const char* PHASE_PATH = "/lol-gameflow/v1/gameflow-phase";
+constexpr const char* READY_CHECK_BODY =
+    "{\"state\":\"InProgress\",\"playerResponse\":\"None\",\"timer\":3.0,\"declinerIds\":[]}";
+// LCUClient's previous defaults: four attempts, a fixed delay between them
+constexpr int OLD_ATTEMPTS = 4;
+constexpr std::chrono::milliseconds OLD_RETRY_DELAY{100};
+
+double Millis(Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+// Stands in for the lockfile: valid credentials only while a client runs
+class FakeLockfile {
+public:
+    void Write(const core::LCUCredentials& credentials) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        credentials_ = credentials;
+    }
+    core::LCUCredentials Read() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return credentials_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    core::LCUCredentials credentials_;
+};
+
+// The parts of LCUClient the retry loop touches: a session that a
+// reconnect replaces, from whichever thread runs it
+class Connection {
+public:
+    explicit Connection(const FakeLockfile& lockfile) : lockfile_(lockfile) {}
+
+    // Discovery and a probe on a new session, as LCUClient does
+    bool Reconnect() {
+        core::LCUCredentials credentials = lockfile_.Read();
+        if (!credentials.IsValid()) return false;
+
+        auto session = std::make_shared<core::LCUSession>(core::CreatePlatformTransport());
+        session->UpdateCredentials(credentials);
+        if (!session->Get(PHASE_PATH).IsSuccess()) return false;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        session_ = session;
+        return true;
+    }
+
+    core::HttpResponse Get(const std::string& path) {
+        std::shared_ptr<core::LCUSession> session;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            session = session_;
+        }
+        return session ? session->Get(path) : core::HttpResponse();
+    }
+
+private:
+    const FakeLockfile& lockfile_;
+    std::mutex mutex_;
+    std::shared_ptr<core::LCUSession> session_;
+};
+
+// LCUClient::MakeRequestWithRetry before the policy
+core::HttpResponse OldRetryLoop(Connection& connection, const std::string& path, int* attempts = nullptr) {
+    core::HttpResponse response;
+    for (int attempt = 0; attempt < OLD_ATTEMPTS; ++attempt) {
+        response = connection.Get(path);
+        if (attempts) (*attempts)++;
+        if (response.IsSuccess()) return response;
+        if (attempt + 1 < OLD_ATTEMPTS) {
+            if (response.IsTransportError() && connection.Reconnect()) {
+                continue;
+            }
+            std::this_thread::sleep_for(OLD_RETRY_DELAY);
+        }
+    }
+    return response;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int calls = bench::ParseIntArg(argc, argv, "--calls", 200);
+    double error_rate = bench::ParseIntArg(argc, argv, "--error-rate", 30) / 100.0;
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", READY_CHECK_PATH, {200, READY_CHECK_BODY});
+    server.SetResponse("GET", PHASE_PATH, {200, "\"ReadyCheck\""});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+    FakeLockfile lockfile;
+    lockfile.Write({server.GetPort(), server.GetAuthToken()});
+    std::printf("LCU stand-in on 127.0.0.1:%d\n\n", server.GetPort());
+
+    // Connected before any faults, which would fail the probe
+    Connection connection(lockfile);
+    if (!connection.Reconnect()) {
+        std::fprintf(stderr, "Failed to connect to the LCU stand-in\n");
+        return 1;
+    }
+
+    bool ok = true;
+
+    // A flaky client: error_rate of the requests answer 503
+    {
+        tools::MockFaults faults;
+        faults.error_rate = error_rate;
+        faults.error_status = 503;
+        server.SetFaults(faults);
+
+        bench::LatencySamples old_samples;
+        int old_failures = 0;
+        int old_attempts = 0;
+        for (int i = 0; i < calls; ++i) {
+            auto start = Clock::now();
+            old_failures += OldRetryLoop(connection, READY_CHECK_PATH, &old_attempts).IsSuccess() ? 0 : 1;
+            old_samples.Add(Clock::now() - start);
+        }
+
+        // Budget out of the way here; it has its own run below
+        core::RetryPolicyConfig config;
+        config.retry_budget = calls * OLD_ATTEMPTS;
+        core::RetryPolicy policy(config, 1);
+        bench::LatencySamples policy_samples;
+        int policy_failures = 0;
+        for (int i = 0; i < calls; ++i) {
+            auto start = Clock::now();
+            core::RetryResult result = policy.Execute(READY_CHECK_PATH, start + std::chrono::seconds(5),
+                                                      [&]() { return connection.Get(READY_CHECK_PATH); });
+            policy_samples.Add(Clock::now() - start);
+            policy_failures += result.IsSuccess() ? 0 : 1;
+        }
+
+        std::printf("%d calls, %.0f%% answered 503:\n", calls, error_rate * 100.0);
+        old_samples.Print("  fixed 100ms delay");
+        std::printf("    %d failed, %d attempts\n", old_failures, old_attempts);
+        policy_samples.Print("  jittered backoff from 25ms");
+        std::printf("    %d failed, %llu attempts\n\n", policy_failures,
+                    static_cast<unsigned long long>(policy.GetStats().attempts));
+    }
+
+    // A ready check about to expire while the client answers nothing but 503
+    {
+        tools::MockFaults faults;
+        faults.error_rate = 1.0;
+        faults.error_status = 503;
+        server.SetFaults(faults);
+
+        core::RetryPolicy policy;
+
+        std::printf("ready check expiring, every request answered 503:\n");
+        for (int remaining_ms : {0, 20, 60, 150, 400}) {
+            auto start = Clock::now();
+            OldRetryLoop(connection, READY_CHECK_PATH);
+            double old_ms = Millis(Clock::now() - start);
+
+            int late_attempts = 0;
+            start = Clock::now();
+            auto deadline = start + std::chrono::milliseconds(remaining_ms);
+            core::RetryResult result = policy.Execute(READY_CHECK_PATH, deadline, [&]() {
+                late_attempts += Clock::now() >= deadline ? 1 : 0;
+                return connection.Get(READY_CHECK_PATH);
+            });
+            double policy_ms = Millis(Clock::now() - start);
+
+            std::printf("  %3dms left: old loop gave up after %6.1fms; policy after %6.1fms, %d attempts (%s), "
+                        "%d started late\n",
+                        remaining_ms, old_ms, policy_ms, result.attempts, core::RetryOutcomeToString(result.outcome),
+                        late_attempts);
+            ok = ok && late_attempts == 0 && (remaining_ms > 0 || result.attempts == 0);
+        }
+        std::printf("\n");
+    }
+
+    // A client that never answers: the budget caps the extra load
+    {
+
+        core::RetryPolicyConfig config;
+        config.initial_backoff = std::chrono::milliseconds(1);
+        config.max_backoff = std::chrono::milliseconds(2);
+        core::RetryPolicy policy(config);
+
+        int served = server.GetRequestCount();
+        auto start = Clock::now();
+        int budget_exhausted = 0;
+        for (int i = 0; i < calls; ++i) {
+            core::RetryResult result = policy.Execute(READY_CHECK_PATH, Clock::now() + std::chrono::seconds(1),
+                                                      [&]() { return connection.Get(READY_CHECK_PATH); });
+            budget_exhausted += result.outcome == core::RetryOutcome::BUDGET_EXHAUSTED ? 1 : 0;
+        }
+        auto elapsed = Clock::now() - start;
+        int sent = server.GetRequestCount() - served;
+        int retries = sent - calls;
+        // The full budget plus what refilled while the calls ran
+        double refill = std::chrono::duration<double>(elapsed).count() /
+                        std::chrono::duration<double>(config.budget_window).count() * config.retry_budget;
+        int allowed = config.retry_budget + static_cast<int>(refill) + 1;
+        std::printf("%d calls, all answered 503: %d requests (%d retries, budget %d + %.1f refilled), "
+                    "%d calls failed fast on the budget\n",
+                    calls, sent, retries, config.retry_budget, refill, budget_exhausted);
+        std::printf("  old loop would have sent %d requests\n\n", calls * OLD_ATTEMPTS);
+        ok = ok && retries <= allowed && budget_exhausted > 0;
+    }
+    server.SetFaults(tools::MockFaults());
+
+    // Client restart: it goes away, a new one comes up on another port and
+    // answers slowly while it boots. Calls get 100ms each.
+    {
+        const auto deadline = std::chrono::milliseconds(100);
+        const auto down_for = std::chrono::milliseconds(100);
+        const auto boot_for = std::chrono::milliseconds(200);
+
+        for (bool background : {false, true}) {
+            tools::LCUMockServer old_client;
+            old_client.SetResponse("GET", READY_CHECK_PATH, {200, READY_CHECK_BODY});
+            old_client.SetResponse("GET", PHASE_PATH, {200, "\"ReadyCheck\""});
+            old_client.Start();
+            lockfile.Write({old_client.GetPort(), old_client.GetAuthToken()});
+
+            Connection connection(lockfile);
+            connection.Reconnect();
+            core::RetryPolicyConfig config;
+            config.retry_budget = 1000;
+            core::RetryPolicy policy(config);
+            core::RetryWaiter waiter;
+            core::BackgroundReconnector reconnector([&connection]() { return connection.Reconnect(); }, &waiter);
+
+            old_client.Stop();
+            lockfile.Write({});
+            auto went_down = Clock::now();
+
+            tools::LCUMockServer new_client;
+            std::thread restart([&]() {
+                std::this_thread::sleep_until(went_down + down_for);
+                tools::MockFaults booting;
+                booting.latency = boot_for;
+                new_client.SetFaults(booting);
+                new_client.SetResponse("GET", READY_CHECK_PATH, {200, READY_CHECK_BODY});
+                new_client.SetResponse("GET", PHASE_PATH, {200, "\"ReadyCheck\""});
+                new_client.Start();
+                lockfile.Write({new_client.GetPort(), new_client.GetAuthToken()});
+                std::this_thread::sleep_until(went_down + down_for + boot_for);
+                new_client.SetFaults(tools::MockFaults());
+            });
+
+            bench::LatencySamples samples;
+            double back_after_ms = -1.0;
+            while (back_after_ms < 0.0 && Clock::now() - went_down < std::chrono::seconds(3)) {
+                auto start = Clock::now();
+                bool success;
+                if (background) {
+                    success = policy.Execute(PHASE_PATH, start + deadline,
+                                             [&]() { return connection.Get(PHASE_PATH); }, &waiter,
+                                             [&](const core::HttpResponse& response) {
+                                                 if (response.IsTransportError()) reconnector.Request();
+                                             }).IsSuccess();
+                } else {
+                    success = OldRetryLoop(connection, PHASE_PATH).IsSuccess();
+                }
+                samples.Add(Clock::now() - start);
+                if (success) {
+                    back_after_ms = Millis(Clock::now() - went_down);
+                }
+            }
+            restart.join();
+            reconnector.Stop();
+            new_client.Stop();
+
+            double longest_ms = samples.PercentileMicros(100) / 1000.0;
+            std::printf("client restart, %s: back %.1fms after it went down (%.0fms down + %.0fms booting), "
+                        "longest call %.1fms\n",
+                        background ? "background reconnect" : "inline reconnect", back_after_ms,
+                        Millis(down_for), Millis(boot_for), longest_ms);
+            if (background) {
+                // An attempt in flight at the deadline may finish; a reconnect never holds a call
+                ok = ok && back_after_ms > 0.0 && longest_ms < Millis(deadline) + 50.0 &&
+                     reconnector.GetSuccessCount() >= 1;
+            }
+        }
+    }
+
+    server.Stop();
+    if (!ok) {
+        std::fprintf(stderr, "retry policy check failed\n");
+        return 1;
+    }
+    return 0;
+}
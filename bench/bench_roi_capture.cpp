@@ -0,0 +1,154 @@
+// UI fallback capture on recorded screens: a fresh full-screen frame per
+// detection, as UIAutomation used to take, versus the Accept button region
+// of the client window captured into a reused frame and hashed. A queue
+// wait is played back with a clock ticking outside the region, then the
+// ready check. Exits 1 if the region or its change detection is wrong.
+//
+//   bench_roi_capture [--passes N] [--screen-width N] [--screen-height N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/image_file_capture_source.h"
+#include "league_auto_accept/core/roi_capture.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+using namespace league_auto_accept;
+
+namespace {
+
+void FillRect(core::Frame& frame, const core::CaptureRect& rect, uint8_t blue, uint8_t green, uint8_t red) {
+    for (int y = rect.y; y < rect.y + rect.height; ++y) {
+        uint8_t* pixel = frame.Row(y) + static_cast<size_t>(rect.x) * core::Frame::BYTES_PER_PIXEL;
+        for (int x = 0; x < rect.width; ++x, pixel += core::Frame::BYTES_PER_PIXEL) {
+            pixel[0] = blue;
+            pixel[1] = green;
+            pixel[2] = red;
+        }
+    }
+}
+
+// A desktop with the client window and, optionally, the ready-check button;
+// `clock` changes a small area in the screen's corner
+core::Frame MakeScreen(int width, int height, const core::CaptureRect& client, bool ready_check, int clock) {
+    core::Frame screen;
+    screen.Resize(width, height);
+    uint32_t noise = 12345;
+    for (int y = 0; y < height; ++y) {
+        uint8_t* row = screen.Row(y);
+        for (size_t i = 0; i < static_cast<size_t>(width) * core::Frame::BYTES_PER_PIXEL; ++i) {
+            noise = noise * 1103515245u + 12345u;
+            row[i] = static_cast<uint8_t>(noise >> 24);
+        }
+    }
+    FillRect(screen, client, 30, 24, 16);
+    FillRect(screen, {width - 80, height - 30, 10 + clock % 60, 20}, 240, 240, 240);
+    if (ready_check) {
+        core::CaptureRect button = {client.x + client.width * 43 / 100, client.y + client.height * 74 / 100,
+                                    client.width * 14 / 100, client.height * 6 / 100};
+        FillRect(screen, button, 100, 150, 100);
+    }
+    return screen;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int passes = bench::ParseIntArg(argc, argv, "--passes", 400);
+    int screen_width = bench::ParseIntArg(argc, argv, "--screen-width", 1920);
+    int screen_height = bench::ParseIntArg(argc, argv, "--screen-height", 1080);
+    core::CaptureRect client = {(screen_width - 1280) / 2, (screen_height - 720) / 2, 1280, 720};
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                      ("laa_capture_bench_" + std::to_string(std::rand()));
+    std::filesystem::create_directories(directory);
+
+    // 0 and 1: queue wait, the clock moved; 2 and 3: ready check, clock moved
+    core::ImageFileCaptureSource source;
+    bool ok = true;
+    for (int i = 0; i < 4; ++i) {
+        std::string path = (directory / ("screen" + std::to_string(i) + ".ppm")).string();
+        ok = ok && core::WritePpmImage(path, MakeScreen(screen_width, screen_height, client, i >= 2, i)) &&
+             source.AddImage(path);
+    }
+    std::filesystem::remove_all(directory);
+    if (!ok) {
+        std::fprintf(stderr, "cannot record screens: %s\n", source.GetLastError().c_str());
+        return 1;
+    }
+
+    core::RoiCapture roi(source);
+    core::CaptureRect rect = roi.ComputeRect(client);
+    std::printf("Screen %dx%d, client %dx%d at %d,%d, Accept region %dx%d at %d,%d, %d passes\n\n",
+                screen_width, screen_height, client.width, client.height, client.x, client.y,
+                rect.width, rect.height, rect.x, rect.y, passes);
+
+    // Queue wait for three quarters of the passes, then the ready check
+    auto image_for_pass = [passes](int pass) { return (pass < passes * 3 / 4 ? 0 : 2) + pass % 2; };
+
+    bench::LatencySamples full_samples;
+    size_t full_matches = 0;
+    core::CaptureRect screen = source.GetScreenBounds();
+    for (int pass = 0; pass < passes; ++pass) {
+        source.SetCurrentIndex(static_cast<size_t>(image_for_pass(pass)));
+        auto start = std::chrono::steady_clock::now();
+        core::Frame frame;   // Allocated per detection, like cv::Mat::zeros was
+        ok = source.Capture(screen, frame) && ok;
+        full_samples.Add(std::chrono::steady_clock::now() - start);
+        full_matches++;   // Every frame went to the matcher
+    }
+
+    bench::LatencySamples roi_samples;
+    size_t roi_matches = 0;
+    const uint8_t* first_buffer = nullptr;
+    bool buffer_reused = true;
+    for (int pass = 0; pass < passes; ++pass) {
+        source.SetCurrentIndex(static_cast<size_t>(image_for_pass(pass)));
+        auto start = std::chrono::steady_clock::now();
+        core::RoiCapture::Result result = roi.Capture(client);
+        roi_samples.Add(std::chrono::steady_clock::now() - start);
+        ok = ok && result.captured;
+        if (result.changed) roi_matches++;
+
+        if (!first_buffer) first_buffer = roi.GetFrame().pixels.data();
+        buffer_reused = buffer_reused && roi.GetFrame().pixels.data() == first_buffer;
+    }
+
+    full_samples.Print("full screen, new frame");
+    std::printf("  %zu of %d frames matched, %.1f MB captured per pass\n", full_matches, passes,
+                static_cast<double>(screen.width) * screen.height * 3 / (1024.0 * 1024.0));
+    roi_samples.Print("Accept region, reused frame + hash");
+    std::printf("  %zu of %d frames matched, %.1f KB captured per pass, buffer %s\n\n", roi_matches, passes,
+                static_cast<double>(rect.width) * rect.height * 3 / 1024.0, buffer_reused ? "reused" : "REALLOCATED");
+
+    // Only the first capture and the switch to the ready check need a match
+    ok = ok && buffer_reused && roi_matches == 2;
+
+    // A change outside the region is not a change; one inside is
+    core::RoiCapture check(source);
+    source.SetCurrentIndex(0);
+    bool first_changed = check.Capture(client).changed;
+    source.SetCurrentIndex(1);
+    bool clock_changed = check.Capture(client).changed;
+    source.SetCurrentIndex(2);
+    bool button_changed = check.Capture(client).changed;
+    check.Invalidate();
+    bool invalidated_changed = check.Capture(client).changed;
+    bool changes_ok = first_changed && !clock_changed && button_changed && invalidated_changed;
+
+    // The region keeps to the window and the screen
+    core::CaptureRect off_screen = {screen_width - 700, 0, 1280, 720};
+    core::CaptureRect clipped = check.ComputeRect(off_screen);
+    bool clip_ok = !clipped.IsEmpty() && clipped.Intersect(screen) == clipped &&
+                   check.ComputeRect({screen_width + 10, 0, 1280, 720}).IsEmpty() &&
+                   !check.Capture({screen_width + 10, 0, 1280, 720}).captured;
+
+    std::printf("change detection %s, clipping %s\n", changes_ok ? "correct" : "WRONG", clip_ok ? "correct" : "WRONG");
+    ok = ok && changes_ok && clip_ok;
+
+    if (!ok) {
+        std::fprintf(stderr, "ROI capture returned wrong results\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,289 @@
+// Accept button detection on recorded client screenshots at 1080p, 1440p and
+// 4K: the pyramid matcher with cached scaled templates versus resizing the
+// template for every scale and searching the whole region at full
+// resolution, as UIAutomation::PerformMultiScaleMatching did. Half of the
+// screens show the ready check, drawn up to 3% off the expected scale; the
+// other half do not. Exits 1 if the pyramid matcher misses a button,
+// finds one that is not there, or reports it more than a few pixels off.
+//
+//   bench_template_matcher [--frames N] [--baseline-frames N]
+
+#include "bench_common.h"
+#include "league_auto_accept/core/image_file_capture_source.h"
+#include "league_auto_accept/core/roi_capture.h"
+#include "league_auto_accept/core/template_matcher.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+
+using namespace league_auto_accept;
+
+namespace {
+
+// Client layout the template was taken from
+constexpr int BASE_CLIENT_WIDTH = 1280;
+constexpr int BUTTON_WIDTH = 180;
+constexpr int BUTTON_HEIGHT = 44;
+constexpr int POSITION_TOLERANCE = 4;
+
+struct Resolution {
+    const char* name;
+    int screen_width;
+    int screen_height;
+    int client_width;   // The client keeps 16:9
+};
+
+constexpr Resolution RESOLUTIONS[] = {
+    {"1080p", 1920, 1080, 1600},
+    {"1440p", 2560, 1440, 1920},
+    {"4K", 3840, 2160, 2560},
+};
+
+class Random {
+public:
+    explicit Random(uint32_t seed) : state_(seed) {}
+    uint32_t Next() {
+        state_ = state_ * 1103515245u + 12345u;
+        return state_ >> 8;
+    }
+    double Uniform(double low, double high) { return low + (high - low) * (Next() % 10001) / 10000.0; }
+
+private:
+    uint32_t state_;
+};
+
+void FillRect(core::Frame& frame, int x, int y, int width, int height, int blue, int green, int red) {
+    for (int row = std::max(y, 0); row < std::min(y + height, frame.height); ++row) {
+        uint8_t* pixel = frame.Row(row);
+        for (int column = std::max(x, 0); column < std::min(x + width, frame.width); ++column) {
+            pixel[column * 3] = static_cast<uint8_t>(blue);
+            pixel[column * 3 + 1] = static_cast<uint8_t>(green);
+            pixel[column * 3 + 2] = static_cast<uint8_t>(red);
+        }
+    }
+}
+
+// The ready-check Accept button, drawn (not resized) at `scale`
+void DrawButton(core::Frame& frame, int x, int y, double scale) {
+    int width = static_cast<int>(std::lround(BUTTON_WIDTH * scale));
+    int height = static_cast<int>(std::lround(BUTTON_HEIGHT * scale));
+    for (int row = 0; row < height; ++row) {
+        FillRect(frame, x, y + row, width, 1, 90 - 30 * row / height, 110 - 30 * row / height, 30);
+    }
+    int border = std::max(1, static_cast<int>(std::lround(2 * scale)));
+    FillRect(frame, x, y, width, border, 160, 200, 140);
+    FillRect(frame, x, y + height - border, width, border, 160, 200, 140);
+    FillRect(frame, x, y, border, height, 160, 200, 140);
+    FillRect(frame, x + width - border, y, border, height, 160, 200, 140);
+
+    // "ACCEPT": six letter-sized blocks, each with its own cut-out
+    int letter_width = static_cast<int>(std::lround(14 * scale));
+    int letter_height = static_cast<int>(std::lround(16 * scale));
+    int spacing = static_cast<int>(std::lround(20 * scale));
+    int text_x = x + (width - 5 * spacing - letter_width) / 2;
+    int text_y = y + (height - letter_height) / 2;
+    for (int letter = 0; letter < 6; ++letter) {
+        int left = text_x + letter * spacing;
+        FillRect(frame, left, text_y, letter_width, letter_height, 230, 240, 220);
+        int cut = std::max(1, letter_width / 3);
+        FillRect(frame, left + (letter % 3) * cut, text_y + (letter % 2 + 1) * letter_height / 4, cut,
+                 letter_height / 3, 75, 95, 30);
+    }
+}
+
+core::Frame MakeTemplate() {
+    core::Frame image;
+    image.Resize(BUTTON_WIDTH, BUTTON_HEIGHT);
+    DrawButton(image, 0, 0, 1.0);
+    return image;
+}
+
+struct Screen {
+    core::Frame pixels;
+    core::CaptureRect client;
+    bool ready_check = false;
+    int button_x = 0;   // Screen coordinates of the drawn button
+    int button_y = 0;
+    int button_width = 0;
+    int button_height = 0;
+};
+
+Screen MakeScreen(const Resolution& resolution, bool ready_check, Random& random) {
+    Screen screen;
+    screen.ready_check = ready_check;
+    screen.pixels.Resize(resolution.screen_width, resolution.screen_height);
+    for (int y = 0; y < screen.pixels.height; ++y) {
+        uint8_t* row = screen.pixels.Row(y);
+        for (int x = 0; x < screen.pixels.width * 3; ++x) {
+            row[x] = static_cast<uint8_t>(40 + random.Next() % 24);
+        }
+    }
+
+    int client_height = resolution.client_width * 9 / 16;
+    screen.client = {(resolution.screen_width - resolution.client_width) / 2,
+                     (resolution.screen_height - client_height) / 2, resolution.client_width, client_height};
+    const core::CaptureRect& client = screen.client;
+    double client_scale = static_cast<double>(client.width) / BASE_CLIENT_WIDTH;
+    for (int y = client.y; y < client.y + client.height; ++y) {
+        uint8_t* pixel = screen.pixels.Row(y) + client.x * 3;
+        for (int x = 0; x < client.width; ++x, pixel += 3) {
+            int noise = static_cast<int>(random.Next() % 12);
+            pixel[0] = static_cast<uint8_t>(28 + noise + 20 * (y - client.y) / client.height);
+            pixel[1] = static_cast<uint8_t>(20 + noise);
+            pixel[2] = static_cast<uint8_t>(12 + noise);
+        }
+    }
+
+    // Panels the region also covers outside a ready check
+    for (int panel = 0; panel < 6; ++panel) {
+        FillRect(screen.pixels, client.x + static_cast<int>(random.Next() % static_cast<uint32_t>(client.width)),
+                 client.y + client.height * 60 / 100 + static_cast<int>(random.Next() % (client.height / 4u)),
+                 static_cast<int>(client.width * random.Uniform(0.02, 0.12)),
+                 static_cast<int>(client.height * random.Uniform(0.01, 0.05)), 60 + random.Next() % 120,
+                 60 + random.Next() % 120, 60 + random.Next() % 120);
+    }
+
+    if (ready_check) {
+        // DPI rounding and layout drift move and scale the button a little
+        double scale = client_scale * random.Uniform(0.97, 1.03);
+        screen.button_x = client.x + client.width * 43 / 100 + static_cast<int>(random.Next() % 41) - 20;
+        screen.button_y = client.y + client.height * 74 / 100 + static_cast<int>(random.Next() % 21) - 10;
+        screen.button_width = static_cast<int>(std::lround(BUTTON_WIDTH * scale));
+        screen.button_height = static_cast<int>(std::lround(BUTTON_HEIGHT * scale));
+        DrawButton(screen.pixels, screen.button_x, screen.button_y, scale);
+    }
+    return screen;
+}
+
+// The old detection: resize per scale, search every full-resolution position
+core::PyramidTemplateMatcher::Match FindExhaustive(const core::Frame& region, const core::GrayImage& templ,
+                                                    const core::PyramidMatchSettings& settings,
+                                                    double scale_factor) {
+    core::PyramidTemplateMatcher::Match best;
+    core::GrayImage image;
+    core::ConvertToGray(region, image);
+    image.ComputeSums();
+
+    for (double scale = settings.min_scale; scale <= settings.max_scale + 1e-6; scale += settings.scale_step) {
+        core::GrayImage scaled;
+        core::ResizeGray(templ, static_cast<int>(std::lround(templ.width * scale * scale_factor)),
+                         static_cast<int>(std::lround(templ.height * scale * scale_factor)), scaled);
+        core::TemplateLevel level;
+        level.Build(scaled);
+        for (int y = 0; y + level.height <= image.height; ++y) {
+            for (int x = 0; x + level.width <= image.width; ++x) {
+                double score = core::CorrelationAt(image, level, x, y);
+                if (score > best.confidence) {
+                    best = {false, score, x, y, level.width, level.height, scale * scale_factor};
+                }
+            }
+        }
+    }
+    best.found = best.confidence >= settings.threshold;
+    return best;
+}
+
+bool MatchesScreen(const core::PyramidTemplateMatcher::Match& match, const Screen& screen,
+                   const core::CaptureRect& region) {
+    if (!screen.ready_check) {
+        return !match.found;
+    }
+    // Centres: a neighbouring scale matches a few pixels off at the corner
+    int match_center_x = region.x + match.x + match.width / 2;
+    int match_center_y = region.y + match.y + match.height / 2;
+    return match.found && std::abs(match_center_x - (screen.button_x + screen.button_width / 2)) <= POSITION_TOLERANCE &&
+           std::abs(match_center_y - (screen.button_y + screen.button_height / 2)) <= POSITION_TOLERANCE;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int frames = bench::ParseIntArg(argc, argv, "--frames", 10);
+    int baseline_frames = bench::ParseIntArg(argc, argv, "--baseline-frames", 1);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() /
+                                      ("laa_matcher_bench_" + std::to_string(std::rand()));
+    std::filesystem::create_directories(directory);
+
+    core::Frame button = MakeTemplate();
+    core::GrayImage template_gray;
+    core::ConvertToGray(button, template_gray);
+    core::PyramidMatchSettings settings;
+
+    std::printf("%d screens per resolution (half with a ready check), %d exhaustive\n\n", frames, baseline_frames);
+
+    bool ok = true;
+    Random random(2024);
+    for (const Resolution& resolution : RESOLUTIONS) {
+        core::PyramidTemplateMatcher matcher(settings);
+        matcher.SetTemplate(button);
+        matcher.SetScaleFactor(static_cast<double>(resolution.client_width) / BASE_CLIENT_WIDTH);
+
+        bench::LatencySamples pyramid_samples;
+        bench::LatencySamples exhaustive_samples;
+        int ready_frames = 0;
+        int hits = 0;
+        int false_positives = 0;
+        int exhaustive_correct = 0;
+        core::CaptureRect region;
+
+        for (int i = 0; i < frames; ++i) {
+            // Recorded and played back like any other capture
+            Screen screen = MakeScreen(resolution, i % 2 == 0, random);
+            std::string path = (directory / "screen.ppm").string();
+            core::ImageFileCaptureSource source;
+            if (!core::WritePpmImage(path, screen.pixels) || !source.AddImage(path)) {
+                std::fprintf(stderr, "cannot record screen: %s\n", source.GetLastError().c_str());
+                return 1;
+            }
+            core::RoiCapture capture(source);
+
+            core::RoiCapture::Result captured = capture.Capture(screen.client);
+            auto start = std::chrono::steady_clock::now();
+            core::PyramidTemplateMatcher::Match match = matcher.Find(capture.GetFrame());
+            pyramid_samples.Add(std::chrono::steady_clock::now() - start);
+            region = captured.rect;
+
+            ready_frames += screen.ready_check ? 1 : 0;
+            if (MatchesScreen(match, screen, region)) {
+                hits += screen.ready_check ? 1 : 0;
+            } else {
+                ok = false;
+                false_positives += screen.ready_check ? 0 : 1;
+            }
+
+            if (i < baseline_frames) {
+                start = std::chrono::steady_clock::now();
+                core::PyramidTemplateMatcher::Match exhaustive =
+                    FindExhaustive(capture.GetFrame(), template_gray, settings, matcher.GetScaleFactor());
+                exhaustive_samples.Add(std::chrono::steady_clock::now() - start);
+                exhaustive_correct += MatchesScreen(exhaustive, screen, region) ? 1 : 0;
+            }
+        }
+
+        const core::PyramidTemplateMatcher::Stats& stats = matcher.GetStats();
+        std::printf("%s: client %dx%d, region %dx%d, %zu scales, %d pyramid levels, template sets built %llu\n",
+                    resolution.name, resolution.client_width, resolution.client_width * 9 / 16, region.width,
+                    region.height, matcher.GetScaleCount(), matcher.GetPyramidLevels(),
+                    static_cast<unsigned long long>(stats.template_builds));
+        pyramid_samples.Print("  pyramid, cached templates");
+        std::printf("    hit rate %d/%d, false positives %d/%d, %llu coarse + %llu refined positions per frame\n",
+                    hits, ready_frames, false_positives, frames - ready_frames,
+                    static_cast<unsigned long long>(stats.coarse_positions / static_cast<uint64_t>(frames)),
+                    static_cast<unsigned long long>(stats.refined_positions / static_cast<uint64_t>(frames)));
+        if (exhaustive_samples.Count() > 0) {
+            exhaustive_samples.Print("  resize per scale, exhaustive");
+            std::printf("    %d/%zu correct\n", exhaustive_correct, exhaustive_samples.Count());
+        }
+        std::printf("\n");
+        ok = ok && stats.template_builds == 1;
+    }
+    std::filesystem::remove_all(directory);
+
+    if (!ok) {
+        std::fprintf(stderr, "pyramid matcher returned wrong results\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+// Measures per-poll latency of the gameflow GET against the local LCU stand-in:
+// a fresh session per request (old GUI behaviour) versus the keep-alive session.
+
+#include "bench_common.h"
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <csignal>
+#include <cstdio>
+
+using namespace league_auto_accept;
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+
+    int iterations = bench::ParseIntArg(argc, argv, "--iterations", 500);
+
+    tools::LCUMockServer server;
+    server.SetResponse("GET", "/lol-gameflow/v1/gameflow-phase", {200, "\"Matchmaking\""});
+    if (!server.Start()) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    core::LCUCredentials credentials{server.GetPort(), server.GetAuthToken()};
+    std::printf("LCU stand-in on 127.0.0.1:%d, %d polls per mode\n\n", server.GetPort(), iterations);
+
+    // Per-request session: handshake on every poll
+    bench::LatencySamples cold;
+    int cold_failures = 0;
+    int handshakes_before = server.GetHandshakeCount();
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        core::LCUSession session(core::CreatePlatformTransport());
+        session.UpdateCredentials(credentials);
+        core::HttpResponse response = session.Get("/lol-gameflow/v1/gameflow-phase");
+        cold.Add(std::chrono::steady_clock::now() - start);
+        if (!response.IsSuccess()) cold_failures++;
+    }
+    int cold_handshakes = server.GetHandshakeCount() - handshakes_before;
+
+    // Keep-alive session reused across polls
+    bench::LatencySamples warm;
+    int warm_failures = 0;
+    handshakes_before = server.GetHandshakeCount();
+    core::LCUSession session(core::CreatePlatformTransport());
+    session.UpdateCredentials(credentials);
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        core::HttpResponse response = session.Get("/lol-gameflow/v1/gameflow-phase");
+        warm.Add(std::chrono::steady_clock::now() - start);
+        if (!response.IsSuccess()) warm_failures++;
+    }
+    int warm_handshakes = server.GetHandshakeCount() - handshakes_before;
+
+    cold.Print("per-request session");
+    warm.Print("keep-alive session");
+    std::printf("\nTLS handshakes: per-request=%d keep-alive=%d\n", cold_handshakes, warm_handshakes);
+    std::printf("Failures:       per-request=%d keep-alive=%d\n", cold_failures, warm_failures);
+    if (warm.PercentileMicros(50) > 0.0) {
+        std::printf("p50 speedup:    %.1fx\n", cold.PercentileMicros(50) / warm.PercentileMicros(50));
+    }
+
+    server.Stop();
+    return (cold_failures == 0 && warm_failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+struct AcceptSchedulerConfig {
+    // A path is only started when its estimate plus a margin ends before
+    // the deadline. The margin is this share of the estimate, as a slow
+    // path varies by more, within the bounds below.
+    double safety_factor = 0.25;
+    std::chrono::milliseconds min_safety_margin{2};
+    std::chrono::milliseconds max_safety_margin{100};
+    // Weight of the latest run in a path's duration estimate
+    double estimate_weight = 0.25;
+};
+
+// When a ready check whose `timer` (seconds since it popped) was read at
+// `read_at` is dropped by the client
+std::chrono::steady_clock::time_point GetReadyCheckDeadline(double timer,
+                                                            std::chrono::steady_clock::time_point read_at);
+
+struct ScheduledAccept {
+    bool accepted = false;
+    const char* path = nullptr;        // Name of the path that accepted
+    int started = 0;                   // Paths run
+    int skipped = 0;                   // Paths not started: they could not finish in time
+    bool deadline_missed = false;      // Not accepted, and time ran out rather than paths
+    std::chrono::microseconds elapsed{0};
+};
+
+// Runs the ways of accepting a ready check (LCU POST, clicking the button)
+// against the moment the client drops it. Paths go fastest first by their
+// measured duration; a path whose estimate would end past the deadline is
+// not started, so a slow fallback cannot hold the loop beyond the ready
+// check. Each path gets the deadline to bound its own work.
+//
+// Not thread-safe; owned by the thread that accepts.
+class AcceptScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+    // True when it accepted the ready check
+    using PathFunction = std::function<bool(Clock::time_point deadline)>;
+
+    struct Stats {
+        uint64_t runs = 0;
+        uint64_t accepted = 0;
+        uint64_t deadline_misses = 0;
+        uint64_t skipped_paths = 0;
+    };
+
+    // Throws std::invalid_argument for a negative factor or margin, a
+    // minimum margin above the maximum, or a weight outside (0, 1]
+    explicit AcceptScheduler(const AcceptSchedulerConfig& config = AcceptSchedulerConfig());
+
+    // `initial_estimate` stands in for the duration until the path has
+    // run; returns the path's index
+    size_t AddPath(const char* name, std::chrono::microseconds initial_estimate, PathFunction run);
+    // A path that cannot run right now, e.g. the LCU while disconnected
+    void SetPathEnabled(size_t path, bool enabled);
+
+    ScheduledAccept Run(Clock::time_point deadline);
+
+    std::chrono::microseconds GetEstimate(size_t path) const;
+    // Time the path needs left, beyond its estimate, to be started
+    std::chrono::microseconds GetSafetyMargin(size_t path) const;
+    const Stats& GetStats() const { return stats_; }
+    void ResetStats();
+
+private:
+    struct Path {
+        const char* name;
+        std::chrono::microseconds estimate;
+        PathFunction run;
+        bool enabled;
+    };
+
+    std::chrono::microseconds GetSafetyMargin(const Path& path) const;
+
+    AcceptSchedulerConfig config_;
+    std::vector<Path> paths_;
+    std::vector<size_t> order_;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
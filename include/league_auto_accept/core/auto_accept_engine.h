@@ -0,0 +1,186 @@
+#pragma once
+
+#include "league_auto_accept/core/cycle_arena.h"
+#include "league_auto_accept/core/deadline_ticker.h"
+#include "league_auto_accept/core/lcu_event_listener.h"
+#include "league_auto_accept/core/lcu_health.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/lockfile_watcher.h"
+#include "league_auto_accept/core/poll_scheduler.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace league_auto_accept {
+
+namespace models {
+class PerformanceMetrics;
+}
+
+namespace core {
+
+struct EngineConfig {
+    // Poll intervals per gameflow phase while the event stream is down
+    PollSchedule poll_schedule;
+    std::chrono::milliseconds request_timeout{5000};
+    // Empty: GetDefaultLockfilePaths()
+    std::vector<std::string> lockfile_paths;
+    // Raises the detection thread's priority in Matchmaking and ReadyCheck,
+    // so a busy machine does not delay the passes that can see a ready check
+    bool elevate_priority_in_queue = false;
+    // When polls stop reaching the client and how often to probe it then
+    LCUHealthConfig health;
+    // Arena for the strings a pass builds and drops (log lines, unknown
+    // phase names), released in one go at the start of the next pass. 0
+    // puts them on the heap.
+    size_t cycle_arena_size = 4096;
+};
+
+// The ready-check detection loop shared by every front-end.
+//
+// Each pass finds the client through its (watched, cached) lockfile, takes the gameflow phase
+// from a pushed LCU event (or polls it while the event stream is down, at the
+// interval the poll schedule gives for that phase), and accepts a ready check
+// once per ready-check phase. Polls run on a DeadlineTicker grid, so the time a
+// request takes does not stretch the interval. In Matchmaking the accept POST
+// is prepared and its connection kept open ahead of the ready check. Polls
+// go through a circuit breaker per endpoint: a client that stops answering is
+// only probed at a slow cadence, and only breaker changes are logged.
+// Whatever a pass builds only for itself lives in a per-pass arena, so a
+// steady-state pass does not touch the heap.
+// Front-ends only render what the callbacks report.
+class AutoAcceptEngine {
+public:
+    // The line is only valid during the call
+    using LogCallback = std::function<void(std::string_view message)>;
+    using PhaseCallback = std::function<void(const std::string& phase)>;
+    using AcceptCallback = std::function<void(const AcceptResult& result)>;
+
+    explicit AutoAcceptEngine(const EngineConfig& config = EngineConfig(),
+                              std::shared_ptr<models::PerformanceMetrics> metrics = nullptr);
+    // Injects the transport and event stream, e.g. to drive a stand-in server
+    AutoAcceptEngine(const EngineConfig& config,
+                     std::unique_ptr<LCUTransport> transport,
+                     std::unique_ptr<LCUEventStream> event_stream,
+                     std::shared_ptr<models::PerformanceMetrics> metrics = nullptr);
+    ~AutoAcceptEngine();
+
+    AutoAcceptEngine(const AutoAcceptEngine&) = delete;
+    AutoAcceptEngine& operator=(const AutoAcceptEngine&) = delete;
+
+    // Callbacks run on the detection thread; set them before Start()
+    void SetLogCallback(LogCallback callback);
+    void SetPhaseCallback(PhaseCallback callback);
+    void SetAcceptCallback(AcceptCallback callback);
+
+    // Runs the detection loop on its own thread; false if already running
+    bool Start();
+    // Wakes the loop and joins it
+    void Stop();
+    bool IsRunning() const;
+
+    // A single detection pass without waiting, for callers that drive the
+    // loop themselves. Must not be mixed with Start().
+    void RunOnce();
+
+    void SetAutoAcceptEnabled(bool enabled);
+    bool IsAutoAcceptEnabled() const;
+
+    bool IsClientConnected() const;
+    bool IsEventStreamConnected() const;
+    std::string GetCurrentPhase() const;
+    std::shared_ptr<models::PerformanceMetrics> GetMetrics() const;
+    // Poll and requests-saved counters of the adaptive schedule
+    const PollScheduler& GetPollScheduler() const;
+    // Breaker state, success rate and latency of each polled endpoint
+    const LCUHealthMonitor& GetHealth() const;
+
+private:
+    void DetectionLoop();
+    void RunPass(const LCUEvent* pushed_event);
+    std::chrono::milliseconds GetWaitInterval();
+    // Waits for a pushed event or the ticker's next deadline
+    bool WaitForNextPass(DeadlineTicker& ticker, LCUEvent& pushed_event);
+    void UpdateThreadPriority();
+    bool UpdateConnection();
+    // `wire_name` is only read for phases this build does not know
+    void HandlePhase(models::GameflowPhase phase, std::string_view wire_name,
+                     std::chrono::steady_clock::time_point detected_at);
+    // False when the phase could not be read; `unknown_name` is only set
+    // for UNKNOWN
+    bool PollGameflowPhase(models::GameflowPhase& phase, std::pmr::string& unknown_name);
+    // A GET through the endpoint's breaker; a refused request answers with
+    // status 0 and sends nothing. The body is only valid until the next
+    // request on session_.
+    HttpResponseView GetThroughBreaker(LCUEndpointId endpoint);
+    bool CheckForReadyCheckAlternatives();
+    void AcceptReadyCheck(std::chrono::steady_clock::time_point detected_at, const char* detection_method);
+    // Prepares the accept POST and checks the connection if it sat idle
+    void PrewarmAccept(bool entered_queue);
+    void Log(std::string_view message);
+    // Joins `parts` into one line in the pass's arena
+    void Log(std::initializer_list<std::string_view> parts);
+
+    EngineConfig config_;
+    std::shared_ptr<models::PerformanceMetrics> metrics_;
+    PollScheduler poll_scheduler_;
+
+    // Re-reads the lockfile only when the file system reports a change to it
+    LockfileWatcher lockfile_watcher_;
+
+    // Keep-alive connection reused by every poll; rebuilt only when the lockfile changes
+    LCUSession session_;
+    // Breakers of the polled endpoints; reset for every new client
+    LCUHealthMonitor health_;
+    // Fires the accept POST first and remembers which endpoint this client build answers
+    ReadyCheckAcceptor acceptor_;
+    // Pushed gameflow / ready-check events; polling is only the fallback while it is down
+    LCUEventListener event_listener_;
+
+    LogCallback log_callback_;
+    PhaseCallback phase_callback_;
+    AcceptCallback accept_callback_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> auto_accept_enabled_;
+    std::atomic<bool> client_connected_;
+    std::thread detection_thread_;
+
+    // Detection-thread state
+    // Reset at the start of every pass
+    CycleArena cycle_arena_;
+    // Refilled every pass; their buffers are kept
+    LockfileInfo lockfile_;
+    LCUCredentials credentials_;
+    bool event_stream_logged_;
+    std::chrono::milliseconds logged_interval_;
+    bool ready_check_handled_;
+    int connection_attempts_;
+    bool priority_elevated_;
+    // When the current ready check expires; from a pushed ready check's
+    // timer, cleared on leaving the phase
+    std::chrono::steady_clock::time_point ready_check_deadline_;
+    // Phase decisions compare ids; observers fire on changes only
+    models::GameflowState gameflow_;
+    // False until the first phase after (re)connecting has been reported
+    bool phase_known_;
+    // A "None" phase before this is distrusted and the ready-check endpoints
+    // are scanned; set on leaving the queue and by every scanned ready check
+    std::chrono::steady_clock::time_point scan_until_;
+
+    // Name of gameflow_'s phase for other threads; written on changes only
+    mutable std::mutex phase_mutex_;
+    std::string current_phase_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
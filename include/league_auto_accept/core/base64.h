@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+std::string Base64Encode(std::string_view input);
+
+// "Basic <base64(riot:token)>" as expected by the LCU
+std::string BuildBasicAuthValue(const std::string& auth_token);
+
+} // namespace core
+} // namespace league_auto_accept
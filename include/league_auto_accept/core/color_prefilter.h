@@ -0,0 +1,86 @@
+#pragma once
+
+#include "league_auto_accept/core/screen_capture.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace league_auto_accept {
+namespace core {
+
+// Per-channel BGR range, bounds included
+struct ColorBand {
+    uint8_t low[3] = {0, 0, 0};
+    uint8_t high[3] = {255, 255, 255};
+};
+
+enum class SimdLevel {
+    SCALAR,
+    SSE2,
+    AVX2
+};
+
+// The widest level this CPU (and build) runs
+SimdLevel GetSupportedSimdLevel();
+const char* GetSimdLevelName(SimdLevel level);
+
+// Pixels of `frame` inside `band`. Counting stops at the first row that
+// reaches `stop_at`. Levels above GetSupportedSimdLevel() run as the
+// supported one.
+size_t CountPixelsInBand(const Frame& frame, const ColorBand& band, size_t stop_at = SIZE_MAX,
+                         SimdLevel level = GetSupportedSimdLevel());
+
+// Rejects frames that cannot hold the template before anything expensive
+// looks at them. The template's dominant colour (the Accept button's fill)
+// becomes a colour band. A frame passes only when enough of its pixels fall
+// in that band to cover the smallest scaled template at MIN_COVERAGE.
+//
+// Not thread-safe; owned by the detecting thread.
+class ColorBandPrefilter {
+public:
+    struct Stats {
+        uint64_t frames = 0;
+        uint64_t rejected = 0;
+        std::chrono::nanoseconds time{0};
+    };
+
+    // Added around the template's 10th to 90th percentile per channel
+    static constexpr int BAND_TOLERANCE = 16;
+    // Share of the button's band pixels a frame must show: allows for
+    // partial overlap with the captured region and blending
+    static constexpr double MIN_COVERAGE = 0.5;
+
+    explicit ColorBandPrefilter(SimdLevel level = GetSupportedSimdLevel());
+
+    // Learns the band from a BGR template; false (and everything passes)
+    // for an empty template
+    bool SetTemplate(const Frame& template_image);
+    // Smallest scale the template is searched at
+    void SetMinimumScale(double scale);
+
+    bool MayContain(const Frame& image);
+
+    const ColorBand& GetBand() const { return band_; }
+    // Share of the template's pixels inside the band
+    double GetTemplateCoverage() const { return template_coverage_; }
+    size_t GetRequiredPixels() const { return required_pixels_; }
+
+    const Stats& GetStats() const { return stats_; }
+    double GetRejectRate() const;
+    void ResetStats();
+
+private:
+    void UpdateRequiredPixels();
+
+    SimdLevel level_;
+    ColorBand band_;
+    bool has_template_;
+    size_t template_band_pixels_;
+    double template_coverage_;
+    double minimum_scale_;
+    size_t required_pixels_;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+namespace league_auto_accept {
+namespace core {
+
+// Memory for what one detection pass builds and drops: log lines, the name
+// of a phase this build does not know. Allocations bump through a buffer
+// reserved once, frees cost nothing, and Reset() gives the whole pass back
+// at once. A pass that outgrows the buffer takes the rest from the heap
+// until its reset; GetStats() shows how often that happens.
+//
+// Size 0 reserves nothing and hands every allocation to the heap, as if
+// there were no arena. Not thread-safe: one arena per detection thread.
+class CycleArena {
+public:
+    struct Stats {
+        uint64_t resets = 0;
+        uint64_t overflows = 0;         // Resets of passes that outgrew the buffer
+        uint64_t overflow_bytes = 0;    // Taken from the heap by those passes
+    };
+
+    explicit CycleArena(size_t size);
+
+    CycleArena(const CycleArena&) = delete;
+    CycleArena& operator=(const CycleArena&) = delete;
+
+    // For std::pmr containers living no longer than the current pass
+    std::pmr::memory_resource* GetResource();
+    size_t GetSize() const { return size_; }
+
+    // Frees everything allocated since the last reset
+    void Reset();
+
+    Stats GetStats() const { return stats_; }
+
+private:
+    // The heap behind the buffer, counting what the pass takes from it
+    class OverflowResource : public std::pmr::memory_resource {
+    public:
+        uint64_t bytes = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* memory, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    size_t size_;
+    std::unique_ptr<std::byte[]> buffer_;
+    OverflowResource overflow_;
+    std::pmr::monotonic_buffer_resource arena_;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
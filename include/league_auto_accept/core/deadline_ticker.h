@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace league_auto_accept {
+namespace core {
+
+// Wakes a loop on absolute deadlines, start + n * period, rather than
+// sleeping a period after each pass: the time a pass takes does not push
+// the next one back, so sampling stays on a fixed grid and lateness does
+// not add up. A pass that overruns whole periods skips their deadlines
+// instead of running them back to back.
+//
+// Not thread-safe; owned by the loop's thread.
+class DeadlineTicker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Stats {
+        uint64_t ticks = 0;
+        uint64_t missed = 0;   // Deadlines skipped
+        std::chrono::nanoseconds total_jitter{0};
+        std::chrono::nanoseconds max_jitter{0};
+    };
+
+    // Throws std::invalid_argument for a period that is not positive
+    explicit DeadlineTicker(std::chrono::nanoseconds period, Clock::time_point start = Clock::now());
+
+    // The next deadline moves to the previous one plus the new period;
+    // throws like the constructor
+    void SetPeriod(std::chrono::nanoseconds period);
+    std::chrono::nanoseconds GetPeriod() const { return period_; }
+    // Starts the grid over: the next deadline is a period from `now`
+    void Reset(Clock::time_point now = Clock::now());
+
+    Clock::time_point GetNextDeadline() const { return next_deadline_; }
+    // For waits that may end early (events); zero once the deadline passed
+    std::chrono::nanoseconds GetTimeUntilNextTick(Clock::time_point now = Clock::now()) const;
+
+    // Marks the next deadline as reached at `now` and moves to the one
+    // after. Returns the jitter: how far `now` is from the deadline, either
+    // way.
+    std::chrono::nanoseconds Tick(Clock::time_point now = Clock::now());
+    // Blocks until the next deadline, then Tick()s. Linux sleeps on the
+    // absolute monotonic deadline; elsewhere sleep_until.
+    std::chrono::nanoseconds SleepUntilNextTick();
+
+    const Stats& GetStats() const { return stats_; }
+    void ResetStats();
+
+private:
+    std::chrono::nanoseconds period_;
+    Clock::time_point next_deadline_;
+    Stats stats_;
+};
+
+enum class ThreadPriority {
+    NORMAL,
+    ELEVATED
+};
+
+// For the calling thread. False when the OS refuses, e.g. raising it
+// without CAP_SYS_NICE on Linux.
+bool SetCurrentThreadPriority(ThreadPriority priority);
+
+} // namespace core
+} // namespace league_auto_accept
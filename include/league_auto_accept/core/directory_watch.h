@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Change notifications for the files directly inside a set of directories.
+//
+// A watch is owned by a single thread; only Interrupt() may be called from
+// another thread to unblock a pending WaitForChanges().
+class DirectoryWatch {
+public:
+    virtual ~DirectoryWatch() = default;
+
+    // False if the directory does not exist or cannot be watched
+    virtual bool AddDirectory(const std::string& directory) = 0;
+    // False once the directory was removed or its watch failed
+    virtual bool IsWatching(const std::string& directory) const = 0;
+
+    // Blocks until files in watched directories are created, written,
+    // renamed or deleted, and appends "<directory><separator><name>" for
+    // each, with `directory` as passed to AddDirectory(). When the names are
+    // lost (event queue overflow, removed directory) the directory itself is
+    // appended. Returns false on timeout or Interrupt().
+    virtual bool WaitForChanges(std::vector<std::string>& changed_paths, std::chrono::milliseconds timeout) = 0;
+
+    // Wakes the next or pending WaitForChanges()
+    virtual void Interrupt() = 0;
+
+    virtual std::string GetLastError() const = 0;
+};
+
+// ReadDirectoryChangesW on Windows, inotify everywhere else
+std::unique_ptr<DirectoryWatch> CreatePlatformDirectoryWatch();
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "league_auto_accept/core/screen_capture.h"
+#include <windows.h>
+#include <string>
+
+namespace league_auto_accept {
+namespace core {
+
+// Capture source on a GDI BitBlt of the desktop into a 24-bit DIB section.
+// The DIB section and memory DC are kept between captures and only
+// recreated when the captured size changes, so repeated captures of the
+// same region allocate nothing.
+class GdiCaptureSource : public CaptureSource {
+public:
+    GdiCaptureSource();
+    ~GdiCaptureSource() override;
+
+    GdiCaptureSource(const GdiCaptureSource&) = delete;
+    GdiCaptureSource& operator=(const GdiCaptureSource&) = delete;
+
+    bool Capture(const CaptureRect& rect, Frame& frame) override;
+    // The virtual screen, spanning every monitor
+    CaptureRect GetScreenBounds() const override;
+
+    std::string GetLastError() const override;
+
+private:
+    bool EnsureBitmap(int width, int height);
+    void ReleaseBitmap();
+
+    HDC screen_dc_;
+    HDC memory_dc_;
+    HBITMAP bitmap_;
+    HGDIOBJ previous_bitmap_;
+    void* bitmap_bits_;
+    int bitmap_width_;
+    int bitmap_height_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Minimal HTTP/1.1 framing helpers shared by the socket transports and the
+// local LCU stand-in server. Only what the LCU actually sends is supported.
+
+// Position just past the "\r\n\r\n" that ends the header block, or npos
+size_t FindHeaderEnd(std::string_view data);
+
+// Case-insensitive header lookup inside a raw header block
+bool FindHeaderValue(std::string_view headers, std::string_view name, std::string_view& value);
+
+// "HTTP/1.1 200 OK" -> 200, 0 when malformed
+int ParseStatusCode(std::string_view status_line);
+
+// Parses an unsigned decimal (base 10) or hex (base 16) number; returns false
+// on an empty or malformed value
+bool ParseUnsigned(std::string_view text, size_t& value, int base = 10);
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b);
+
+const char* HttpStatusReason(int status_code);
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_health.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace league_auto_accept {
+namespace core {
+
+enum class DetectorVerdict {
+    FOUND,          // A ready check is up
+    NOT_FOUND,      // Looked and there is none
+    FAILED          // Could not look, e.g. the LCU did not answer
+};
+
+struct HybridDetectorConfig {
+    // Consecutive failed LCU reads before the vision detector joins in
+    int lcu_failures_until_degraded = 2;
+    // An LCU read slower than this also counts as degraded
+    std::chrono::milliseconds lcu_slow_threshold{250};
+    // How long a race waits for a verdict before giving up on the round
+    std::chrono::milliseconds race_timeout{1000};
+};
+
+struct HybridDetection {
+    bool found = false;
+    // Which detector answered first; meaningless unless found
+    models::DetectionSource source = models::DetectionSource::LCU_API;
+    std::chrono::microseconds latency{0};
+    bool raced = false;             // LCU and vision ran side by side
+    bool loser_cancelled = false;   // The other detector was still running and was told to stop
+};
+
+// Ready-check detection over the LCU and screen vision. While the LCU is
+// healthy it is read alone on the calling thread and vision only looks when
+// a read fails. Once LCU reads keep failing or turn slow, both detectors run at once on their own
+// worker threads: the first to find the ready check wins and the other is
+// cancelled. Detectors poll their cancel flag where they can stop; a result
+// that comes in after the round is decided is dropped, except that an LCU
+// read still counts towards its health.
+//
+// A detector whose previous run has not returned is left out of the next
+// race, so neither ever runs twice at once. Detect() is meant for one
+// thread; GetStats() and IsLCUDegraded() may be called from any.
+class HybridDetector {
+public:
+    using Clock = std::chrono::steady_clock;
+    using DetectFunction = std::function<DetectorVerdict(const std::atomic<bool>& cancelled)>;
+
+    struct Stats {
+        uint64_t detections = 0;
+        uint64_t races = 0;
+        uint64_t lcu_wins = 0;
+        uint64_t vision_wins = 0;
+        uint64_t cancelled = 0;         // Losers told to stop
+        uint64_t busy_skips = 0;        // Detector left out: its last run had not returned
+    };
+
+    // Throws std::invalid_argument for an empty detector or a config that
+    // never degrades or never waits
+    HybridDetector(DetectFunction lcu, DetectFunction vision,
+                   const HybridDetectorConfig& config = HybridDetectorConfig());
+    ~HybridDetector();
+
+    HybridDetector(const HybridDetector&) = delete;
+    HybridDetector& operator=(const HybridDetector&) = delete;
+
+    // `lcu_available` false (not connected, or UI-only detection) runs
+    // vision alone; `vision_allowed` false (LCU-only detection) never
+    // races, however degraded the LCU
+    HybridDetection Detect(bool lcu_available, bool vision_allowed = true);
+
+    // Also treats the LCU as degraded while `endpoint` is, e.g. its breaker
+    // is open or its answers slow; `health` must outlive the detector
+    void SetLCUHealth(const LCUHealthMonitor* health, LCUEndpointId endpoint);
+
+    // Blocks until the vision detector is not running, so the caller may
+    // use what it uses (e.g. click the button it found). False on timeout.
+    bool WaitForVisionIdle(std::chrono::milliseconds timeout);
+
+    bool IsLCUDegraded() const;
+    Stats GetStats() const;
+
+private:
+    enum LaneId { LCU_LANE = 0, VISION_LANE = 1, LANE_COUNT = 2 };
+
+    struct Lane {
+        DetectFunction detect;
+        std::thread thread;
+        std::atomic<bool> cancelled{false};
+        bool busy = false;
+        bool has_job = false;
+        uint64_t round = 0;
+        // Verdict for the current round; `done` false while it runs
+        bool done = false;
+        DetectorVerdict verdict = DetectorVerdict::NOT_FOUND;
+        Clock::time_point finished_at;
+    };
+
+    void LaneLoop(LaneId id);
+    // Callers hold mutex_
+    void RecordLCUResultLocked(DetectorVerdict verdict, Clock::duration elapsed);
+    bool IsLCUDegradedLocked() const;
+    void StartLocked(LaneId id);
+
+    HybridDetectorConfig config_;
+    std::array<Lane, LANE_COUNT> lanes_;
+    std::atomic<bool> never_cancelled_{false};
+
+    mutable std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable result_cv_;
+    bool stopping_ = false;
+    uint64_t round_ = 0;
+
+    int lcu_failures_ = 0;
+    Clock::duration last_lcu_latency_{0};
+    const LCUHealthMonitor* health_ = nullptr;
+    LCUEndpointId health_endpoint_ = LCUEndpointId::READY_CHECK;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "league_auto_accept/core/screen_capture.h"
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Capture source that plays back screenshots instead of the desktop, so the
+// capture and detection path runs and benchmarks without a display. Images
+// are binary PPM (P6, 8-bit); every image is one "screen" and the current
+// one is what Capture() reads until Advance() moves on.
+class ImageFileCaptureSource : public CaptureSource {
+public:
+    ImageFileCaptureSource() = default;
+
+    // Appends an image to the playback; false if it cannot be read
+    bool AddImage(const std::string& path);
+
+    size_t GetImageCount() const { return images_.size(); }
+    size_t GetCurrentIndex() const { return current_; }
+    void SetCurrentIndex(size_t index);
+    // Moves to the next image, wrapping around after the last
+    void Advance();
+
+    bool Capture(const CaptureRect& rect, Frame& frame) override;
+    CaptureRect GetScreenBounds() const override;
+
+    std::string GetLastError() const override;
+
+private:
+    std::vector<Frame> images_;
+    size_t current_ = 0;
+    std::string last_error_;
+};
+
+// Writes `frame` as a binary PPM, e.g. to record screens for playback
+bool WritePpmImage(const std::string& path, const Frame& frame);
+
+} // namespace core
+} // namespace league_auto_accept
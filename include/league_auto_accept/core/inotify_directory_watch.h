@@ -0,0 +1,45 @@
+#pragma once
+
+#include "league_auto_accept/core/directory_watch.h"
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace league_auto_accept {
+namespace core {
+
+// Directory watch on Linux inotify. Interrupt() goes through an eventfd so a
+// pending poll() wakes without a signal.
+class InotifyDirectoryWatch : public DirectoryWatch {
+public:
+    static constexpr size_t EVENT_BUFFER_SIZE = 16 * 1024;
+
+    InotifyDirectoryWatch();
+    ~InotifyDirectoryWatch() override;
+
+    InotifyDirectoryWatch(const InotifyDirectoryWatch&) = delete;
+    InotifyDirectoryWatch& operator=(const InotifyDirectoryWatch&) = delete;
+
+    bool AddDirectory(const std::string& directory) override;
+    bool IsWatching(const std::string& directory) const override;
+
+    bool WaitForChanges(std::vector<std::string>& changed_paths, std::chrono::milliseconds timeout) override;
+    void Interrupt() override;
+
+    std::string GetLastError() const override;
+
+private:
+    void ReadEvents(std::vector<std::string>& changed_paths);
+    void SetError(const std::string& message);
+
+    int inotify_fd_;
+    int interrupt_fd_;
+    std::map<int, std::string> directories_;   // Watch descriptor -> directory
+    alignas(alignof(int)) char buffer_[EVENT_BUFFER_SIZE];   // struct inotify_event records
+
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Non-allocating helpers for picking single values out of LCU JSON payloads.
+// They only find value boundaries; no DOM is built and nothing is unescaped.
+
+// Skips leading whitespace
+std::string_view SkipJsonWhitespace(std::string_view text);
+
+// Length of the JSON value at the start of `text` (string, number, literal,
+// object or array), or 0 if it is malformed or truncated
+size_t MeasureJsonValue(std::string_view text);
+
+// Calls visitor(key, raw_value) for each top-level member of the JSON object
+// in `object`, in document order, until it returns false. Keys are raw (no
+// unescaping). Returns false if the object is malformed before the visitor
+// stopped.
+template <typename Visitor>
+bool VisitJsonObject(std::string_view object, Visitor&& visitor);
+
+// Finds a top-level member of the JSON object in `object` and returns its raw
+// value (strings keep their quotes)
+bool FindJsonMember(std::string_view object, std::string_view key, std::string_view& value);
+
+// Strips the quotes from a raw JSON string value; escapes are left as-is
+bool UnquoteJsonString(std::string_view raw, std::string_view& value);
+
+// Number of elements in a JSON array, or -1 if it is malformed
+int CountJsonArray(std::string_view array);
+
+// Parses a JSON number without allocating
+bool ParseJsonNumber(std::string_view raw, double& value);
+bool ParseJsonInteger(std::string_view raw, long long& value);
+
+template <typename Visitor>
+bool VisitJsonObject(std::string_view object, Visitor&& visitor) {
+    object = SkipJsonWhitespace(object);
+    if (object.empty() || object.front() != '{') return false;
+    object = SkipJsonWhitespace(object.substr(1));
+    if (!object.empty() && object.front() == '}') return true;
+
+    for (;;) {
+        if (object.empty() || object.front() != '"') return false;
+        size_t key_length = MeasureJsonValue(object);
+        if (key_length == 0) return false;
+        std::string_view key = object.substr(1, key_length - 2);
+
+        object = SkipJsonWhitespace(object.substr(key_length));
+        if (object.empty() || object.front() != ':') return false;
+        object = SkipJsonWhitespace(object.substr(1));
+
+        size_t value_length = MeasureJsonValue(object);
+        if (value_length == 0) return false;
+        if (!visitor(key, object.substr(0, value_length))) return true;
+
+        object = SkipJsonWhitespace(object.substr(value_length));
+        if (object.empty()) return false;
+        if (object.front() == '}') return true;
+        if (object.front() != ',') return false;
+        object = SkipJsonWhitespace(object.substr(1));
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
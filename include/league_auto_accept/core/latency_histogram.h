@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace league_auto_accept {
+namespace core {
+
+// Latency distribution in fixed log-linear buckets, HdrHistogram style: exact
+// below 16us, then every power of two split into 16 linear sub-buckets, so any
+// recorded value is known to within 1/16 (6.25%). Values from 0 to ~71
+// minutes in microseconds fit in BUCKET_COUNT buckets; larger ones are
+// clamped into the last.
+//
+// Record() is lock-free and wait-free apart from the min/max update, with
+// relaxed atomics: concurrent recorders never block each other, and a
+// snapshot taken while recording may miss samples still in flight.
+// Reset() and Merge() are not atomic as a whole.
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 4;
+    static constexpr uint64_t SUB_BUCKET_COUNT = uint64_t(1) << SUB_BUCKET_BITS;
+    static constexpr int MAX_VALUE_BITS = 32;
+    static constexpr uint64_t MAX_VALUE_US = (uint64_t(1) << MAX_VALUE_BITS) - 1;
+    static constexpr size_t BUCKET_COUNT =
+        SUB_BUCKET_COUNT + (MAX_VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_COUNT;
+
+    static size_t GetBucketIndex(uint64_t value_us);
+    static uint64_t GetBucketLowerBound(size_t index);
+    // Largest value that lands in the bucket
+    static uint64_t GetBucketUpperBound(size_t index);
+
+    // Plain copy of a histogram at one moment, for queries and merging
+    class Snapshot {
+    public:
+        Snapshot();
+
+        void Add(uint64_t value_us, uint64_t count = 1);
+        void Merge(const Snapshot& other);
+        void Clear();
+
+        uint64_t GetCount() const { return count_; }
+        bool IsEmpty() const { return count_ == 0; }
+        // 0 when empty
+        std::chrono::microseconds GetMin() const;
+        std::chrono::microseconds GetMax() const;
+        double GetMeanUs() const;
+
+        // Smallest bucketed value with at least `percentile` percent of the
+        // samples at or below it (the bucket's upper bound, clamped to the
+        // recorded min / max). 0 when empty.
+        std::chrono::microseconds GetPercentile(double percentile) const;
+        std::chrono::microseconds GetP50() const { return GetPercentile(50.0); }
+        std::chrono::microseconds GetP90() const { return GetPercentile(90.0); }
+        std::chrono::microseconds GetP99() const { return GetPercentile(99.0); }
+        std::chrono::microseconds GetP999() const { return GetPercentile(99.9); }
+
+        uint64_t GetBucketCount(size_t index) const { return buckets_[index]; }
+
+    private:
+        friend class LatencyHistogram;
+
+        std::array<uint64_t, BUCKET_COUNT> buckets_;
+        uint64_t count_;
+        uint64_t sum_us_;
+        uint64_t min_us_;
+        uint64_t max_us_;
+    };
+
+    LatencyHistogram();
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    // Negative latencies are recorded as 0
+    void Record(std::chrono::microseconds latency);
+    void RecordValue(uint64_t value_us);
+
+    Snapshot TakeSnapshot() const;
+    // Adds the snapshot's samples to this histogram
+    void Merge(const Snapshot& snapshot);
+    void Reset();
+
+    uint64_t GetCount() const;
+
+private:
+    void UpdateMin(uint64_t value_us);
+    void UpdateMax(uint64_t value_us);
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> sum_us_;
+    std::atomic<uint64_t> min_us_;   // UINT64_MAX when empty
+    std::atomic<uint64_t> max_us_;
+};
+
+// Latency histogram over a sliding window of recent time: a ring of
+// histograms, one per slot of SLOT_DURATION, reused once they fall out of the
+// window. Snapshots merge the slots inside the requested window, so the
+// window edge moves in whole slots.
+//
+// Recording is lock-free like LatencyHistogram. The first sample of a new
+// slot clears the ring entry it reuses; a sample recorded into that entry by
+// another thread during the clear can be lost.
+class RollingLatencyHistogram {
+public:
+    static constexpr std::chrono::seconds SLOT_DURATION{60};
+    static constexpr size_t SLOT_COUNT = 15;
+    static constexpr std::chrono::minutes MAX_WINDOW{15};
+
+    RollingLatencyHistogram();
+
+    RollingLatencyHistogram(const RollingLatencyHistogram&) = delete;
+    RollingLatencyHistogram& operator=(const RollingLatencyHistogram&) = delete;
+
+    void Record(std::chrono::microseconds latency,
+                std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+    // Samples from the slots overlapping [now - window, now]; windows longer
+    // than MAX_WINDOW are cut to it
+    LatencyHistogram::Snapshot TakeSnapshot(
+        std::chrono::seconds window,
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) const;
+
+    void Reset();
+
+private:
+    static int64_t GetSlotEpoch(std::chrono::steady_clock::time_point time);
+
+    std::array<LatencyHistogram, SLOT_COUNT> slots_;
+    std::array<std::atomic<int64_t>, SLOT_COUNT> slot_epochs_;   // -1 while unused
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_transport.h"
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr const char* GAMEFLOW_PHASE_URI = "/lol-gameflow/v1/gameflow-phase";
+constexpr const char* READY_CHECK_URI = "/lol-matchmaking/v1/ready-check";
+
+// What the body of a successful response holds
+enum class ResponseShape {
+    EMPTY,          // Nothing worth reading (accept / decline answer 204)
+    PHASE,          // A JSON string: "ReadyCheck"
+    READY_CHECK,    // A ready-check object
+    SEARCH,         // A matchmaking search with a readyCheck member
+    SESSION         // A gameflow session with a phase member
+};
+
+// Every LCU request this tool makes, in the order of LCU_ENDPOINTS
+enum class LCUEndpointId {
+    GAMEFLOW_PHASE,
+    GAMEFLOW_SESSION,
+    READY_CHECK,
+    LOBBY_READY_CHECK,
+    MATCHMAKING_SEARCH,
+    ACCEPT_MATCHMAKING,
+    ACCEPT_LOBBY,
+    ACCEPT_GAMEFLOW,
+    DECLINE_READY_CHECK
+};
+
+constexpr size_t LCU_ENDPOINT_COUNT = static_cast<size_t>(LCUEndpointId::DECLINE_READY_CHECK) + 1;
+
+struct LCUEndpoint {
+    HttpMethod method;
+    const char* path;
+    ResponseShape shape;
+    // Sending it twice has the effect of sending it once, so it may be
+    // replayed after the client dropped the connection, and retried
+    bool idempotent;
+};
+
+// None of these requests carries a body, so transports can serialise them
+// once per connection
+constexpr std::array<LCUEndpoint, LCU_ENDPOINT_COUNT> LCU_ENDPOINTS = {{
+    {HttpMethod::GET, GAMEFLOW_PHASE_URI, ResponseShape::PHASE, true},
+    {HttpMethod::GET, "/lol-gameflow/v1/session", ResponseShape::SESSION, true},
+    {HttpMethod::GET, READY_CHECK_URI, ResponseShape::READY_CHECK, true},
+    {HttpMethod::GET, "/lol-lobby/v2/ready-check", ResponseShape::READY_CHECK, true},
+    {HttpMethod::GET, "/lol-matchmaking/v1/search", ResponseShape::SEARCH, true},
+    // Accepting an accepted ready check changes nothing
+    {HttpMethod::POST, "/lol-matchmaking/v1/ready-check/accept", ResponseShape::EMPTY, true},
+    {HttpMethod::POST, "/lol-lobby/v2/ready-check/accept", ResponseShape::EMPTY, true},
+    {HttpMethod::POST, "/lol-gameflow/v1/ready-check/accept", ResponseShape::EMPTY, true},
+    {HttpMethod::POST, "/lol-matchmaking/v1/ready-check/decline", ResponseShape::EMPTY, true}
+}};
+
+constexpr const LCUEndpoint& GetLCUEndpoint(LCUEndpointId id) {
+    return LCU_ENDPOINTS[static_cast<size_t>(id)];
+}
+
+// Index into LCU_ENDPOINTS, or -1 for a request outside the registry
+constexpr int FindLCUEndpoint(HttpMethod method, std::string_view path) {
+    for (size_t i = 0; i < LCU_ENDPOINT_COUNT; ++i) {
+        if (LCU_ENDPOINTS[i].method == method && path == LCU_ENDPOINTS[i].path) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+namespace detail {
+
+// Each method and path once, and GETs safe to replay
+constexpr bool IsValidEndpointRegistry() {
+    for (size_t i = 0; i < LCU_ENDPOINT_COUNT; ++i) {
+        if (FindLCUEndpoint(LCU_ENDPOINTS[i].method, LCU_ENDPOINTS[i].path) != static_cast<int>(i)) {
+            return false;
+        }
+        if (LCU_ENDPOINTS[i].method == HttpMethod::GET && !LCU_ENDPOINTS[i].idempotent) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+static_assert(detail::IsValidEndpointRegistry(), "LCU endpoint registry has duplicates or a non-idempotent GET");
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace league_auto_accept {
+namespace core {
+
+// Keeps an LCU event stream subscribed to the gameflow phase and ready-check
+// endpoints on a background thread and queues their events for the
+// detection loop.
+//
+// The detection loop blocks in WaitForEvent() instead of sleeping, so a ready
+// check wakes it as soon as the client pushes it. While IsConnected() is false
+// callers fall back to polling. WaitForEvent() also returns early when the
+// stream connects or drops, so callers can resync with a single poll.
+class LCUEventListener {
+public:
+    static constexpr size_t MAX_QUEUED_EVENTS = 64;
+    static constexpr std::chrono::milliseconds RECONNECT_DELAY{1000};
+    // Safety-net poll interval for callers while the stream is connected
+    static constexpr std::chrono::milliseconds RESYNC_INTERVAL{30000};
+
+    explicit LCUEventListener(std::unique_ptr<LCUEventStream> stream);
+    ~LCUEventListener();
+
+    LCUEventListener(const LCUEventListener&) = delete;
+    LCUEventListener& operator=(const LCUEventListener&) = delete;
+
+    // Starts the listener thread on first use and reconnects when the
+    // credentials change
+    void UpdateCredentials(const LCUCredentials& credentials);
+    void Stop();
+
+    // True while the stream is connected and subscribed
+    bool IsConnected() const;
+
+    // Pops the next event, waiting up to `timeout`. Returns false on timeout,
+    // on a connection state change or after Stop().
+    bool WaitForEvent(LCUEvent& event, std::chrono::milliseconds timeout);
+
+    int GetEventCount() const;
+    int GetReconnectCount() const;
+    std::string GetLastError() const;
+
+private:
+    void ListenLoop();
+    bool ConnectAndSubscribe(const LCUCredentials& credentials);
+    void SetConnected(bool connected);
+    void SetError(const std::string& message);
+
+    std::unique_ptr<LCUEventStream> stream_;
+    std::thread listener_thread_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable state_cv_;    // Listener thread: credentials changed or stop
+    std::condition_variable events_cv_;   // Waiters: event queued or connection changed
+    LCUCredentials credentials_;
+    uint64_t credentials_generation_;
+    uint64_t connection_epoch_;
+    std::deque<LCUEvent> events_;
+    bool stopping_;
+
+    std::atomic<bool> connected_;
+    std::atomic<int> event_count_;
+    std::atomic<int> reconnect_count_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_transport.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// WAMP 1.0 message type ids used by the LCU WebSocket
+constexpr int WAMP_SUBSCRIBE = 5;
+constexpr int WAMP_EVENT = 8;
+
+constexpr const char* JSON_API_EVENT_TOPIC = "OnJsonApiEvent";
+
+// One OnJsonApiEvent payload pushed by the LCU
+struct LCUEvent {
+    std::string uri;
+    std::string event_type;   // Create, Update or Delete
+    std::string data;         // Raw JSON value of the resource
+    std::chrono::steady_clock::time_point received_time;
+};
+
+// Parses `[8,"OnJsonApiEvent...",{"data":...,"eventType":"...","uri":"..."}]`
+bool ParseWampEvent(std::string_view message, LCUEvent& event);
+
+// Topic that only carries events for one endpoint, e.g.
+// "/lol-gameflow/v1/gameflow-phase" -> "OnJsonApiEvent_lol-gameflow_v1_gameflow-phase"
+std::string BuildEndpointEventTopic(std::string_view uri);
+
+// WAMP subscribe message for `topic`
+std::string BuildWampSubscribe(std::string_view topic);
+
+// Maps an event onto the gameflow phase it implies: the value pushed for the
+// phase endpoint, or "ReadyCheck" for a ready check the player has not
+// answered yet. Returns false for events that say nothing about the phase.
+// The view points into event.data or at a static name.
+bool GetPhaseFromEvent(const LCUEvent& event, std::string_view& phase);
+bool GetPhaseFromEvent(const LCUEvent& event, std::string& phase);
+
+// WebSocket connection to the LCU event bus (wss://127.0.0.1:<port>/).
+//
+// Like LCUTransport a stream is owned by a single thread; only Interrupt()
+// may be called from another thread to unblock a pending ReadMessage().
+class LCUEventStream {
+public:
+    virtual ~LCUEventStream() = default;
+
+    virtual bool Connect(const LCUCredentials& credentials) = 0;
+    virtual void Close() = 0;
+    virtual bool IsConnected() const = 0;
+
+    virtual bool Subscribe(const std::string& topic) = 0;
+
+    // Blocks until the next text message arrives. Returns false when the
+    // stream is closed, fails or is interrupted.
+    virtual bool ReadMessage(std::string& message) = 0;
+
+    virtual void Interrupt() = 0;
+
+    virtual std::string GetLastError() const = 0;
+};
+
+// WinHTTP WebSocket on Windows, OpenSSL sockets everywhere else
+std::unique_ptr<LCUEventStream> CreatePlatformEventStream(
+    std::chrono::milliseconds connect_timeout = std::chrono::milliseconds(5000));
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+struct LCUHealthConfig {
+    // Outcomes the rolling success rate covers
+    size_t window = 20;
+    // The success rate can only open the breaker once the window holds this many
+    size_t min_samples = 5;
+    double open_below_success_rate = 0.5;
+    // Or this many failures in a row open it regardless
+    int open_after_failures = 3;
+    // First probe this long after opening; each failed probe doubles the
+    // wait, capped
+    std::chrono::milliseconds probe_interval{2000};
+    std::chrono::milliseconds max_probe_interval{30000};
+    // Weight of the latest answer in the latency average
+    double latency_weight = 0.2;
+    // Answers slower than this on average lower the score
+    std::chrono::milliseconds slow_latency{250};
+    // A closed breaker scoring below this still counts as degraded
+    double degraded_below_score = 0.8;
+};
+
+enum class BreakerState {
+    CLOSED,       // Requests go out
+    OPEN,         // Requests are refused until the next probe is due
+    HALF_OPEN     // One probe is out; its outcome closes or reopens. A probe
+                  // with no outcome within the probe interval is given up.
+};
+
+const char* BreakerStateToString(BreakerState state);
+
+struct EndpointHealth {
+    BreakerState state = BreakerState::CLOSED;
+    double success_rate = 1.0;                  // Over the window; 1 before any outcome
+    std::chrono::microseconds latency{0};       // Average, successes and failures alike
+    int consecutive_failures = 0;
+    // 0 (open) to 1: the success rate, less for a slow average; half while
+    // half-open
+    double score = 1.0;
+    uint64_t refused = 0;                       // Requests not sent while open
+    uint64_t opened = 0;                        // Times the breaker opened
+};
+
+// Health of each LCU endpoint in the registry, with a circuit breaker per
+// endpoint. A client that is gone, restarting or overloaded fails fast: once
+// an endpoint keeps failing its breaker opens and callers stop sending,
+// apart from one probe at a slow, growing interval. The first answered
+// probe closes it again.
+//
+// Outcomes are judged like retries: no answer, a timeout, throttling or a
+// server error is a failure; any other status means the client is there.
+// Thread-safe.
+class LCUHealthMonitor {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Throws std::invalid_argument for an empty window, a rate outside
+    // [0, 1], no failure limit, a non-positive probe interval or one above
+    // its cap, or a latency weight outside (0, 1]
+    explicit LCUHealthMonitor(const LCUHealthConfig& config = LCUHealthConfig());
+
+    // False while the breaker is open and no probe is due. A due probe
+    // moves it half-open and lets this one request through; `probe` is set
+    // to its id then, and to 0 for any other answer. Every request let
+    // through must end in RecordResult/RecordResponse or ReleaseProbe.
+    bool AllowRequest(LCUEndpointId endpoint, Clock::time_point now = Clock::now(), uint64_t* probe = nullptr);
+    // For a probe let through that was never sent: the breaker may probe
+    // again at once. No effect once `probe` is no longer the one out, e.g.
+    // after it expired and another request took its place.
+    void ReleaseProbe(LCUEndpointId endpoint, uint64_t probe, Clock::time_point now = Clock::now());
+    // Returns the breaker's state afterwards
+    BreakerState RecordResult(LCUEndpointId endpoint, bool success, Clock::duration latency,
+                              Clock::time_point now = Clock::now());
+    BreakerState RecordResponse(LCUEndpointId endpoint, const HttpResponse& response, Clock::duration latency,
+                                Clock::time_point now = Clock::now());
+    BreakerState RecordResponse(LCUEndpointId endpoint, const HttpResponseView& response, Clock::duration latency,
+                                Clock::time_point now = Clock::now());
+
+    EndpointHealth GetHealth(LCUEndpointId endpoint) const;
+    BreakerState GetState(LCUEndpointId endpoint) const;
+    // Zero unless the breaker is open
+    Clock::duration GetTimeUntilProbe(LCUEndpointId endpoint, Clock::time_point now = Clock::now()) const;
+    // Not closed, or closed with a low score
+    bool IsDegraded(LCUEndpointId endpoint) const;
+
+    // Forgets every outcome, e.g. for a newly started client
+    void Reset();
+
+private:
+    struct Endpoint {
+        BreakerState state = BreakerState::CLOSED;
+        std::vector<uint8_t> outcomes;   // Ring of 1 = success, sized once
+        size_t next = 0;
+        size_t samples = 0;
+        size_t successes = 0;
+        int consecutive_failures = 0;
+        double latency_us = 0.0;
+        bool has_latency = false;
+        Clock::duration probe_interval{0};
+        Clock::time_point next_probe;   // While half-open, when the probe is given up
+        uint64_t probe = 0;             // Id of the probe out while half-open
+        uint64_t refused = 0;
+        uint64_t opened = 0;
+    };
+
+    // Callers hold mutex_
+    void Open(Endpoint& endpoint, Clock::time_point now, Clock::duration interval);
+    void ClearOutcomes(Endpoint& endpoint);
+    double GetScore(const Endpoint& endpoint) const;
+    Endpoint& At(LCUEndpointId endpoint) { return endpoints_[static_cast<size_t>(endpoint)]; }
+    const Endpoint& At(LCUEndpointId endpoint) const { return endpoints_[static_cast<size_t>(endpoint)]; }
+
+    LCUHealthConfig config_;
+    mutable std::mutex mutex_;
+    std::array<Endpoint, LCU_ENDPOINT_COUNT> endpoints_;
+    // Never reset, so a probe from before Reset() cannot match a later one
+    uint64_t probe_count_ = 0;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_transport.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+enum class AsyncRequestStatus {
+    PENDING,     // Queued
+    RUNNING,     // On the wire
+    COMPLETED,   // Response (or transport error) in the result
+    CANCELLED,
+    EXPIRED,     // Deadline passed before a response
+    REJECTED     // Queue full or pool stopped; never sent
+};
+
+const char* AsyncRequestStatusToString(AsyncRequestStatus status);
+
+struct AsyncRequestResult {
+    AsyncRequestStatus status = AsyncRequestStatus::PENDING;
+    HttpResponse response;   // Only for COMPLETED
+    std::string error;       // Transport error when the response has no status
+
+    bool IsSuccess() const { return status == AsyncRequestStatus::COMPLETED && response.IsSuccess(); }
+};
+
+class LCURequestPool;
+
+// Handle to a request submitted to an LCURequestPool; copies share the
+// request. Any thread may wait on or cancel it.
+class AsyncLCURequest {
+public:
+    AsyncLCURequest() = default;
+
+    bool IsValid() const { return state_ != nullptr; }
+
+    // A queued request is never sent. One already on the wire finishes on
+    // its worker, but waiters are released at once. False when the request
+    // had already finished.
+    bool Cancel();
+    AsyncRequestStatus GetStatus() const;
+    bool IsFinished() const;
+
+    // Blocks until the request finishes, is cancelled or reaches its
+    // deadline; at the deadline it becomes EXPIRED
+    AsyncRequestResult Get();
+    // False if the request is still pending or running after `timeout`
+    bool WaitFor(std::chrono::milliseconds timeout) const;
+
+private:
+    friend class LCURequestPool;
+    struct State;
+
+    explicit AsyncLCURequest(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+    std::shared_ptr<State> state_;
+};
+
+struct RequestPoolConfig {
+    // Each worker owns one keep-alive connection
+    size_t workers = 2;
+    // Submissions beyond this many queued requests are rejected
+    size_t max_queued = 64;
+    // Deadline of a request submitted without one
+    std::chrono::milliseconds default_deadline{5000};
+    // Handed to the default transport factory
+    std::chrono::milliseconds request_timeout{5000};
+};
+
+// Asynchronous LCU requests on a fixed set of worker threads, instead of a
+// thread per request. Requests carry a deadline and can be cancelled; a
+// bounded queue sheds load rather than letting requests pile up. Every
+// worker owns its transport, so no connection is shared between threads,
+// and reopens it when the credentials change.
+//
+// Submit(), UpdateCredentials() and Stop() are thread-safe.
+class LCURequestPool {
+public:
+    using TransportFactory = std::function<std::unique_ptr<LCUTransport>()>;
+
+    struct Stats {
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        uint64_t cancelled = 0;
+        uint64_t expired = 0;
+        uint64_t rejected = 0;
+    };
+
+    // Throws std::invalid_argument for no workers or a zero queue. The
+    // default factory is CreatePlatformTransport(request_timeout).
+    explicit LCURequestPool(const RequestPoolConfig& config = RequestPoolConfig(),
+                            TransportFactory transport_factory = nullptr);
+    ~LCURequestPool();
+
+    LCURequestPool(const LCURequestPool&) = delete;
+    LCURequestPool& operator=(const LCURequestPool&) = delete;
+
+    // Workers reopen their transports before their next request; invalid
+    // credentials close them and fail requests with a transport error
+    void UpdateCredentials(const LCUCredentials& credentials);
+
+    // A zero deadline means config.default_deadline from now
+    AsyncLCURequest Submit(HttpMethod method, const std::string& path, const std::string& body = "",
+                           std::chrono::milliseconds deadline = std::chrono::milliseconds(0));
+
+    // Cancels everything queued and joins the workers; later submissions
+    // are rejected
+    void Stop();
+
+    size_t GetWorkerCount() const { return workers_.size(); }
+    size_t GetQueuedCount() const;
+    Stats GetStats() const;
+
+private:
+    friend class AsyncLCURequest;
+    // Shared with the requests, which may finish after the pool is gone
+    struct Counters;
+
+    void WorkerLoop();
+
+    RequestPoolConfig config_;
+    std::shared_ptr<Counters> counters_;
+
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;
+    std::deque<std::shared_ptr<AsyncLCURequest::State>> queue_;
+    bool stopping_;
+
+    std::mutex credentials_mutex_;
+    LCUCredentials credentials_;
+    uint64_t credentials_generation_;
+
+    TransportFactory transport_factory_;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
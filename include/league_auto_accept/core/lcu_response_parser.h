@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Fields of a /lol-matchmaking/v1/ready-check body. The string fields are
+// unquoted views into the parsed body, so the body must outlive the view.
+struct ReadyCheckView {
+    std::string_view state;             // "InProgress", "Invalid", ...
+    std::string_view player_response;   // "None", "Accepted", "Declined"
+    std::string_view dodge_warning;     // "None", "Warning", "Penalty"
+    std::string_view decliner_ids;      // Raw JSON array
+    int decliner_count = 0;
+    double timer = 0.0;
+    bool suppress_ux = false;
+
+    bool IsInProgress() const { return state == "InProgress"; }
+    // In progress and not answered yet
+    bool IsPending() const { return IsInProgress() && player_response == "None"; }
+    bool IsAccepted() const { return player_response == "Accepted"; }
+
+    // The LCU counts `timer` up from 0; the match is dropped at this mark
+    static constexpr double DURATION_SECONDS = 12.0;
+    double GetSecondsRemaining() const { return timer < DURATION_SECONDS ? DURATION_SECONDS - timer : 0.0; }
+};
+
+// Single-pass, non-allocating extraction of the few LCU response fields the
+// detector needs. Unknown members are skipped without being decoded; string
+// values containing escapes come back still escaped, which is fine for the
+// plain enum-like values the LCU sends for these fields.
+
+// /lol-gameflow/v1/gameflow-phase answers with a bare JSON string
+bool ParseGameflowPhase(std::string_view body, std::string_view& phase);
+
+// "phase" member of /lol-gameflow/v1/session or /lol-champ-select/v1/session
+bool ParseSessionPhase(std::string_view body, std::string_view& phase);
+
+// Ready-check object: the ready-check endpoint body, or the "readyCheck"
+// member of /lol-matchmaking/v1/search. Fails unless "state" is present.
+bool ParseReadyCheck(std::string_view body, ReadyCheckView& view);
+
+// "readyCheck" member of /lol-matchmaking/v1/search
+bool ParseSearchReadyCheck(std::string_view body, ReadyCheckView& view);
+
+// "errorCode" member of an LCU error body, e.g. "RPC_ERROR"
+bool ParseErrorCode(std::string_view body, std::string_view& error_code);
+
+// Copies up to `capacity` decliner summoner ids into `ids`; returns how many
+// were written, or -1 if the array is malformed
+int ParseDeclinerIds(std::string_view decliner_ids, long long* ids, size_t capacity);
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_transport.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Keep-alive session to the LCU shared by every poll of a detection loop.
+//
+// The underlying transport is reused across requests and only rebuilt when
+// the lockfile port or token changes (i.e. the client restarted).
+class LCUSession {
+public:
+    explicit LCUSession(std::unique_ptr<LCUTransport> transport);
+    ~LCUSession();
+
+    LCUSession(const LCUSession&) = delete;
+    LCUSession& operator=(const LCUSession&) = delete;
+
+    // Returns true when the transport had to be rebuilt
+    bool UpdateCredentials(const LCUCredentials& credentials);
+    const LCUCredentials& GetCredentials() const;
+    bool IsReady() const;
+    void Reset();
+
+    // Paths are taken as views: polling a constant path copies nothing
+    HttpResponse Get(std::string_view path);
+    HttpResponse Post(std::string_view path, std::string_view body = {});
+    HttpResponse Send(HttpMethod method, std::string_view path, std::string_view body = {});
+    // The body is a view into the session's connection buffer, valid until
+    // its next request: for polls that parse the answer on the spot
+    HttpResponseView GetView(std::string_view path);
+    HttpResponseView SendView(HttpMethod method, std::string_view path, std::string_view body = {});
+
+    // Ahead of a request that has to be fast, e.g. the ready-check accept:
+    // prepares it, and unless the LCU answered within `max_idle`, GETs
+    // `probe_path` to open the connection or replace one the server
+    // dropped while idle. True when the connection answered.
+    bool Prewarm(HttpMethod method, std::string_view path, std::string_view probe_path,
+                 std::chrono::milliseconds max_idle = std::chrono::milliseconds(0));
+    // When the LCU last answered; the epoch before it ever did
+    std::chrono::steady_clock::time_point GetLastAnswerTime() const;
+
+    int GetRebuildCount() const;
+    int GetConnectionCount() const;
+    std::string GetLastError() const;
+
+private:
+    std::unique_ptr<LCUTransport> transport_;
+    LCUCredentials credentials_;
+    int rebuild_count_;
+    std::chrono::steady_clock::time_point last_answer_time_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Port and password read from the LCU lockfile
+struct LCUCredentials {
+    int port = 0;
+    std::string auth_token;
+
+    bool IsValid() const { return port > 0 && !auth_token.empty(); }
+
+    bool operator==(const LCUCredentials& other) const {
+        return port == other.port && auth_token == other.auth_token;
+    }
+    bool operator!=(const LCUCredentials& other) const { return !(*this == other); }
+};
+
+enum class HttpMethod {
+    GET,
+    POST,
+    PUT
+};
+
+struct HttpResponse {
+    int status_code = 0;                      // 0 when no response was received
+    std::string body;
+    std::chrono::microseconds latency{0};
+    bool reused_connection = false;           // true when no new TLS handshake was needed
+
+    bool IsTransportError() const { return status_code == 0; }
+    bool IsSuccess() const { return status_code >= 200 && status_code < 300; }
+};
+
+// A response whose body is left in the transport's per-connection buffer:
+// valid until the next request on that transport or Close(). A poll that
+// parses the body and forgets it copies and allocates nothing.
+struct HttpResponseView {
+    int status_code = 0;
+    std::string_view body;
+    std::chrono::microseconds latency{0};
+    bool reused_connection = false;
+
+    bool IsTransportError() const { return status_code == 0; }
+    bool IsSuccess() const { return status_code >= 200 && status_code < 300; }
+};
+
+// Copies the body out, for answers kept past the next request
+HttpResponse CopyResponse(const HttpResponseView& view);
+
+// Long-lived HTTPS connection to the local League client.
+//
+// Implementations keep their session and TLS connection open between calls
+// and only reconnect when the server drops the connection. A transport is not
+// thread-safe; each thread that talks to the LCU owns its own instance.
+class LCUTransport {
+public:
+    virtual ~LCUTransport() = default;
+
+    // Configures the transport for the given credentials. The TLS connection
+    // itself is established lazily on the first Send().
+    virtual bool Open(const LCUCredentials& credentials) = 0;
+    virtual void Close() = 0;
+    virtual bool IsOpen() const = 0;
+
+    // The body is read into a buffer kept for the connection, so once it has
+    // grown to the largest answer no request allocates for its response
+    virtual HttpResponseView SendView(HttpMethod method, std::string_view path, std::string_view body = {}) = 0;
+    HttpResponse Send(HttpMethod method, std::string_view path, std::string_view body = {}) {
+        return CopyResponse(SendView(method, path, body));
+    }
+
+    // Does the per-request work for a bodiless request ahead of time, so a
+    // later Send() of the same method and path skips it. Open() and Close()
+    // drop prepared requests.
+    virtual void Prepare(HttpMethod method, std::string_view path) = 0;
+
+    // Number of underlying connections (TLS handshakes) made since Open()
+    virtual int GetConnectionCount() const = 0;
+    virtual std::string GetLastError() const = 0;
+};
+
+// WinHTTP on Windows, OpenSSL sockets everywhere else
+std::unique_ptr<LCUTransport> CreatePlatformTransport(
+    std::chrono::milliseconds timeout = std::chrono::milliseconds(5000));
+
+const char* HttpMethodToString(HttpMethod method);
+
+} // namespace core
+} // namespace league_auto_accept
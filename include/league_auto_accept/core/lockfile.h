@@ -0,0 +1,36 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_transport.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Contents of a client lockfile: "LeagueClient:PID:PORT:PASSWORD:PROTOCOL"
+struct LockfileInfo {
+    std::string process_name;
+    int process_id = 0;
+    int port = 0;
+    std::string password;
+    std::string protocol;
+
+    LCUCredentials GetCredentials() const { return {port, password}; }
+    // The Riot Client writes a lockfile of the same shape for its own API
+    bool IsRiotClient() const { return process_name.find("Riot Client") != std::string::npos; }
+};
+
+bool ParseLockfile(std::string_view content, LockfileInfo& info);
+bool ReadLockfile(const std::string& path, LockfileInfo& info);
+
+// Where the League client may have written its lockfile, most likely first.
+// On other platforms only $LAA_LOCKFILE is consulted.
+std::vector<std::string> GetDefaultLockfilePaths();
+
+// First readable League client lockfile among `paths`; Riot Client lockfiles
+// are skipped
+bool FindLockfile(const std::vector<std::string>& paths, LockfileInfo& info, std::string* found_path = nullptr);
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "league_auto_accept/core/directory_watch.h"
+#include "league_auto_accept/core/lockfile.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Caches the lockfile found among a list of candidate paths and re-reads the
+// candidates only when a watched directory reports a change to one of them.
+//
+// Steady-state GetLockfile() calls touch no files: a background thread blocks
+// on the directory watch and only marks the cache stale. Candidates whose
+// directory does not exist (yet) cannot be watched; while there are any, the
+// thread retries them and rescans every RESCAN_INTERVAL.
+class LockfileWatcher {
+public:
+    static constexpr std::chrono::milliseconds RESCAN_INTERVAL{5000};
+
+    explicit LockfileWatcher(std::vector<std::string> paths,
+                             std::unique_ptr<DirectoryWatch> watch = CreatePlatformDirectoryWatch());
+    ~LockfileWatcher();
+
+    LockfileWatcher(const LockfileWatcher&) = delete;
+    LockfileWatcher& operator=(const LockfileWatcher&) = delete;
+
+    // First League client lockfile among the candidates, as FindLockfile()
+    // would return it. Starts watching on first use.
+    bool GetLockfile(LockfileInfo& info, std::string* found_path = nullptr);
+    // Stops the watch thread; the next GetLockfile() rescans and restarts it
+    void Stop();
+
+    const std::vector<std::string>& GetPaths() const { return paths_; }
+    // True while every candidate directory is watched
+    bool IsFullyWatched() const;
+    // Times the candidates were actually read
+    int GetScanCount() const;
+
+private:
+    struct Candidate {
+        std::string path;
+        std::string directory;
+        std::string watched_path;   // How the watch reports changes to `path`
+    };
+
+    void Start();
+    bool WatchDirectories();
+    void WatchLoop();
+    bool IsCandidate(const std::string& changed_path) const;
+
+    std::vector<std::string> paths_;
+    std::vector<Candidate> candidates_;
+    std::unique_ptr<DirectoryWatch> watch_;
+    std::thread watch_thread_;
+
+    std::atomic<bool> stopping_;
+    std::atomic<bool> stale_;
+    std::atomic<bool> fully_watched_;
+    std::atomic<int> scan_count_;
+
+    // Guards the cache; GetLockfile() may be called from several threads
+    mutable std::mutex cache_mutex_;
+    bool cached_found_;
+    LockfileInfo cached_info_;
+    std::string cached_path_;
+};
+
+// Lockfile at `path` through a process-wide watcher per path, for callers
+// that look a lockfile up by path instead of owning a watcher
+bool ReadWatchedLockfile(const std::string& path, LockfileInfo& info);
+
+} // namespace core
+} // namespace league_auto_accept
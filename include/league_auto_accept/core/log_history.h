@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// The most recent lines of a log view, oldest evicted first. A log window
+// keeps a fixed line budget this way instead of a growing string it has to
+// copy and cut. Lines are stored as displayed, line break included.
+//
+// Not thread-safe; owned by the UI thread.
+class LogHistory {
+public:
+    // Throws std::invalid_argument for 0
+    explicit LogHistory(size_t max_lines);
+
+    // Returns how many characters the evicted lines had, so a view holding
+    // the same text can cut exactly that much from its front
+    size_t Append(std::string line);
+
+    size_t GetLineCount() const { return count_; }
+    size_t GetMaxLines() const { return lines_.size(); }
+    size_t GetTextLength() const { return text_length_; }
+    // 0 is the oldest line
+    const std::string& GetLine(size_t index) const;
+    std::string GetText() const;
+
+    void Clear();
+
+private:
+    std::vector<std::string> lines_;   // Ring, oldest at first_
+    size_t first_;
+    size_t count_;
+    size_t text_length_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
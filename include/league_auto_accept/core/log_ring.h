@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+struct LogEntry {
+    std::chrono::system_clock::time_point time;
+    std::string message;
+};
+
+// Bounded lock-free queue of log lines from any number of threads to one
+// consumer (Vyukov's bounded queue: a sequence number per slot).
+//
+// Push() never blocks and never waits for the consumer. When the ring is
+// full the line is dropped and counted instead. Only one thread at a time
+// may call Drain().
+class LogRing {
+public:
+    // Capacity is rounded up to a power of two; throws std::invalid_argument for 0
+    explicit LogRing(size_t capacity);
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    // Stamps the line with the current time; false if it was dropped
+    bool Push(std::string message);
+    bool Push(std::string message, std::chrono::system_clock::time_point time);
+
+    // Moves up to `max_entries` queued lines, oldest first, to the end of
+    // `entries`; returns how many
+    size_t Drain(std::vector<LogEntry>& entries, size_t max_entries = SIZE_MAX);
+
+    size_t GetCapacity() const { return mask_ + 1; }
+    uint64_t GetDroppedCount() const;
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogEntry entry;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> enqueue_position_;
+    alignas(64) size_t dequeue_position_;   // Consumer only
+    std::atomic<uint64_t> dropped_count_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "league_auto_accept/models/gameflow_state.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Poll interval per group of gameflow phases
+struct PollSchedule {
+    // Matchmaking and ReadyCheck: a ready check can pop at any moment
+    std::chrono::milliseconds active{250};
+    // None, Lobby, ChampSelect and phases we cannot read (no client yet)
+    std::chrono::milliseconds idle{2000};
+    // GameStart through EndOfGame: the next ready check is minutes away
+    std::chrono::milliseconds dormant{15000};
+
+    // Every interval positive and active <= idle <= dormant
+    bool IsValid() const;
+};
+
+// Picks the next poll deadline from the last known gameflow phase, and counts
+// how many polls that saved compared to polling at the fixed `active`
+// interval the whole time.
+//
+// Interval lookups are const and thread-safe. RecordPoll() and ResetClock()
+// belong to the polling thread; the counters can be read from any thread.
+class PollScheduler {
+public:
+    // Throws std::invalid_argument if the schedule is not valid
+    explicit PollScheduler(const PollSchedule& schedule = PollSchedule());
+
+    const PollSchedule& GetSchedule() const { return schedule_; }
+
+    std::chrono::milliseconds GetInterval(models::GameflowPhase phase) const;
+    // Phase string as the LCU reports it; unknown or empty phases get `idle`
+    std::chrono::milliseconds GetInterval(std::string_view phase) const;
+
+    // Records a poll issued at `now`
+    void RecordPoll(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+    // Forgets the previous poll, so time spent not polling (e.g. while the
+    // event stream is up) is not counted as saved
+    void ResetClock();
+
+    uint64_t GetPollCount() const;
+    uint64_t GetRequestsSaved() const;
+    void ResetStats();
+
+private:
+    PollSchedule schedule_;
+
+    bool has_last_poll_;
+    std::chrono::steady_clock::time_point last_poll_;
+
+    std::atomic<uint64_t> poll_count_;
+    std::atomic<uint64_t> requests_saved_;
+    // Time since the previous poll not yet worth a whole `active` interval
+    std::chrono::microseconds carry_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "league_auto_accept/core/process_source.h"
+#include <string>
+
+namespace league_auto_accept {
+namespace core {
+
+// Process source on a procfs tree: ids are the numeric entries of the root,
+// names come from <pid>/comm and paths from the <pid>/exe link. The root is
+// configurable so benchmarks can point it at a synthetic tree.
+class ProcProcessSource : public ProcessSource {
+public:
+    explicit ProcProcessSource(std::string root = "/proc");
+
+    bool ListProcessIds(std::vector<uint32_t>& process_ids) override;
+    bool GetProcessName(uint32_t process_id, std::string& name) override;
+    bool GetExecutablePath(uint32_t process_id, std::string& path) override;
+
+    std::string GetLastError() const override;
+
+private:
+    std::string root_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
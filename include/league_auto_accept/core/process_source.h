@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Enumerates the processes of the system, split by cost: listing the ids is
+// the cheap part done every check, the name is looked up once per new
+// process, and the executable path only for processes that matched.
+//
+// A source is used by one thread at a time.
+class ProcessSource {
+public:
+    virtual ~ProcessSource() = default;
+
+    // Every running process id, in no particular order
+    virtual bool ListProcessIds(std::vector<uint32_t>& process_ids) = 0;
+    // Executable file name, e.g. "LeagueClient.exe"
+    virtual bool GetProcessName(uint32_t process_id, std::string& name) = 0;
+    virtual bool GetExecutablePath(uint32_t process_id, std::string& path) = 0;
+
+    virtual std::string GetLastError() const = 0;
+};
+
+// ToolHelp process snapshots on Windows, /proc everywhere else
+std::unique_ptr<ProcessSource> CreatePlatformProcessSource();
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace league_auto_accept {
+namespace core {
+
+// Working set (resident set on Linux) of this process in MB, 0 if unavailable
+double GetProcessMemoryUsageMB();
+
+// System-wide CPU usage between consecutive Sample() calls. The first call
+// only records a baseline and returns 0. Not thread-safe.
+class CpuUsageSampler {
+public:
+    CpuUsageSampler();
+
+    // Busy percentage in [0, 100] since the previous call
+    double Sample();
+
+private:
+    uint64_t last_idle_;
+    uint64_t last_total_;
+    bool has_baseline_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "league_auto_accept/core/process_source.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Keeps the system's process set between checks and only does per-process
+// work for the difference: each Update() lists the ids, looks up the name of
+// processes it has not seen before and forgets the ones that exited.
+//
+// Not thread-safe; the owner serializes access.
+class ProcessTracker {
+public:
+    struct UpdateStats {
+        size_t started = 0;
+        size_t exited = 0;
+        size_t name_lookups = 0;
+    };
+
+    // Throws std::invalid_argument without a source
+    explicit ProcessTracker(std::unique_ptr<ProcessSource> source);
+
+    bool Update();
+
+    // Processes whose executable name matches, case-insensitively
+    bool FindProcess(std::string_view name, uint32_t& process_id) const;
+    std::vector<uint32_t> FindAllProcesses(std::string_view name) const;
+    bool IsTracked(uint32_t process_id) const;
+    // Name as resolved when the process was first seen
+    bool GetProcessName(uint32_t process_id, std::string& name) const;
+
+    size_t GetProcessCount() const;
+    const UpdateStats& GetLastUpdateStats() const;
+    ProcessSource& GetSource();
+
+    // Forgets every process; the next Update() resolves them all again
+    void Clear();
+
+private:
+    struct TrackedProcess {
+        uint32_t process_id;
+        std::string name;   // Empty when the lookup failed (e.g. access denied)
+    };
+
+    const TrackedProcess* FindTracked(uint32_t process_id) const;
+
+    std::unique_ptr<ProcessSource> source_;
+    std::vector<TrackedProcess> processes_;   // Sorted by id
+    std::vector<TrackedProcess> merged_;      // Next set, swapped in by Update()
+    std::vector<uint32_t> current_ids_;
+    UpdateStats last_stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_transport.h"
+#include <array>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+class LCUSession;
+
+// Accept endpoints in the order they are tried on a fresh client. Older or
+// regional client builds only answer some of them.
+constexpr std::array<const char*, 3> READY_CHECK_ACCEPT_ENDPOINTS = {
+    GetLCUEndpoint(LCUEndpointId::ACCEPT_MATCHMAKING).path,
+    GetLCUEndpoint(LCUEndpointId::ACCEPT_LOBBY).path,
+    GetLCUEndpoint(LCUEndpointId::ACCEPT_GAMEFLOW).path
+};
+
+// In Matchmaking the accept connection is checked when idle this long, so
+// the accept finds it open rather than dropped by the client
+constexpr std::chrono::milliseconds ACCEPT_KEEP_WARM_INTERVAL{5000};
+
+enum class AcceptStage {
+    DISPATCH,   // Detection until the accept POST is sent
+    POST,       // Accept POST round trip, including endpoint fallbacks
+    VERIFY,     // After-the-fact ready-check GET
+    TOTAL       // Detection until the accept (and verification, if run) completed
+};
+
+constexpr size_t ACCEPT_STAGE_COUNT = 4;
+
+const char* AcceptStageToString(AcceptStage stage);
+
+struct AcceptResult {
+    bool accepted = false;
+    bool verified = false;          // Ready-check state read back as "Accepted"
+    const char* endpoint = "";      // Endpoint that took the accept, from READY_CHECK_ACCEPT_ENDPOINTS
+    int status_code = 0;            // Status of the last POST
+    std::string error_code;         // LCU errorCode of the last failed POST
+    int attempts = 0;               // POSTs sent, > 1 only while learning the endpoint
+    bool deadline_reached = false;  // Stopped because the ready check expired
+    std::chrono::steady_clock::time_point detected_at;
+    std::array<std::chrono::microseconds, ACCEPT_STAGE_COUNT> stage_latency{};
+
+    std::chrono::microseconds GetStageLatency(AcceptStage stage) const {
+        return stage_latency[static_cast<size_t>(stage)];
+    }
+};
+
+// Latency-first ready-check acceptance.
+//
+// Accept() sends the accept POST straight away, without reading the ready
+// check first, and treats any 2xx (the LCU answers 204) as success. The
+// endpoint that worked is cached so later ready checks cost one round trip.
+// Endpoints that answer 404 on this client build are skipped. Verify() reads
+// the ready check back afterwards and is off the critical path.
+class ReadyCheckAcceptor {
+public:
+    // The body only needs to stay valid until the next call
+    using SendFunction = std::function<HttpResponseView(HttpMethod method, std::string_view path)>;
+
+    explicit ReadyCheckAcceptor(LCUSession& session);
+    explicit ReadyCheckAcceptor(SendFunction send);
+
+    // No POST is sent at or after `deadline`, when the client has dropped
+    // the ready check anyway; fallbacks to other endpoints stop there too
+    AcceptResult Accept(std::chrono::steady_clock::time_point detected_at = std::chrono::steady_clock::now(),
+                        std::chrono::steady_clock::time_point deadline =
+                            std::chrono::steady_clock::time_point::max());
+    bool Verify(AcceptResult& result);
+
+    // Forget the learned endpoint, e.g. after the client restarted
+    void ResetEndpointCache();
+    const char* GetCachedEndpoint() const;
+    // Where the next Accept() posts first; the one to pre-warm
+    const char* GetNextEndpoint() const;
+
+private:
+    SendFunction send_;
+    int cached_endpoint_index_;   // -1 until an accept succeeded
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_transport.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace league_auto_accept {
+namespace core {
+
+struct RetryPolicyConfig {
+    // Attempts per request, the first one included
+    int max_attempts = 4;
+    // Backoff before retry n is initial_backoff * multiplier^(n-1), capped
+    std::chrono::milliseconds initial_backoff{25};
+    std::chrono::milliseconds max_backoff{1000};
+    double backoff_multiplier = 2.0;
+    // Fraction of the backoff drawn at random: a delay lies in
+    // [(1 - jitter) * backoff, backoff]
+    double jitter = 0.5;
+    // Retries an endpoint may spend per budget_window, refilled evenly;
+    // once spent, failures on that endpoint are returned at once
+    int retry_budget = 20;
+    std::chrono::milliseconds budget_window{10000};
+};
+
+enum class RetryOutcome {
+    SUCCEEDED,
+    NOT_RETRYABLE,        // Failed with an answer a retry would not change
+    ATTEMPTS_EXHAUSTED,
+    BUDGET_EXHAUSTED,     // The endpoint's retry budget is spent
+    DEADLINE_REACHED,     // The next attempt could not start before the deadline
+    REFUSED               // The caller turned the next retry down
+};
+
+const char* RetryOutcomeToString(RetryOutcome outcome);
+
+struct RetryResult {
+    HttpResponse response;   // Of the last attempt; empty if none was made
+    RetryOutcome outcome = RetryOutcome::DEADLINE_REACHED;
+    int attempts = 0;
+    std::chrono::microseconds waited{0};   // Between attempts
+
+    bool IsSuccess() const { return outcome == RetryOutcome::SUCCEEDED; }
+};
+
+// No response at all (status 0), a timeout, throttling or a server error
+bool IsRetryableStatus(int status_code);
+bool IsRetryableResponse(const HttpResponse& response);
+
+// A backoff wait that another thread can cut short, e.g. once a background
+// reconnect makes a retry worth trying right away
+class RetryWaiter {
+public:
+    // Blocks for `timeout`, or until Wake() is called after this call
+    // started. True when woken.
+    bool WaitFor(std::chrono::nanoseconds timeout);
+    void Wake();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable wake_cv_;
+    uint64_t generation_ = 0;
+};
+
+// Jittered exponential backoff with a retry budget per endpoint and an
+// overall deadline. Retries never start past the deadline, and a backoff
+// that would end after it stops the request instead of sleeping. The
+// budget keeps a dead or overloaded client from turning every call into
+// max_attempts calls.
+//
+// Execute() and the budget calls are thread-safe.
+class RetryPolicy {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Attempt = std::function<HttpResponse()>;
+    using FailureCallback = std::function<void(const HttpResponse&)>;
+    // Asked right before each retry; false ends the request
+    using RetryCheck = std::function<bool()>;
+
+    struct Stats {
+        uint64_t requests = 0;
+        uint64_t attempts = 0;
+        uint64_t succeeded = 0;
+        uint64_t budget_exhausted = 0;
+        uint64_t deadline_reached = 0;
+    };
+
+    // Throws std::invalid_argument for no attempts, a negative budget or
+    // backoff, a multiplier below 1, jitter outside [0, 1] or an empty window
+    explicit RetryPolicy(const RetryPolicyConfig& config = RetryPolicyConfig(),
+                         uint32_t seed = std::random_device{}());
+
+    const RetryPolicyConfig& GetConfig() const { return config_; }
+
+    // Jittered delay before retry `retry` (1 for the first retry)
+    std::chrono::milliseconds GetBackoff(int retry);
+
+    // Takes one retry from the endpoint's budget; false when none is left
+    bool TryConsumeBudget(const std::string& endpoint, Clock::time_point now = Clock::now());
+    int GetRemainingBudget(const std::string& endpoint, Clock::time_point now = Clock::now());
+
+    // Calls `attempt` until it succeeds or fails for good. Backoffs wait on
+    // `waiter` when given, so Wake() starts the next attempt early;
+    // `on_failure` sees every retryable failure, e.g. to ask for a
+    // reconnect. A retry `may_retry` turns down ends the request as REFUSED
+    // and costs no budget. A deadline already passed makes no attempt at all.
+    RetryResult Execute(const std::string& endpoint, Clock::time_point deadline, const Attempt& attempt,
+                        RetryWaiter* waiter = nullptr, const FailureCallback& on_failure = nullptr,
+                        const RetryCheck& may_retry = nullptr);
+
+    Stats GetStats() const;
+    void ResetStats();
+
+private:
+    struct Budget {
+        double tokens = 0.0;
+        Clock::time_point refilled_at;
+    };
+
+    // Callers hold budget_mutex_
+    Budget& RefillBudget(const std::string& endpoint, Clock::time_point now);
+
+    RetryPolicyConfig config_;
+
+    std::mutex random_mutex_;
+    std::mt19937 random_;
+
+    std::mutex budget_mutex_;
+    std::unordered_map<std::string, Budget> budgets_;
+
+    std::atomic<uint64_t> requests_;
+    std::atomic<uint64_t> attempts_;
+    std::atomic<uint64_t> succeeded_;
+    std::atomic<uint64_t> budget_exhausted_;
+    std::atomic<uint64_t> deadline_reached_;
+};
+
+// Runs reconnects on a thread of its own so the caller's retry loop keeps
+// its deadline instead of sitting through lockfile discovery and a TLS
+// handshake. Requests made while a reconnect runs fold into one more run,
+// if any. A successful reconnect wakes `waiter`.
+class BackgroundReconnector {
+public:
+    // Returns true once connected again
+    using ReconnectFunction = std::function<bool()>;
+
+    explicit BackgroundReconnector(ReconnectFunction reconnect, RetryWaiter* waiter = nullptr);
+    ~BackgroundReconnector();
+
+    BackgroundReconnector(const BackgroundReconnector&) = delete;
+    BackgroundReconnector& operator=(const BackgroundReconnector&) = delete;
+
+    // Never blocks on the reconnect; the thread starts on the first request
+    void Request();
+    bool IsReconnecting() const;
+    // Waits for a running reconnect; later requests are ignored
+    void Stop();
+
+    uint64_t GetAttemptCount() const { return attempts_.load(); }
+    uint64_t GetSuccessCount() const { return successes_.load(); }
+
+private:
+    void Run();
+
+    ReconnectFunction reconnect_;
+    RetryWaiter* waiter_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable request_cv_;
+    bool requested_;
+    bool running_;
+    bool stopping_;
+    std::thread thread_;
+
+    std::atomic<uint64_t> attempts_;
+    std::atomic<uint64_t> successes_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "league_auto_accept/core/screen_capture.h"
+#include <cstdint>
+
+namespace league_auto_accept {
+namespace core {
+
+// Part of a window, as fractions of its client area
+struct RelativeRegion {
+    double x;
+    double y;
+    double width;
+    double height;
+};
+
+// Hash of a frame's pixels and size; row padding is not included
+uint64_t HashFramePixels(const Frame& frame);
+
+// Captures only the region of the League client where the ready-check
+// Accept button appears, into one frame reused between captures, and tells
+// whether those pixels changed since the previous capture. A detector can
+// skip matching for a frame that hashes the same as one it already matched.
+//
+// Not thread-safe; owned by the detection thread.
+class RoiCapture {
+public:
+    // Around the Accept button of the ready-check overlay, with margin for
+    // the client's window sizes and a scaled template
+    static constexpr RelativeRegion ACCEPT_BUTTON_REGION = {0.35, 0.65, 0.30, 0.22};
+
+    struct Result {
+        bool captured = false;
+        // False when the pixels hash the same as the previous capture of the
+        // same rect; always true after Invalidate()
+        bool changed = false;
+        uint64_t hash = 0;
+        CaptureRect rect;   // Screen rect that was captured
+    };
+
+    struct Stats {
+        uint64_t captures = 0;
+        uint64_t unchanged = 0;
+        uint64_t failures = 0;
+    };
+
+    // The source must outlive the capture
+    explicit RoiCapture(CaptureSource& source, RelativeRegion region = ACCEPT_BUTTON_REGION);
+
+    // The region of `window` (the client area, in screen pixels) clipped to
+    // the screen; empty when nothing of it is on screen
+    CaptureRect ComputeRect(const CaptureRect& window) const;
+
+    Result Capture(const CaptureRect& window);
+
+    // Valid until the next Capture()
+    const Frame& GetFrame() const { return frame_; }
+
+    // The next capture reports a change, e.g. after the template changed
+    void Invalidate();
+
+    void SetRegion(RelativeRegion region);
+    RelativeRegion GetRegion() const { return region_; }
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    CaptureSource& source_;
+    RelativeRegion region_;
+    Frame frame_;
+    Stats stats_;
+    bool has_previous_;
+    uint64_t previous_hash_;
+    CaptureRect previous_rect_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
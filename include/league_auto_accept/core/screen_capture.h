@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Rectangle in screen pixels
+struct CaptureRect {
+    int x = 0;
+    int y = 0;
+    int width = 0;
+    int height = 0;
+
+    bool IsEmpty() const { return width <= 0 || height <= 0; }
+    // Overlap with `other`; empty when they do not touch
+    CaptureRect Intersect(const CaptureRect& other) const;
+
+    bool operator==(const CaptureRect& other) const {
+        return x == other.x && y == other.y && width == other.width && height == other.height;
+    }
+    bool operator!=(const CaptureRect& other) const { return !(*this == other); }
+};
+
+// Captured pixels: 8-bit BGR, top row first, rows padded to 4 bytes like a
+// 24-bit DIB so the buffer can be handed to GDI or wrapped by cv::Mat as is.
+// Resizing keeps the allocation, so a frame reused for the same region
+// never allocates after the first capture.
+struct Frame {
+    static constexpr int BYTES_PER_PIXEL = 3;
+
+    int width = 0;
+    int height = 0;
+    size_t stride = 0;
+    std::vector<uint8_t> pixels;
+
+    void Resize(int new_width, int new_height);
+    uint8_t* Row(int y) { return pixels.data() + static_cast<size_t>(y) * stride; }
+    const uint8_t* Row(int y) const { return pixels.data() + static_cast<size_t>(y) * stride; }
+};
+
+// Where captured pixels come from: the desktop on Windows, image files when
+// benchmarking elsewhere.
+//
+// A source is used by one thread at a time.
+class CaptureSource {
+public:
+    virtual ~CaptureSource() = default;
+
+    // Copies `rect` of the screen into `frame`, resizing it to the rect.
+    // Fails when the rect is empty or leaves the screen.
+    virtual bool Capture(const CaptureRect& rect, Frame& frame) = 0;
+    virtual CaptureRect GetScreenBounds() const = 0;
+
+    virtual std::string GetLastError() const = 0;
+};
+
+} // namespace core
+} // namespace league_auto_accept
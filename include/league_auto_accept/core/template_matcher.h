@@ -0,0 +1,165 @@
+#pragma once
+
+#include "league_auto_accept/core/screen_capture.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Single-channel float image for matching
+struct GrayImage {
+    int width = 0;
+    int height = 0;
+    std::vector<float> pixels;
+    // Running sums of pixels and squared pixels, (width + 1) x (height + 1);
+    // only present after ComputeSums()
+    std::vector<double> sums;
+    std::vector<double> square_sums;
+
+    // Keeps the allocation and drops the sums
+    void Resize(int new_width, int new_height);
+    float* Row(int y) { return pixels.data() + static_cast<size_t>(y) * width; }
+    const float* Row(int y) const { return pixels.data() + static_cast<size_t>(y) * width; }
+
+    void ComputeSums();
+    bool HasSums() const { return !sums.empty(); }
+};
+
+void ConvertToGray(const Frame& frame, GrayImage& gray);
+// Half the size, each pixel the mean of a 2x2 block
+void DownsampleGray(const GrayImage& source, GrayImage& half);
+// Bilinear
+void ResizeGray(const GrayImage& source, int width, int height, GrayImage& resized);
+
+// A template ready for correlation: pixels minus their mean, and the norm
+// of what is left
+struct TemplateLevel {
+    int width = 0;
+    int height = 0;
+    std::vector<float> centered;
+    double norm = 0.0;
+
+    // False for a flat template, which correlates with nothing
+    bool Build(const GrayImage& image);
+};
+
+// Normalized correlation coefficient (OpenCV's TM_CCOEFF_NORMED) of the
+// template placed at x, y; 0 for a flat window. Window statistics come from
+// the image's sums when it has them.
+double CorrelationAt(const GrayImage& image, const TemplateLevel& templ, int x, int y);
+
+struct PyramidMatchSettings {
+    // Scales tried, relative to the matcher's scale factor
+    double min_scale = 0.8;
+    double max_scale = 1.2;
+    double scale_step = 0.1;
+    double threshold = 0.8;
+    // At most this many halvings; fewer when the smallest scaled template
+    // would get under PyramidTemplateMatcher::MIN_COARSE_TEMPLATE_SIZE
+    int max_pyramid_levels = 3;
+    size_t candidates = 3;
+    // The best position is also tried at scales this much finer than
+    // scale_step, up to half a step either way; 1 tries none in between
+    int scale_subdivisions = 4;
+};
+
+// Finds a template at a range of scales, coarse to fine: every scale is
+// searched exhaustively on a downsampled copy of the image, and only the
+// best few candidates are searched again at full resolution, around where
+// they were found, and then at the scales in between. Scaled templates, and
+// their downsampled copies, are built once per template and scale factor
+// rather than per search.
+//
+// Not thread-safe; owned by the detecting thread.
+class PyramidTemplateMatcher {
+public:
+    struct Match {
+        bool found = false;
+        double confidence = 0.0;
+        int x = 0;       // Top-left corner in the searched image
+        int y = 0;
+        int width = 0;   // Size of the scaled template that matched
+        int height = 0;
+        double scale = 1.0;   // Relative scale times the scale factor
+    };
+
+    struct Stats {
+        uint64_t searches = 0;
+        uint64_t template_builds = 0;
+        uint64_t coarse_positions = 0;
+        uint64_t refined_positions = 0;
+    };
+
+    // Coarse candidates scoring this far below the threshold are not refined
+    static constexpr double COARSE_MARGIN = 0.25;
+    static constexpr int MIN_COARSE_TEMPLATE_SIZE = 8;
+    // Pixels searched around the centre found so far, per in-between scale
+    static constexpr int SCALE_REFINE_RADIUS = 2;
+
+    // Throws std::invalid_argument for settings that select no scale
+    explicit PyramidTemplateMatcher(const PyramidMatchSettings& settings = PyramidMatchSettings());
+
+    // BGR template at scale 1; false if it is empty or flat
+    bool SetTemplate(const Frame& template_image);
+    bool HasTemplate() const { return template_.width > 0; }
+
+    // Multiplies every scale, e.g. UI scale times DPI scale. The scaled
+    // templates are rebuilt on the next search only when it changes.
+    void SetScaleFactor(double factor);
+    double GetScaleFactor() const { return scale_factor_; }
+
+    // Throws std::invalid_argument like the constructor
+    void SetSettings(const PyramidMatchSettings& settings);
+    const PyramidMatchSettings& GetSettings() const { return settings_; }
+
+    Match Find(const Frame& image);
+
+    const Stats& GetStats() const { return stats_; }
+    int GetPyramidLevels() const { return pyramid_levels_; }
+    size_t GetScaleCount() const { return templates_.size(); }
+
+private:
+    struct FineTemplate {
+        double scale;
+        TemplateLevel full;
+    };
+
+    struct ScaledTemplate {
+        double scale;
+        TemplateLevel full;
+        TemplateLevel coarse;
+        std::vector<FineTemplate> neighbours;   // Scales up to half a step away
+    };
+
+    struct Candidate {
+        size_t template_index;
+        int x;   // Coarse coordinates
+        int y;
+        double score;
+    };
+
+    void EnsureTemplates();
+    void OfferCandidate(const Candidate& candidate);
+    // Correlates `templ` at every position within `radius` of x, y and
+    // keeps the best in `match`
+    void SearchAround(const TemplateLevel& templ, double scale, int x, int y, int radius, Match& match);
+
+    PyramidMatchSettings settings_;
+    double scale_factor_;
+    GrayImage template_;
+    bool templates_valid_;
+    std::vector<ScaledTemplate> templates_;
+    int pyramid_levels_;
+
+    // Reused between searches
+    std::vector<GrayImage> pyramid_;
+    std::vector<Candidate> candidates_;
+    GrayImage scratch_;
+
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+typedef struct ssl_st SSL;
+typedef struct ssl_ctx_st SSL_CTX;
+
+namespace league_auto_accept {
+namespace core {
+
+// Blocking TLS client socket used by the non-Windows LCU transports.
+//
+// Certificate verification is disabled because the LCU serves a self-signed
+// certificate on 127.0.0.1. Writes may raise SIGPIPE if the peer resets the
+// connection; hosts that care should ignore SIGPIPE.
+class TlsConnection {
+public:
+    TlsConnection();
+    ~TlsConnection();
+
+    TlsConnection(const TlsConnection&) = delete;
+    TlsConnection& operator=(const TlsConnection&) = delete;
+
+    bool Connect(const std::string& host, int port, std::chrono::milliseconds timeout);
+    void Close();
+    bool IsOpen() const;
+
+    bool WriteAll(const char* data, size_t size);
+
+    // Returns the number of bytes read, 0 on orderly shutdown and -1 on error
+    // or timeout
+    int Read(char* buffer, size_t size);
+
+    // Applies to subsequent reads; zero blocks until data or shutdown
+    void SetReadTimeout(std::chrono::milliseconds timeout);
+
+    // Waits until data is readable; returns false on timeout or error
+    bool WaitReadable(std::chrono::milliseconds timeout);
+
+    int GetSocket() const;
+    const std::string& GetLastError() const;
+
+private:
+    bool EnsureContext();
+    void SetError(const std::string& message);
+
+    int socket_fd_;
+    SSL_CTX* ssl_context_;
+    SSL* ssl_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/tls_connection.h"
+#include "league_auto_accept/core/websocket_frame.h"
+#include <mutex>
+#include <string>
+
+namespace league_auto_accept {
+namespace core {
+
+// LCU event stream over an OpenSSL WebSocket connection.
+// Used on Linux and for benchmarking against the local LCU stand-in.
+class TlsSocketEventStream : public LCUEventStream {
+public:
+    static constexpr size_t MAX_MESSAGE_SIZE = 4 * 1024 * 1024;
+
+    explicit TlsSocketEventStream(std::chrono::milliseconds connect_timeout);
+    ~TlsSocketEventStream() override;
+
+    bool Connect(const LCUCredentials& credentials) override;
+    void Close() override;
+    bool IsConnected() const override;
+
+    bool Subscribe(const std::string& topic) override;
+    bool ReadMessage(std::string& message) override;
+    void Interrupt() override;
+
+    std::string GetLastError() const override;
+
+private:
+    bool PerformHandshake(const LCUCredentials& credentials);
+    bool SendFrame(WebSocketOpcode opcode, std::string_view payload);
+    bool ReadFrame(WebSocketFrame& frame);
+
+    std::chrono::milliseconds connect_timeout_;
+    TlsConnection connection_;
+    std::string read_buffer_;
+    std::string write_buffer_;
+    WebSocketFrame frame_;
+
+    // Socket Interrupt() may shut down; guarded because it runs on another thread
+    std::mutex interrupt_mutex_;
+    int interruptible_fd_;
+
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_transport.h"
+#include "league_auto_accept/core/tls_connection.h"
+#include <array>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// HTTP/1.1 keep-alive transport over a single OpenSSL connection.
+// Used on Linux and for benchmarking against the local LCU stand-in.
+//
+// Open() serialises every request in LCU_ENDPOINTS, so sending one is a
+// single write of bytes built once per set of credentials. Responses are
+// read into one buffer kept for the connection and their bodies handed out
+// as views into it; chunked bodies are joined in place.
+class TlsSocketTransport : public LCUTransport {
+public:
+    explicit TlsSocketTransport(std::chrono::milliseconds timeout);
+    ~TlsSocketTransport() override;
+
+    bool Open(const LCUCredentials& credentials) override;
+    void Close() override;
+    bool IsOpen() const override;
+
+    HttpResponseView SendView(HttpMethod method, std::string_view path, std::string_view body = {}) override;
+    // Serialises the whole request; sending it is then a single write.
+    // Requests in the registry are prepared already.
+    void Prepare(HttpMethod method, std::string_view path) override;
+
+    int GetConnectionCount() const override;
+    std::string GetLastError() const override;
+
+private:
+    struct PreparedRequest {
+        HttpMethod method;
+        std::string path;
+        std::string bytes;
+    };
+
+    // Few requests are worth preparing; the oldest is dropped beyond this
+    static constexpr size_t MAX_PREPARED = 4;
+
+    bool EnsureConnected();
+    void BuildRequest(HttpMethod method, std::string_view path, std::string_view body, std::string& out) const;
+    const PreparedRequest* FindPrepared(HttpMethod method, std::string_view path) const;
+    bool ReadResponse(HttpResponseView& response);
+    bool FillBuffer();
+
+    std::chrono::milliseconds timeout_;
+    TlsConnection connection_;
+    LCUCredentials credentials_;
+    // Host, Authorization and Accept lines shared by every request
+    std::string common_headers_;
+    std::string request_buffer_;
+    // Indexed like LCU_ENDPOINTS
+    std::array<std::string, LCU_ENDPOINT_COUNT> endpoint_requests_;
+    std::vector<PreparedRequest> prepared_;
+    std::string read_buffer_;
+    // Bytes at the front of read_buffer_ holding the last response, whose
+    // body may still be viewed; dropped when the next request goes out
+    size_t consumed_;
+    bool open_;
+    int connection_count_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
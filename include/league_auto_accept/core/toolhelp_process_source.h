@@ -0,0 +1,30 @@
+#pragma once
+
+#include "league_auto_accept/core/process_source.h"
+#include <windows.h>
+#include <tlhelp32.h>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Process source on ToolHelp process snapshots. One TH32CS_SNAPPROCESS
+// snapshot yields ids and names together, so names are served from the last
+// snapshot; paths come from QueryFullProcessImageName rather than a module
+// snapshot of the process.
+class ToolhelpProcessSource : public ProcessSource {
+public:
+    bool ListProcessIds(std::vector<uint32_t>& process_ids) override;
+    bool GetProcessName(uint32_t process_id, std::string& name) override;
+    bool GetExecutablePath(uint32_t process_id, std::string& path) override;
+
+    std::string GetLastError() const override;
+
+private:
+    std::vector<PROCESSENTRY32W> snapshot_;   // Last snapshot, sorted by id
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
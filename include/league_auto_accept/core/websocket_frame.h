@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace league_auto_accept {
+namespace core {
+
+// Minimal RFC 6455 framing shared by the socket event stream and the LCU
+// stand-in. Only what the LCU uses is supported: text, close, ping and pong,
+// with fragmented messages reassembled by the caller.
+
+enum class WebSocketOpcode : uint8_t {
+    CONTINUATION = 0x0,
+    TEXT = 0x1,
+    BINARY = 0x2,
+    CLOSE = 0x8,
+    PING = 0x9,
+    PONG = 0xA
+};
+
+struct WebSocketFrame {
+    WebSocketOpcode opcode = WebSocketOpcode::TEXT;
+    bool final = true;
+    std::string payload;
+};
+
+constexpr const char* WEBSOCKET_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+// Appends an encoded frame to `out`. Clients must mask; servers must not.
+void EncodeWebSocketFrame(WebSocketOpcode opcode, std::string_view payload, bool mask, std::string& out);
+
+// Decodes one frame from the front of `buffer`. Returns the number of bytes
+// consumed, 0 if more data is needed, or std::string::npos if the frame is
+// malformed or larger than `max_payload`.
+size_t DecodeWebSocketFrame(std::string_view buffer, WebSocketFrame& frame, size_t max_payload);
+
+// Random base64 Sec-WebSocket-Key for a client handshake
+std::string GenerateWebSocketKey();
+
+// Sec-WebSocket-Accept value the server must echo for `key`
+std::string ComputeWebSocketAccept(std::string_view key);
+
+} // namespace core
+} // namespace league_auto_accept
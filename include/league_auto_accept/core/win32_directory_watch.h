@@ -0,0 +1,54 @@
+#pragma once
+
+#include "league_auto_accept/core/directory_watch.h"
+#include <windows.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// Directory watch on overlapped ReadDirectoryChangesW, one pending read per
+// directory. Interrupt() signals an event the wait includes.
+class Win32DirectoryWatch : public DirectoryWatch {
+public:
+    static constexpr DWORD NOTIFY_BUFFER_SIZE = 16 * 1024;
+
+    Win32DirectoryWatch();
+    ~Win32DirectoryWatch() override;
+
+    Win32DirectoryWatch(const Win32DirectoryWatch&) = delete;
+    Win32DirectoryWatch& operator=(const Win32DirectoryWatch&) = delete;
+
+    bool AddDirectory(const std::string& directory) override;
+    bool IsWatching(const std::string& directory) const override;
+
+    bool WaitForChanges(std::vector<std::string>& changed_paths, std::chrono::milliseconds timeout) override;
+    void Interrupt() override;
+
+    std::string GetLastError() const override;
+
+private:
+    struct WatchedDirectory {
+        std::string path;
+        HANDLE handle = INVALID_HANDLE_VALUE;
+        OVERLAPPED overlapped = {};
+        std::vector<DWORD> buffer;   // DWORD-aligned FILE_NOTIFY_INFORMATION records
+    };
+
+    bool IssueRead(WatchedDirectory& directory);
+    void CollectChanges(WatchedDirectory& directory, DWORD bytes, std::vector<std::string>& changed_paths);
+    void CloseDirectory(WatchedDirectory& directory);
+    void SetError(const std::string& message);
+
+    HANDLE interrupt_event_;
+    std::vector<std::unique_ptr<WatchedDirectory>> directories_;
+
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
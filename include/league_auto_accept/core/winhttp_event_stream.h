@@ -0,0 +1,49 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include <windows.h>
+#include <winhttp.h>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace core {
+
+// LCU event stream on top of the WinHTTP WebSocket API
+class WinHttpEventStream : public LCUEventStream {
+public:
+    static constexpr size_t MAX_MESSAGE_SIZE = 4 * 1024 * 1024;
+
+    explicit WinHttpEventStream(std::chrono::milliseconds connect_timeout);
+    ~WinHttpEventStream() override;
+
+    bool Connect(const LCUCredentials& credentials) override;
+    void Close() override;
+    bool IsConnected() const override;
+
+    bool Subscribe(const std::string& topic) override;
+    bool ReadMessage(std::string& message) override;
+    void Interrupt() override;
+
+    std::string GetLastError() const override;
+
+private:
+    HINTERNET GetWebSocket() const;
+    void SetError(const std::string& message);
+
+    std::chrono::milliseconds connect_timeout_;
+    HINTERNET session_;
+    HINTERNET connect_;
+
+    // Closed by Interrupt() from another thread, which cancels a pending receive
+    mutable std::mutex websocket_mutex_;
+    HINTERNET websocket_;
+
+    std::vector<char> receive_buffer_;
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_transport.h"
+#include <windows.h>
+#include <winhttp.h>
+#include <array>
+#include <string>
+
+namespace league_auto_accept {
+namespace core {
+
+// WinHTTP transport holding one session and one connect handle for the
+// lifetime of the credentials. WinHTTP pools the keep-alive TLS connection
+// under the connect handle, so only the per-request handle is created on
+// each poll. Bodies are read straight into one buffer kept across requests.
+class WinHttpTransport : public LCUTransport {
+public:
+    explicit WinHttpTransport(std::chrono::milliseconds timeout);
+    ~WinHttpTransport() override;
+
+    bool Open(const LCUCredentials& credentials) override;
+    void Close() override;
+    bool IsOpen() const override;
+
+    HttpResponseView SendView(HttpMethod method, std::string_view path, std::string_view body = {}) override;
+    // Opens the request handle, with its TLS options and headers, ahead of
+    // time. A handle serves one request, so the latest Prepare() wins and
+    // SendView() opens the next one after the response is in.
+    void Prepare(HttpMethod method, std::string_view path) override;
+
+    int GetConnectionCount() const override;
+    std::string GetLastError() const override;
+
+private:
+    HINTERNET OpenRequestHandle(HttpMethod method, std::string_view path);
+    void ClosePrepared();
+
+    std::chrono::milliseconds timeout_;
+    HINTERNET session_;
+    HINTERNET connect_;
+    std::wstring auth_header_;
+    // Wide paths of LCU_ENDPOINTS, converted once in Open()
+    std::array<std::wstring, LCU_ENDPOINT_COUNT> endpoint_paths_;
+    std::wstring path_buffer_;
+    HINTERNET prepared_request_;
+    HttpMethod prepared_method_;
+    std::string prepared_path_;
+    // Body of the last response; cleared, never shrunk
+    std::string body_buffer_;
+    int connection_count_;
+    std::string last_error_;
+};
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,216 @@
+#pragma once
+
+#include "league_auto_accept/core/hybrid_detector.h"
+#include "league_auto_accept/core/lcu_health.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_request_pool.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include "league_auto_accept/core/retry_policy.h"
+#include "league_auto_accept/models/gameflow_state.h"
+#include "league_auto_accept/models/lcu_connection_info.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace league_auto_accept {
+
+namespace models {
+class PerformanceMetrics;
+}
+
+enum class LCURequestResult {
+    SUCCESS,
+    CONNECTION_ERROR,
+    AUTHENTICATION_ERROR,
+    NOT_FOUND,
+    TIMEOUT,
+    UNKNOWN_ERROR
+};
+
+struct LCUResponse {
+    LCURequestResult result = LCURequestResult::UNKNOWN_ERROR;
+    int status_code = 0;   // 0 when the client never answered
+    std::string body;
+    std::chrono::milliseconds latency{0};
+    std::string error_message;
+
+    LCUResponse() = default;
+    explicit LCUResponse(LCURequestResult request_result) : result(request_result) {}
+
+    bool IsSuccess() const { return result == LCURequestResult::SUCCESS; }
+};
+
+// /lol-matchmaking/v1/ready-check as the client reports it
+struct ReadyCheckStatus {
+    std::vector<int> decliner_ids;
+    std::string dodge_warning = "None";
+    std::string player_response = "None";
+    std::string state;
+    bool suppress_ux = false;
+    double timer = 0.0;   // Seconds since the ready check popped
+
+    bool IsActive() const { return state == "InProgress"; }
+    bool HasTimeRemaining() const { return timer < core::ReadyCheckView::DURATION_SECONDS; }
+};
+
+// League client API for the Application front-end: discovers the client
+// from its lockfile and talks to it over one keep-alive session. Registry
+// requests go through per-endpoint breakers and a retry policy; accepts go
+// through the ReadyCheckAcceptor with a single attempt each.
+//
+// The request methods may be called from the detection thread and the
+// hybrid detector's LCU lane at once; the rest belongs to the owner.
+class LCUClient {
+public:
+    using ConnectionStateCallback = std::function<void(bool connected, const std::string& error)>;
+
+    static constexpr int DEFAULT_TIMEOUT_MS = 5000;
+    static constexpr int DEFAULT_MAX_RETRIES = 3;
+    static constexpr int DEFAULT_RETRY_DELAY_MS = 100;
+    static constexpr int RETRY_MAX_BACKOFF_MS = 1000;
+    static constexpr size_t ASYNC_WORKERS = 2;
+    static constexpr size_t ASYNC_MAX_QUEUED = 32;
+
+    static constexpr const char* GAMEFLOW_ENDPOINT = core::GAMEFLOW_PHASE_URI;
+    static constexpr const char* READY_CHECK_ENDPOINT = core::READY_CHECK_URI;
+    static constexpr const char* READY_CHECK_ACCEPT_ENDPOINT = "/lol-matchmaking/v1/ready-check/accept";
+    static constexpr const char* READY_CHECK_DECLINE_ENDPOINT = "/lol-matchmaking/v1/ready-check/decline";
+
+    LCUClient();
+    explicit LCUClient(std::shared_ptr<models::PerformanceMetrics> metrics);
+    ~LCUClient();
+
+    LCUClient(const LCUClient&) = delete;
+    LCUClient& operator=(const LCUClient&) = delete;
+
+    // Reads the lockfile only; Connect() also opens and tests the session
+    bool Initialize();
+    bool Connect();
+    bool Reconnect();
+    void Disconnect();
+    bool IsConnected() const;
+    bool TestConnection();
+
+    models::LCUConnectionInfo GetConnectionInfo() const;
+    void SetConnectionStateCallback(ConnectionStateCallback callback) { connection_callback_ = std::move(callback); }
+
+    void SetConnectionTimeout(std::chrono::milliseconds timeout);
+    std::chrono::milliseconds GetConnectionTimeout() const;
+
+    LCUResponse GetGameflowPhase();
+    LCUResponse GetReadyCheckStatus();
+    LCUResponse AcceptReadyCheck();
+    LCUResponse DeclineReadyCheck();
+
+    // On the request pool's workers; a zero deadline means no deadline
+    core::AsyncLCURequest GetGameflowPhaseAsync(std::chrono::milliseconds deadline = {});
+    core::AsyncLCURequest GetReadyCheckStatusAsync(std::chrono::milliseconds deadline = {});
+    core::AsyncLCURequest AcceptReadyCheckAsync(std::chrono::milliseconds deadline = {});
+    core::AsyncLCURequest DeclineReadyCheckAsync(std::chrono::milliseconds deadline = {});
+    LCUResponse AwaitResponse(core::AsyncLCURequest& request);
+
+    // NONE when the phase could not be read
+    models::GameflowPhase GetCurrentGameflowPhase();
+    ReadyCheckStatus GetCurrentReadyCheckStatus();
+    // The hybrid detector's LCU lane; reads through the request pool
+    core::DetectorVerdict DetectReadyCheck();
+    bool IsReadyCheckActive();
+
+    bool AcceptCurrentReadyCheck();
+    core::AcceptResult AcceptCurrentReadyCheck(std::chrono::steady_clock::time_point detected_at);
+    // Nothing is sent after the earlier of `deadline` and the ready check's own
+    core::AcceptResult AcceptCurrentReadyCheck(std::chrono::steady_clock::time_point detected_at,
+                                               std::chrono::steady_clock::time_point deadline);
+    bool VerifyReadyCheckAccepted(core::AcceptResult& result);
+    // Readies the accept POST on the session while queued
+    bool PrewarmAccept();
+
+    void SetPerformanceMetrics(std::shared_ptr<models::PerformanceMetrics> metrics);
+    double GetAverageRequestLatency() const;
+    int GetSuccessfulRequestCount() const;
+    int GetFailedRequestCount() const;
+
+    // `retry_delay` is the first backoff; later ones double up to RETRY_MAX_BACKOFF_MS
+    void SetRetryPolicy(int max_retries, std::chrono::milliseconds retry_delay);
+    void SetRetryPolicy(const core::RetryPolicyConfig& config);
+    core::RetryPolicy::Stats GetRetryStats() const;
+    static core::RetryPolicyConfig MakeRetryPolicyConfig(int max_retries, std::chrono::milliseconds retry_delay);
+
+    void EnableAutoReconnect(bool enabled);
+    bool IsAutoReconnectEnabled() const;
+
+    const core::LCUHealthMonitor& GetHealth() const;
+    // When the current ready check expires: from its last read timer, else
+    // a full ready check after `detected_at`
+    std::chrono::steady_clock::time_point GetReadyCheckDeadline(std::chrono::steady_clock::time_point detected_at) const;
+    // A timer read elsewhere, e.g. from a pushed ready-check event; the
+    // next accepts and retries stop where the client drops the ready check
+    void UpdateReadyCheckTimer(double timer, std::chrono::steady_clock::time_point read_at);
+
+    static bool IsLCUAvailable();
+    static std::vector<int> FindLCUPorts();
+    // Throws std::invalid_argument for a body that is not a phase
+    static std::string ParseGameflowPhaseFromResponse(const std::string& response_body);
+    static ReadyCheckStatus ParseReadyCheckFromResponse(std::string_view response_body);
+
+private:
+    LCUResponse MakeRequest(core::HttpMethod method, const std::string& endpoint,
+                            const std::string& body = "", const std::string& content_type = "application/json");
+    LCUResponse MakeRequestWithRetry(core::HttpMethod method, const std::string& endpoint,
+                                     const std::string& body = "",
+                                     const std::string& content_type = "application/json");
+    std::chrono::steady_clock::time_point GetRetryDeadline(const std::string& endpoint) const;
+
+    std::shared_ptr<core::LCUSession> AcquireSession() const;
+    // Run by reconnector_ on its own thread
+    bool ReconnectInBackground();
+    void SetupSession();
+    void UpdateConnectionState(bool connected, const std::string& error = "");
+    void RecordRequestMetrics(const LCUResponse& response);
+    static LCUResponse ProcessHTTPResponse(core::HttpResponse&& response);
+    static LCURequestResult MapHTTPStatusToResult(int status_code);
+    std::string GetAuthHeader() const;
+
+    std::shared_ptr<models::PerformanceMetrics> performance_metrics_;
+    std::chrono::milliseconds connection_timeout_;
+    int max_retries_;
+    std::chrono::milliseconds retry_delay_;
+    std::atomic<bool> auto_reconnect_enabled_;
+
+    mutable std::mutex stats_mutex_;
+    int successful_requests_;
+    int failed_requests_;
+    std::chrono::milliseconds total_request_time_;
+
+    std::unique_ptr<core::RetryPolicy> retry_policy_;
+    // Backoffs wait here; a finished reconnect cuts them short
+    core::RetryWaiter retry_waiter_;
+    core::BackgroundReconnector reconnector_;
+    // Set by a reconnect, applied by the next accept on its own thread
+    std::atomic<bool> reset_endpoint_cache_;
+    core::LCURequestPool request_pool_;
+    core::ReadyCheckAcceptor ready_check_acceptor_;
+    // Body the acceptor's last response views
+    std::string acceptor_body_;
+    // Breakers of the registry endpoints; reset for every new client
+    core::LCUHealthMonitor health_;
+    // Written by the LCU lane as well as the detection thread
+    std::atomic<std::chrono::steady_clock::time_point> ready_check_deadline_{};
+
+    // A request in flight keeps its own reference to the session
+    mutable std::mutex session_mutex_;
+    std::shared_ptr<core::LCUSession> session_;
+    models::LCUConnectionInfo connection_info_;
+    std::string auth_header_;   // Encoded once per connection
+
+    ConnectionStateCallback connection_callback_;
+};
+
+} // namespace league_auto_accept
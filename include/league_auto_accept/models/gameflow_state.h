@@ -0,0 +1,226 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace league_auto_accept {
+namespace models {
+
+// Every phase /lol-gameflow/v1/gameflow-phase reports, in workflow order
+enum class GameflowPhase {
+    NONE,
+    LOBBY,
+    MATCHMAKING,
+    CHECKED_INTO_TOURNAMENT,
+    READY_CHECK,
+    CHAMPION_SELECT,
+    GAME_START,
+    FAILED_TO_LAUNCH,
+    IN_PROGRESS,
+    RECONNECT,
+    WAITING_FOR_STATS,
+    PRE_END_OF_GAME,
+    END_OF_GAME,
+    TERMINATED_IN_ERROR,
+    UNKNOWN             // A phase this build does not know
+};
+
+constexpr size_t GAMEFLOW_PHASE_COUNT = static_cast<size_t>(GameflowPhase::UNKNOWN) + 1;
+
+// Wire names, indexed by phase
+constexpr std::array<std::string_view, GAMEFLOW_PHASE_COUNT> GAMEFLOW_PHASE_NAMES = {
+    "None", "Lobby", "Matchmaking", "CheckedIntoTournament", "ReadyCheck", "ChampSelect", "GameStart",
+    "FailedToLaunch", "InProgress", "Reconnect", "WaitingForStats", "PreEndOfGame", "EndOfGame",
+    "TerminatedInError", "Unknown"
+};
+
+constexpr std::string_view GameflowPhaseName(GameflowPhase phase) {
+    return GAMEFLOW_PHASE_NAMES[static_cast<size_t>(phase)];
+}
+
+namespace detail {
+
+constexpr size_t PHASE_HASH_BUCKETS = 32;
+
+// Perfect over the wire names and the "InGame" alias: length, first and last
+// character put each in a bucket of its own
+constexpr size_t HashPhaseName(std::string_view name) {
+    return (name.size() + 7u * static_cast<unsigned char>(name.front()) + static_cast<unsigned char>(name.back())) &
+           (PHASE_HASH_BUCKETS - 1);
+}
+
+constexpr std::array<GameflowPhase, PHASE_HASH_BUCKETS> BuildPhaseBuckets() {
+    std::array<GameflowPhase, PHASE_HASH_BUCKETS> buckets{};
+    for (size_t i = 0; i < PHASE_HASH_BUCKETS; ++i) {
+        buckets[i] = GameflowPhase::UNKNOWN;
+    }
+    for (size_t i = 0; i + 1 < GAMEFLOW_PHASE_COUNT; ++i) {
+        buckets[HashPhaseName(GAMEFLOW_PHASE_NAMES[i])] = static_cast<GameflowPhase>(i);
+    }
+    // What this tool used to write for the in-game phase
+    buckets[HashPhaseName("InGame")] = GameflowPhase::IN_PROGRESS;
+    return buckets;
+}
+
+constexpr std::array<GameflowPhase, PHASE_HASH_BUCKETS> PHASE_BUCKETS = BuildPhaseBuckets();
+
+} // namespace detail
+
+// One hash and one compare; UNKNOWN for anything the client does not send
+constexpr GameflowPhase GameflowPhaseFromWire(std::string_view name) {
+    if (name.empty()) {
+        return GameflowPhase::UNKNOWN;
+    }
+    GameflowPhase phase = detail::PHASE_BUCKETS[detail::HashPhaseName(name)];
+    if (phase == GameflowPhase::UNKNOWN) {
+        return phase;
+    }
+    bool match = name == GameflowPhaseName(phase) || (phase == GameflowPhase::IN_PROGRESS && name == "InGame");
+    return match ? phase : GameflowPhase::UNKNOWN;
+}
+
+constexpr uint32_t GameflowPhaseBit(GameflowPhase phase) {
+    return 1u << static_cast<unsigned>(phase);
+}
+
+// Phases each phase can move to, one bit per target. Any phase can fall to
+// NONE, UNKNOWN or TERMINATED_IN_ERROR, and NONE and UNKNOWN lead anywhere.
+constexpr std::array<uint32_t, GAMEFLOW_PHASE_COUNT> BuildGameflowTransitions() {
+    using P = GameflowPhase;
+    constexpr uint32_t ANY = (1u << GAMEFLOW_PHASE_COUNT) - 1;
+    constexpr uint32_t ALWAYS = GameflowPhaseBit(P::NONE) | GameflowPhaseBit(P::UNKNOWN) |
+                                GameflowPhaseBit(P::TERMINATED_IN_ERROR);
+
+    std::array<uint32_t, GAMEFLOW_PHASE_COUNT> table{};
+    table[static_cast<size_t>(P::NONE)] = ANY;
+    table[static_cast<size_t>(P::LOBBY)] = GameflowPhaseBit(P::MATCHMAKING) | GameflowPhaseBit(P::CHECKED_INTO_TOURNAMENT) |
+        GameflowPhaseBit(P::CHAMPION_SELECT) | GameflowPhaseBit(P::GAME_START) | GameflowPhaseBit(P::IN_PROGRESS);
+    table[static_cast<size_t>(P::MATCHMAKING)] = GameflowPhaseBit(P::READY_CHECK) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::CHECKED_INTO_TOURNAMENT)] = GameflowPhaseBit(P::READY_CHECK) |
+        GameflowPhaseBit(P::CHAMPION_SELECT) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::READY_CHECK)] = GameflowPhaseBit(P::CHAMPION_SELECT) |
+        GameflowPhaseBit(P::MATCHMAKING) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::CHAMPION_SELECT)] = GameflowPhaseBit(P::GAME_START) | GameflowPhaseBit(P::IN_PROGRESS) |
+        GameflowPhaseBit(P::MATCHMAKING) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::GAME_START)] = GameflowPhaseBit(P::IN_PROGRESS) |
+        GameflowPhaseBit(P::FAILED_TO_LAUNCH) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::FAILED_TO_LAUNCH)] = GameflowPhaseBit(P::GAME_START) |
+        GameflowPhaseBit(P::RECONNECT) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::IN_PROGRESS)] = GameflowPhaseBit(P::RECONNECT) | GameflowPhaseBit(P::WAITING_FOR_STATS) |
+        GameflowPhaseBit(P::PRE_END_OF_GAME) | GameflowPhaseBit(P::END_OF_GAME) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::RECONNECT)] = GameflowPhaseBit(P::IN_PROGRESS) | GameflowPhaseBit(P::WAITING_FOR_STATS) |
+        GameflowPhaseBit(P::PRE_END_OF_GAME) | GameflowPhaseBit(P::END_OF_GAME) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::WAITING_FOR_STATS)] = GameflowPhaseBit(P::PRE_END_OF_GAME) |
+        GameflowPhaseBit(P::END_OF_GAME) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::PRE_END_OF_GAME)] = GameflowPhaseBit(P::END_OF_GAME) | GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::END_OF_GAME)] = GameflowPhaseBit(P::LOBBY) | GameflowPhaseBit(P::MATCHMAKING);
+    table[static_cast<size_t>(P::TERMINATED_IN_ERROR)] = GameflowPhaseBit(P::LOBBY);
+    table[static_cast<size_t>(P::UNKNOWN)] = ANY;
+
+    for (uint32_t& targets : table) {
+        targets |= ALWAYS;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, GAMEFLOW_PHASE_COUNT> GAMEFLOW_TRANSITIONS = BuildGameflowTransitions();
+
+// Staying in a phase is not a transition
+constexpr bool IsValidGameflowTransition(GameflowPhase from, GameflowPhase to) {
+    return (GAMEFLOW_TRANSITIONS[static_cast<size_t>(from)] & GameflowPhaseBit(to)) != 0;
+}
+
+enum class DetectionSource {
+    LCU_API,
+    UI_AUTOMATION
+};
+
+// Last known client phase and ready-check timing, with the source that
+// reported it. Transitions follow the client's lobby -> queue -> ready check
+// -> champ select -> game -> end of game workflow; NONE is reachable from
+// anywhere. Observers hear about changes of phase only, not about the same
+// phase read again.
+class GameflowState {
+public:
+    using TransitionObserver = std::function<void(GameflowPhase from, GameflowPhase to)>;
+
+    GameflowState();
+
+    GameflowPhase GetPhase() const { return phase_; }
+    bool IsReadyCheckActive() const { return ready_check_active_; }
+    int GetReadyCheckDuration() const { return ready_check_duration_; }
+    int GetReadyCheckRemaining() const { return ready_check_remaining_; }
+    DetectionSource GetDetectionSource() const { return detection_source_; }
+    // How long the source took to detect the ready check
+    std::chrono::microseconds GetDetectionLatency() const { return detection_latency_; }
+    std::chrono::steady_clock::time_point GetLastDetectionTime() const { return last_detection_time_; }
+
+    // Throws std::invalid_argument on a transition the client never makes;
+    // the current phase again is not a transition and does not throw
+    void SetPhase(GameflowPhase phase);
+    // For phases read off the client, where polling may have missed the
+    // steps in between: takes any phase. True when it changed.
+    bool ApplyObservedPhase(GameflowPhase phase);
+
+    // Observers run on the thread that changes the phase, in the order
+    // added. Returns an id for RemoveTransitionObserver().
+    size_t AddTransitionObserver(TransitionObserver observer);
+    void RemoveTransitionObserver(size_t id);
+
+    void SetReadyCheckActive(bool active);
+    void SetReadyCheckDuration(int duration);
+    void SetReadyCheckRemaining(int remaining);
+    void SetDetectionSource(DetectionSource source,
+                            std::chrono::microseconds latency = std::chrono::microseconds(0));
+
+    void UpdateDetectionTime();
+    bool IsStateRecent(std::chrono::seconds max_age = std::chrono::seconds(5)) const;
+    void Reset();
+
+    bool CanTransitionTo(GameflowPhase new_phase) const;
+    // Throws std::runtime_error on an invalid transition
+    void TransitionTo(GameflowPhase new_phase);
+
+    std::string GetPhaseString() const;
+    std::string GetDetectionSourceString() const;
+    bool IsValid() const;
+
+private:
+    void ChangePhase(GameflowPhase phase);
+    void ValidateReadyCheckTiming() const;
+
+    GameflowPhase phase_;
+    bool ready_check_active_;
+    int ready_check_duration_;
+    int ready_check_remaining_;
+    std::chrono::steady_clock::time_point last_detection_time_;
+    DetectionSource detection_source_;
+    std::chrono::microseconds detection_latency_;
+    std::vector<std::pair<size_t, TransitionObserver>> observers_;
+    size_t next_observer_id_;
+};
+
+std::string GameflowPhaseToString(GameflowPhase phase);
+// Throws std::invalid_argument on a phase the client never reports
+GameflowPhase StringToGameflowPhase(const std::string& phase_str);
+// Non-throwing variant for phases read straight off the LCU
+constexpr bool TryParseGameflowPhase(std::string_view phase_str, GameflowPhase& phase) {
+    GameflowPhase parsed = GameflowPhaseFromWire(phase_str);
+    if (parsed == GameflowPhase::UNKNOWN) {
+        return false;
+    }
+    phase = parsed;
+    return true;
+}
+std::string DetectionSourceToString(DetectionSource source);
+DetectionSource StringToDetectionSource(const std::string& source_str);
+
+} // namespace models
+} // namespace league_auto_accept
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "league_auto_accept/core/lockfile.h"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+namespace league_auto_accept {
+namespace models {
+
+enum class LCUConnectionState {
+    DISCONNECTED,
+    CONNECTING,
+    CONNECTED,
+    ERROR_STATE
+};
+
+// Port, credentials and state of the League client connection, discovered
+// from its lockfile. Not thread-safe; the LCU client guards its copy.
+class LCUConnectionInfo {
+public:
+    static constexpr int DEFAULT_LCU_PORT = 2999;
+    static constexpr int MIN_PORT = 1024;
+    static constexpr int MAX_PORT = 65535;
+
+    LCUConnectionInfo();
+
+    // Reads the lockfile and checks that the client process that wrote it
+    // is still running
+    bool DiscoverFromLockfile();
+    bool DiscoverFromLockfile(const std::filesystem::path& lockfile_path);
+
+    int GetPort() const { return port_; }
+    const std::string& GetAuthToken() const { return auth_token_; }
+    uint32_t GetProcessId() const { return process_id_; }
+    const std::string& GetBaseURL() const { return base_url_; }
+    const std::filesystem::path& GetLockfilePath() const { return lockfile_path_; }
+    // Throws std::runtime_error while not connected
+    std::string GetFullAPIURL(const std::string& endpoint) const;
+
+    LCUConnectionState GetConnectionState() const { return connection_state_; }
+    std::string GetConnectionStateString() const;
+    bool IsConnected() const { return connection_state_ == LCUConnectionState::CONNECTED; }
+    // Connected, with a successful request no older than `max_age`
+    bool IsConnectionRecent(std::chrono::seconds max_age) const;
+    // Leaving for DISCONNECTED or ERROR_STATE clears the connection details
+    void SetConnectionState(LCUConnectionState state);
+
+    void UpdateLastSuccessfulRequest();
+    std::chrono::steady_clock::time_point GetLastSuccessfulRequest() const { return last_successful_request_; }
+    void IncrementConnectionErrors();
+    void ClearConnectionErrors();
+    int GetConnectionErrors() const { return connection_errors_; }
+
+    void Reset();
+    bool IsValid() const;
+
+    // Where the client writes its lockfile; $LAA_LOCKFILE outside Windows
+    static std::filesystem::path GetDefaultLockfilePath();
+    static bool IsLeagueProcessRunning(uint32_t process_id);
+    // 0 when no League client is running
+    static uint32_t FindLeagueProcessId();
+
+private:
+    bool ValidatePort() const;
+    bool ValidateAuthToken() const;
+    bool ValidateProcessId() const;
+
+    bool ParseLockfileContent(const std::string& content);
+    bool ApplyLockfileInfo(const core::LockfileInfo& info);
+    void ConstructBaseURL();
+    bool ValidateLockfileFormat(const std::string& content) const;
+
+    int port_;
+    uint32_t process_id_;
+    LCUConnectionState connection_state_;
+    std::filesystem::path lockfile_path_;
+    std::chrono::steady_clock::time_point last_successful_request_;
+    int connection_errors_;
+    std::string base_url_;
+    std::string auth_token_;
+};
+
+std::string LCUConnectionStateToString(LCUConnectionState state);
+// Throws std::invalid_argument for an unknown name
+LCUConnectionState StringToLCUConnectionState(const std::string& state_str);
+
+} // namespace models
+} // namespace league_auto_accept
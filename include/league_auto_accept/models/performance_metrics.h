@@ -0,0 +1,148 @@
+#pragma once
+
+#include "league_auto_accept/core/latency_histogram.h"
+#include "league_auto_accept/core/process_stats.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace league_auto_accept {
+namespace models {
+
+// Detection / acceptance latency, match counters, error tracking and process
+// resource usage, checked against the targets the tool is specified for.
+// Latencies go into histograms, both since start (or the last reset) and over
+// a rolling window of recent minutes. Recording is lock-free; only the last
+// error message takes a mutex.
+class PerformanceMetrics {
+public:
+    static constexpr int DETECTION_TARGET_MS = 100;
+    static constexpr int ACCEPTANCE_TARGET_MS = 200;
+    // Latency targets hold when this percentile of the recent window is
+    // under them; without recent samples the whole history is used
+    static constexpr double LATENCY_TARGET_PERCENTILE = 99.0;
+    static constexpr std::chrono::minutes LATENCY_TARGET_WINDOW{5};
+    static constexpr double MEMORY_TARGET_MB = 30.0;
+    static constexpr double CPU_TARGET_PERCENT = 2.0;
+    static constexpr double SUCCESS_RATE_TARGET = 0.95;
+
+    PerformanceMetrics();
+
+    PerformanceMetrics(const PerformanceMetrics&) = delete;
+    PerformanceMetrics& operator=(const PerformanceMetrics&) = delete;
+
+    int GetDetectionLatencyMs() const;
+    int GetAcceptanceLatencyMs() const;
+    int GetTotalMatchesDetected() const;
+    int GetTotalMatchesAccepted() const;
+    double GetSuccessRate() const;
+    double GetMemoryUsageMB() const;
+    double GetCPUUsagePercent() const;
+    double GetUptimeHours() const;
+
+    std::string GetLastErrorMessage() const;
+    std::chrono::system_clock::time_point GetLastErrorTime() const;
+    int GetConsecutiveErrors() const;
+    int GetTotalErrors() const;
+
+    void RecordDetectionLatency(std::chrono::microseconds latency);
+    void RecordAcceptanceLatency(std::chrono::microseconds latency);
+    void RecordAcceptStageLatency(core::AcceptStage stage, std::chrono::microseconds latency);
+    // Records every stage the accept went through
+    void RecordAcceptResult(const core::AcceptResult& result);
+    // How far a scheduled detection pass woke from its deadline, and
+    // deadlines skipped because a pass overran (DeadlineTicker)
+    void RecordTickJitter(std::chrono::microseconds jitter);
+    void RecordMissedTicks(int count);
+    void RecordMatchDetected();
+    void RecordMatchAccepted();
+    // A ready check that expired before any accept path got it through
+    void RecordAcceptDeadlineMiss();
+    void RecordError(const std::string& error_message);
+    void ClearConsecutiveErrors();
+
+    void UpdateMemoryUsage();
+    void UpdateCPUUsage();
+
+    bool MeetsPerformanceTargets() const;
+    bool MeetsDetectionTarget() const;
+    bool MeetsAcceptanceTarget() const;
+    bool MeetsMemoryTarget() const;
+    bool MeetsCPUTarget() const;
+    bool MeetsSuccessRateTarget() const;
+
+    // Averages in milliseconds
+    double GetAverageDetectionLatency() const;
+    double GetAverageAcceptanceLatency() const;
+    std::chrono::microseconds GetLastAcceptStageLatency(core::AcceptStage stage) const;
+    double GetAverageAcceptStageLatencyUs(core::AcceptStage stage) const;
+    int GetDetectionCount() const;
+    int GetAcceptanceCount() const;
+    int GetMissedTicks() const;
+    int GetAcceptDeadlineMisses() const;
+
+    // Percentile in [0, 100] over every sample since the last reset
+    std::chrono::microseconds GetDetectionLatencyPercentile(double percentile) const;
+    std::chrono::microseconds GetAcceptanceLatencyPercentile(double percentile) const;
+    std::chrono::microseconds GetAcceptStageLatencyPercentile(core::AcceptStage stage, double percentile) const;
+    std::chrono::microseconds GetTickJitterPercentile(double percentile) const;
+
+    core::LatencyHistogram::Snapshot GetDetectionHistogram() const;
+    core::LatencyHistogram::Snapshot GetAcceptanceHistogram() const;
+    core::LatencyHistogram::Snapshot GetAcceptStageHistogram(core::AcceptStage stage) const;
+    core::LatencyHistogram::Snapshot GetTickJitterHistogram() const;
+    // Samples from the last `window`, up to RollingLatencyHistogram::MAX_WINDOW
+    core::LatencyHistogram::Snapshot GetRecentDetectionHistogram(std::chrono::seconds window) const;
+    core::LatencyHistogram::Snapshot GetRecentAcceptanceHistogram(std::chrono::seconds window) const;
+
+    // Adds the other instance's latency histograms (e.g. from another
+    // session) into this one's since-start histograms
+    void MergeLatencyStats(const PerformanceMetrics& other);
+
+    void Reset();
+    void ResetCounters();
+    void ResetLatencyStats();
+
+private:
+    static bool MeetsLatencyTarget(const core::LatencyHistogram::Snapshot& recent,
+                                   const core::LatencyHistogram::Snapshot& all, int target_ms);
+
+    double CalculateSuccessRate() const;
+    double GetCurrentMemoryUsageMB() const;
+    double GetCurrentCPUUsagePercent();
+
+    std::atomic<int> detection_latency_ms_;    // Last sample
+    std::atomic<int> acceptance_latency_ms_;   // Last sample
+    core::LatencyHistogram detection_histogram_;
+    core::LatencyHistogram acceptance_histogram_;
+    core::RollingLatencyHistogram recent_detection_;
+    core::RollingLatencyHistogram recent_acceptance_;
+
+    std::array<std::atomic<long long>, core::ACCEPT_STAGE_COUNT> accept_stage_last_us_;
+    std::array<core::LatencyHistogram, core::ACCEPT_STAGE_COUNT> accept_stage_histograms_;
+
+    core::LatencyHistogram tick_jitter_histogram_;
+    std::atomic<int> missed_ticks_;
+
+    std::atomic<int> total_matches_detected_;
+    std::atomic<int> total_matches_accepted_;
+    std::atomic<int> accept_deadline_misses_;
+
+    std::atomic<double> memory_usage_mb_;
+    std::atomic<double> cpu_usage_percent_;
+    core::CpuUsageSampler cpu_sampler_;   // Only touched by UpdateCPUUsage()
+
+    mutable std::mutex error_mutex_;
+    std::string last_error_message_;
+    std::chrono::system_clock::time_point last_error_time_;
+    std::atomic<int> consecutive_errors_;
+    std::atomic<int> total_errors_;
+
+    std::chrono::steady_clock::time_point start_time_;
+};
+
+} // namespace models
+} // namespace league_auto_accept
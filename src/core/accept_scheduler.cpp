@@ -0,0 +1,106 @@
+#include "league_auto_accept/core/accept_scheduler.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+std::chrono::steady_clock::time_point GetReadyCheckDeadline(double timer,
+                                                            std::chrono::steady_clock::time_point read_at) {
+    double remaining = std::max(ReadyCheckView::DURATION_SECONDS - timer, 0.0);
+    return read_at + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(remaining));
+}
+
+AcceptScheduler::AcceptScheduler(const AcceptSchedulerConfig& config)
+    : config_(config) {
+    if (config_.safety_factor < 0.0 || config_.min_safety_margin.count() < 0 ||
+        config_.max_safety_margin < config_.min_safety_margin ||
+        config_.estimate_weight <= 0.0 || config_.estimate_weight > 1.0) {
+        throw std::invalid_argument("Invalid accept scheduler configuration");
+    }
+}
+
+size_t AcceptScheduler::AddPath(const char* name, std::chrono::microseconds initial_estimate, PathFunction run) {
+    if (!run || initial_estimate.count() < 0) {
+        throw std::invalid_argument("Accept path needs a function and a non-negative estimate");
+    }
+    paths_.push_back(Path{name, initial_estimate, std::move(run), true});
+    order_.push_back(paths_.size() - 1);
+    return paths_.size() - 1;
+}
+
+void AcceptScheduler::SetPathEnabled(size_t path, bool enabled) {
+    paths_.at(path).enabled = enabled;
+}
+
+ScheduledAccept AcceptScheduler::Run(Clock::time_point deadline) {
+    ScheduledAccept result;
+    Clock::time_point start = Clock::now();
+    stats_.runs++;
+
+    // Fastest first; equal estimates keep the order they were added in
+    std::stable_sort(order_.begin(), order_.end(), [this](size_t a, size_t b) {
+        return paths_[a].estimate < paths_[b].estimate;
+    });
+
+    for (size_t index : order_) {
+        Path& path = paths_[index];
+        if (!path.enabled) {
+            continue;
+        }
+
+        Clock::time_point now = Clock::now();
+        if (now + path.estimate + GetSafetyMargin(path) > deadline) {
+            result.skipped++;
+            stats_.skipped_paths++;
+            continue;
+        }
+
+        result.started++;
+        bool accepted = path.run(deadline);
+        Clock::time_point end = Clock::now();
+
+        double duration = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(end - now).count());
+        double estimate = static_cast<double>(path.estimate.count());
+        path.estimate = std::chrono::microseconds(static_cast<long long>(
+            estimate + config_.estimate_weight * (duration - estimate)));
+
+        if (accepted) {
+            result.accepted = true;
+            result.path = path.name;
+            stats_.accepted++;
+            break;
+        }
+    }
+
+    Clock::time_point end = Clock::now();
+    result.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    if (!result.accepted && (result.skipped > 0 || end >= deadline)) {
+        result.deadline_missed = true;
+        stats_.deadline_misses++;
+    }
+    return result;
+}
+
+std::chrono::microseconds AcceptScheduler::GetEstimate(size_t path) const {
+    return paths_.at(path).estimate;
+}
+
+std::chrono::microseconds AcceptScheduler::GetSafetyMargin(size_t path) const {
+    return GetSafetyMargin(paths_.at(path));
+}
+
+std::chrono::microseconds AcceptScheduler::GetSafetyMargin(const Path& path) const {
+    auto margin = std::chrono::microseconds(static_cast<long long>(
+        static_cast<double>(path.estimate.count()) * config_.safety_factor));
+    return std::clamp<std::chrono::microseconds>(margin, config_.min_safety_margin, config_.max_safety_margin);
+}
+
+void AcceptScheduler::ResetStats() {
+    stats_ = Stats{};
+}
+
+} // namespace core
+} // namespace league_auto_accept
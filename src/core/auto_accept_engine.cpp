@@ -0,0 +1,607 @@
+#include "league_auto_accept/core/auto_accept_engine.h"
+#include "league_auto_accept/core/accept_scheduler.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/models/performance_metrics.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr std::chrono::milliseconds EXCEPTION_BACKOFF{1000};
+// "Still waiting" reminder every this many unsuccessful lockfile lookups
+constexpr int WAITING_LOG_INTERVAL = 40;
+// A "None" right after the queue may be the client lagging behind a ready
+// check that already popped; they last about 12s
+constexpr std::chrono::milliseconds STALE_NONE_WINDOW{15000};
+
+struct ReadyCheckSource {
+    LCUEndpointId endpoint;
+    const char* description;
+};
+
+// Probed when the gameflow phase reads "None" although a ready check may be up
+constexpr ReadyCheckSource READY_CHECK_SOURCES[] = {
+    {LCUEndpointId::READY_CHECK, "ready check status"},
+    {LCUEndpointId::MATCHMAKING_SEARCH, "matchmaking search state"},
+    {LCUEndpointId::GAMEFLOW_PHASE, "gameflow phase check"},
+    {LCUEndpointId::LOBBY_READY_CHECK, "lobby ready check"},
+    {LCUEndpointId::GAMEFLOW_SESSION, "gameflow session check"}
+};
+
+std::vector<std::string> ResolveLockfilePaths(const std::vector<std::string>& paths) {
+    return paths.empty() ? GetDefaultLockfilePaths() : paths;
+}
+
+// Non-empty and not an LCU error body
+bool IsUsableResponse(const HttpResponseView& response) {
+    std::string_view error_code;
+    return response.IsSuccess() && !response.body.empty() && !ParseErrorCode(response.body, error_code);
+}
+}
+
+AutoAcceptEngine::AutoAcceptEngine(const EngineConfig& config,
+                                   std::shared_ptr<models::PerformanceMetrics> metrics)
+    : AutoAcceptEngine(config, CreatePlatformTransport(config.request_timeout),
+                       CreatePlatformEventStream(), std::move(metrics)) {
+}
+
+AutoAcceptEngine::AutoAcceptEngine(const EngineConfig& config,
+                                   std::unique_ptr<LCUTransport> transport,
+                                   std::unique_ptr<LCUEventStream> event_stream,
+                                   std::shared_ptr<models::PerformanceMetrics> metrics)
+    : config_(config)
+    , metrics_(std::move(metrics))
+    , poll_scheduler_(config.poll_schedule)
+    , lockfile_watcher_(ResolveLockfilePaths(config.lockfile_paths))
+    , session_(std::move(transport))
+    , health_(config.health)
+    , acceptor_(session_)
+    , event_listener_(std::move(event_stream))
+    , running_(false)
+    , auto_accept_enabled_(true)
+    , client_connected_(false)
+    , cycle_arena_(config.cycle_arena_size)
+    , event_stream_logged_(false)
+    , logged_interval_(0)
+    , ready_check_handled_(false)
+    , connection_attempts_(0)
+    , priority_elevated_(false)
+    , phase_known_(false)
+    , scan_until_() {
+    config_.lockfile_paths = lockfile_watcher_.GetPaths();
+
+    // A new ready check may only follow another phase
+    gameflow_.AddTransitionObserver([this](models::GameflowPhase from, models::GameflowPhase to) {
+        if (to != models::GameflowPhase::READY_CHECK) {
+            ready_check_handled_ = false;
+        }
+        if (from == models::GameflowPhase::READY_CHECK) {
+            ready_check_deadline_ = std::chrono::steady_clock::time_point();
+        }
+        if (to == models::GameflowPhase::NONE &&
+            (from == models::GameflowPhase::MATCHMAKING || from == models::GameflowPhase::READY_CHECK)) {
+            scan_until_ = std::chrono::steady_clock::now() + STALE_NONE_WINDOW;
+        }
+    });
+}
+
+AutoAcceptEngine::~AutoAcceptEngine() {
+    Stop();
+}
+
+void AutoAcceptEngine::SetLogCallback(LogCallback callback) {
+    log_callback_ = std::move(callback);
+}
+
+void AutoAcceptEngine::SetPhaseCallback(PhaseCallback callback) {
+    phase_callback_ = std::move(callback);
+}
+
+void AutoAcceptEngine::SetAcceptCallback(AcceptCallback callback) {
+    accept_callback_ = std::move(callback);
+}
+
+bool AutoAcceptEngine::Start() {
+    if (running_.exchange(true)) {
+        return false;
+    }
+
+    if (detection_thread_.joinable()) {
+        detection_thread_.join();
+    }
+    detection_thread_ = std::thread([this]() { DetectionLoop(); });
+    return true;
+}
+
+void AutoAcceptEngine::Stop() {
+    running_ = false;
+    event_listener_.Stop(); // Wakes the loop if it is waiting for an event
+
+    if (detection_thread_.joinable() && detection_thread_.get_id() != std::this_thread::get_id()) {
+        detection_thread_.join();
+    }
+
+    // The last pass may have restarted the listener before it saw running_
+    event_listener_.Stop();
+    lockfile_watcher_.Stop();
+    session_.Reset();
+    client_connected_ = false;
+    event_stream_logged_ = false;
+    logged_interval_ = std::chrono::milliseconds(0);
+    ready_check_handled_ = false;
+    connection_attempts_ = 0;
+    poll_scheduler_.ResetClock();
+    gameflow_.Reset();
+    phase_known_ = false;
+    scan_until_ = std::chrono::steady_clock::time_point();
+
+    std::lock_guard<std::mutex> lock(phase_mutex_);
+    current_phase_.clear();
+}
+
+bool AutoAcceptEngine::IsRunning() const {
+    return running_.load();
+}
+
+void AutoAcceptEngine::RunOnce() {
+    RunPass(nullptr);
+}
+
+void AutoAcceptEngine::SetAutoAcceptEnabled(bool enabled) {
+    auto_accept_enabled_ = enabled;
+}
+
+bool AutoAcceptEngine::IsAutoAcceptEnabled() const {
+    return auto_accept_enabled_.load();
+}
+
+bool AutoAcceptEngine::IsClientConnected() const {
+    return client_connected_.load();
+}
+
+bool AutoAcceptEngine::IsEventStreamConnected() const {
+    return event_listener_.IsConnected();
+}
+
+std::string AutoAcceptEngine::GetCurrentPhase() const {
+    std::lock_guard<std::mutex> lock(phase_mutex_);
+    return current_phase_;
+}
+
+std::shared_ptr<models::PerformanceMetrics> AutoAcceptEngine::GetMetrics() const {
+    return metrics_;
+}
+
+const PollScheduler& AutoAcceptEngine::GetPollScheduler() const {
+    return poll_scheduler_;
+}
+
+const LCUHealthMonitor& AutoAcceptEngine::GetHealth() const {
+    return health_;
+}
+
+void AutoAcceptEngine::DetectionLoop() {
+    LCUEvent pushed_event;
+    bool has_pushed_event = false;
+    DeadlineTicker ticker(GetWaitInterval());
+
+    while (running_) {
+        try {
+            RunPass(has_pushed_event ? &pushed_event : nullptr);
+            UpdateThreadPriority();
+
+            // Block until the client pushes an event; the timeout is the
+            // phase's poll interval while the stream is down and a slow
+            // resync otherwise
+            has_pushed_event = WaitForNextPass(ticker, pushed_event);
+        } catch (const std::exception& e) {
+            Log({"Exception in detection loop: ", e.what()});
+            has_pushed_event = event_listener_.WaitForEvent(pushed_event, EXCEPTION_BACKOFF);
+            ticker.Reset();
+        }
+    }
+
+    if (priority_elevated_) {
+        SetCurrentThreadPriority(ThreadPriority::NORMAL);
+        priority_elevated_ = false;
+    }
+}
+
+bool AutoAcceptEngine::WaitForNextPass(DeadlineTicker& ticker, LCUEvent& pushed_event) {
+    std::chrono::milliseconds interval = GetWaitInterval();
+    if (interval != ticker.GetPeriod()) {
+        ticker.SetPeriod(interval);
+    }
+
+    // Rounded up: waking before the deadline would only wait again
+    auto timeout = std::chrono::ceil<std::chrono::milliseconds>(ticker.GetTimeUntilNextTick());
+    if (event_listener_.WaitForEvent(pushed_event, timeout)) {
+        // Events do not move the grid; the next poll is still due on time
+        return true;
+    }
+
+    uint64_t missed = ticker.GetStats().missed;
+    std::chrono::nanoseconds jitter = ticker.Tick();
+    if (metrics_) {
+        metrics_->RecordTickJitter(std::chrono::duration_cast<std::chrono::microseconds>(jitter));
+        if (ticker.GetStats().missed != missed) {
+            metrics_->RecordMissedTicks(static_cast<int>(ticker.GetStats().missed - missed));
+        }
+    }
+    return false;
+}
+
+void AutoAcceptEngine::UpdateThreadPriority() {
+    if (!config_.elevate_priority_in_queue) {
+        return;
+    }
+
+    models::GameflowPhase phase = gameflow_.GetPhase();
+    bool queued = phase == models::GameflowPhase::MATCHMAKING || phase == models::GameflowPhase::READY_CHECK;
+    if (queued == priority_elevated_) {
+        return;
+    }
+
+    // Tried once per queue; without the privilege the loop runs as before
+    priority_elevated_ = queued;
+    if (!SetCurrentThreadPriority(queued ? ThreadPriority::ELEVATED : ThreadPriority::NORMAL) && queued) {
+        Log("Could not raise detection thread priority - continuing at normal priority");
+    }
+}
+
+void AutoAcceptEngine::RunPass(const LCUEvent* pushed_event) {
+    // Everything the previous pass built goes at once
+    cycle_arena_.Reset();
+
+    if (!UpdateConnection()) {
+        return;
+    }
+
+    // Phase from the pushed event when there is one, otherwise by polling
+    // (fallback mode or periodic resync). Names are only kept for phases
+    // this build does not know.
+    models::GameflowPhase phase = gameflow_.GetPhase();
+    std::string_view wire_name;
+    std::pmr::string unknown_name(cycle_arena_.GetResource());
+    bool read = phase_known_;
+    if (pushed_event != nullptr) {
+        if (GetPhaseFromEvent(*pushed_event, wire_name)) {
+            phase = models::GameflowPhaseFromWire(wire_name);
+            read = true;
+
+            // A pushed ready check tells how long it has left
+            ReadyCheckView ready_check;
+            if (pushed_event->uri == READY_CHECK_URI && ParseReadyCheck(pushed_event->data, ready_check)) {
+                ready_check_deadline_ = GetReadyCheckDeadline(ready_check.timer, pushed_event->received_time);
+            }
+        } else if (phase == models::GameflowPhase::UNKNOWN) {
+            std::lock_guard<std::mutex> lock(phase_mutex_);
+            unknown_name.assign(current_phase_);
+            wire_name = unknown_name;
+        }
+    } else {
+        read = PollGameflowPhase(phase, unknown_name);
+        wire_name = unknown_name;
+        if (!event_listener_.IsConnected()) {
+            poll_scheduler_.RecordPoll();
+        }
+    }
+
+    if (!read) {
+        // Once the breaker opens its change is logged instead, not every refused poll
+        if (health_.GetState(LCUEndpointId::GAMEFLOW_PHASE) == BreakerState::CLOSED) {
+            Log("Failed to get game phase - LCU API error");
+        }
+        return;
+    }
+
+    HandlePhase(phase, wire_name,
+                pushed_event != nullptr ? pushed_event->received_time : std::chrono::steady_clock::now());
+}
+
+std::chrono::milliseconds AutoAcceptEngine::GetWaitInterval() {
+    if (event_listener_.IsConnected()) {
+        // Resyncs are not polls a fixed interval would have made either
+        poll_scheduler_.ResetClock();
+        logged_interval_ = std::chrono::milliseconds(0);
+        // In the queue they also keep the accept connection from idling out
+        return gameflow_.GetPhase() == models::GameflowPhase::MATCHMAKING ? ACCEPT_KEEP_WARM_INTERVAL
+                                                                          : LCUEventListener::RESYNC_INTERVAL;
+    }
+
+    std::chrono::milliseconds interval = poll_scheduler_.GetInterval(gameflow_.GetPhase());
+    // A client that stopped answering is not polled before its next probe
+    auto until_probe = std::chrono::ceil<std::chrono::milliseconds>(
+        health_.GetTimeUntilProbe(LCUEndpointId::GAMEFLOW_PHASE));
+    if (until_probe > interval) {
+        return until_probe;
+    }
+    if (client_connected_ && interval != logged_interval_) {
+        logged_interval_ = interval;
+        std::string phase = phase_known_ ? GetCurrentPhase() : std::string();
+        Log({"Polling every ", std::to_string(interval.count()), "ms", phase_known_ ? " (" : "", phase,
+             phase_known_ ? ")" : "", " - ", std::to_string(poll_scheduler_.GetRequestsSaved()),
+             " requests saved so far"});
+    }
+    return interval;
+}
+
+bool AutoAcceptEngine::UpdateConnection() {
+    if (!lockfile_watcher_.GetLockfile(lockfile_)) {
+        if (client_connected_) {
+            Log("Lost connection to League client");
+            client_connected_ = false;
+            session_.Reset();
+            event_listener_.Stop();
+            event_stream_logged_ = false;
+            ready_check_handled_ = false;
+            gameflow_.Reset();
+            phase_known_ = false;
+            scan_until_ = std::chrono::steady_clock::time_point();
+
+            std::lock_guard<std::mutex> lock(phase_mutex_);
+            current_phase_.clear();
+        } else {
+            connection_attempts_++;
+            if (connection_attempts_ == 1) {
+                Log("Waiting for League client to start...");
+            } else if (connection_attempts_ % WAITING_LOG_INTERVAL == 0) {
+                Log("Still waiting for League client (make sure it's running)");
+            }
+        }
+        return false;
+    }
+
+    credentials_.port = lockfile_.port;
+    credentials_.auth_token.assign(lockfile_.password);
+    if (session_.UpdateCredentials(credentials_)) {
+        // A restarted client may be a different build, and deserves a clean slate
+        acceptor_.ResetEndpointCache();
+        health_.Reset();
+        Log({"Connected to ", lockfile_.process_name, " (port: ", std::to_string(lockfile_.port), ")"});
+    }
+    event_listener_.UpdateCredentials(credentials_);
+
+    if (!client_connected_) {
+        client_connected_ = true;
+        connection_attempts_ = 0;
+    }
+
+    if (event_listener_.IsConnected() != event_stream_logged_) {
+        event_stream_logged_ = event_listener_.IsConnected();
+        Log(event_stream_logged_ ? "Subscribed to LCU events - polling paused"
+                                 : "LCU event stream down - falling back to polling");
+    }
+    return true;
+}
+
+void AutoAcceptEngine::HandlePhase(models::GameflowPhase phase, std::string_view wire_name,
+                                   std::chrono::steady_clock::time_point detected_at) {
+    // Nothing to compare the first phase after (re)connecting against
+    bool first_phase = !phase_known_;
+    // Same phase again: integer compares only, no string work
+    bool phase_changed = gameflow_.ApplyObservedPhase(phase) || !phase_known_;
+    if (!phase_changed && phase == models::GameflowPhase::UNKNOWN) {
+        std::lock_guard<std::mutex> lock(phase_mutex_);
+        phase_changed = current_phase_ != wire_name;
+    }
+
+    std::string phase_name;
+    if (phase_changed) {
+        phase_name.assign(phase == models::GameflowPhase::UNKNOWN ? wire_name : models::GameflowPhaseName(phase));
+        phase_known_ = true;
+        std::lock_guard<std::mutex> lock(phase_mutex_);
+        current_phase_ = phase_name;
+    }
+
+    const char* detection_method = nullptr;
+    if (phase == models::GameflowPhase::READY_CHECK) {
+        detection_method = "gameflow phase";
+    } else if (phase == models::GameflowPhase::UNKNOWN ||
+               (phase == models::GameflowPhase::NONE && (first_phase || detected_at < scan_until_))) {
+        // Only a phase we cannot trust is worth the endpoint scan
+        if (CheckForReadyCheckAlternatives()) {
+            detection_method = "alternative endpoint scanning";
+            // The client lagged once; keep distrusting its "None" for a while
+            scan_until_ = detected_at + STALE_NONE_WINDOW;
+        } else {
+            // The scanned ready check is gone, so the next one is a new one
+            ready_check_handled_ = false;
+        }
+    }
+
+    if (detection_method != nullptr && !ready_check_handled_) {
+        ready_check_handled_ = true; // One attempt per ready check
+
+        if (metrics_) {
+            metrics_->RecordMatchDetected();
+        }
+
+        // Accept before anything is reported: callbacks may block on a UI thread
+        if (auto_accept_enabled_) {
+            AcceptReadyCheck(detected_at, detection_method);
+        } else {
+            Log({"Ready check detected via ", detection_method, " but auto-accept is DISABLED"});
+        }
+    }
+
+    // A ready check can pop any moment now: keep the accept one write away
+    if (phase == models::GameflowPhase::MATCHMAKING && auto_accept_enabled_) {
+        PrewarmAccept(phase_changed);
+    }
+
+    if (phase_changed && phase_callback_) {
+        phase_callback_(phase_name);
+    }
+}
+
+void AutoAcceptEngine::PrewarmAccept(bool entered_queue) {
+    const char* endpoint = acceptor_.GetNextEndpoint();
+    bool warm = session_.Prewarm(HttpMethod::POST, endpoint, GAMEFLOW_PHASE_URI, ACCEPT_KEEP_WARM_INTERVAL);
+    if (entered_queue && warm) {
+        Log({"Accept pre-warmed on ", endpoint});
+    } else if (entered_queue) {
+        Log({"Could not pre-warm the accept connection: ", session_.GetLastError()});
+    }
+}
+
+bool AutoAcceptEngine::PollGameflowPhase(models::GameflowPhase& phase, std::pmr::string& unknown_name) {
+    HttpResponseView response = GetThroughBreaker(LCUEndpointId::GAMEFLOW_PHASE);
+    if (response.IsTransportError()) {
+        return false;
+    }
+
+    std::string_view value;
+    if (!IsUsableResponse(response) || !ParseGameflowPhase(response.body, value)) {
+        return false;
+    }
+    phase = models::GameflowPhaseFromWire(value);
+    if (phase == models::GameflowPhase::UNKNOWN) {
+        unknown_name.assign(value);
+    }
+    return true;
+}
+
+HttpResponseView AutoAcceptEngine::GetThroughBreaker(LCUEndpointId endpoint) {
+    // Read before a due probe turns it half-open, so failed probes log nothing
+    BreakerState before = health_.GetState(endpoint);
+    auto start = std::chrono::steady_clock::now();
+    if (!health_.AllowRequest(endpoint, start)) {
+        return HttpResponseView();
+    }
+
+    HttpResponseView response = session_.GetView(GetLCUEndpoint(endpoint).path);
+    auto end = std::chrono::steady_clock::now();
+    BreakerState after = health_.RecordResponse(endpoint, response, end - start, end);
+
+    if (after == BreakerState::OPEN && before != BreakerState::OPEN) {
+        auto probe = std::chrono::ceil<std::chrono::milliseconds>(health_.GetTimeUntilProbe(endpoint, end));
+        bool no_answer = response.IsTransportError();
+        std::string error = no_answer ? session_.GetLastError() : std::string();
+        Log({"LCU not answering ", GetLCUEndpoint(endpoint).path, no_answer ? " (" : "", error, no_answer ? ")" : "",
+             " - next try in ", std::to_string(probe.count()), "ms"});
+    } else if (after == BreakerState::CLOSED && before != BreakerState::CLOSED) {
+        Log({"LCU answering ", GetLCUEndpoint(endpoint).path, " again"});
+    } else if (response.IsTransportError() && after == BreakerState::CLOSED) {
+        Log({"API Error: ", session_.GetLastError()});
+    }
+    return response;
+}
+
+bool AutoAcceptEngine::CheckForReadyCheckAlternatives() {
+    for (const ReadyCheckSource& source : READY_CHECK_SOURCES) {
+        const LCUEndpoint& endpoint = GetLCUEndpoint(source.endpoint);
+        HttpResponseView response = GetThroughBreaker(source.endpoint);
+        if (!IsUsableResponse(response)) {
+            continue;
+        }
+
+        ReadyCheckView ready_check;
+        std::string_view phase;
+        bool detected = false;
+        switch (endpoint.shape) {
+        case ResponseShape::READY_CHECK:
+            detected = ParseReadyCheck(response.body, ready_check) && ready_check.IsInProgress();
+            break;
+        case ResponseShape::SEARCH:
+            detected = ParseSearchReadyCheck(response.body, ready_check) && ready_check.IsInProgress();
+            break;
+        case ResponseShape::PHASE:
+            detected = ParseGameflowPhase(response.body, phase) &&
+                       models::GameflowPhaseFromWire(phase) == models::GameflowPhase::READY_CHECK;
+            break;
+        case ResponseShape::SESSION:
+            detected = ParseSessionPhase(response.body, phase) &&
+                       models::GameflowPhaseFromWire(phase) == models::GameflowPhase::READY_CHECK;
+            break;
+        case ResponseShape::EMPTY:
+            break;
+        }
+
+        if (detected) {
+            Log({"Ready check detected via ", source.description});
+            return true;
+        }
+    }
+    return false;
+}
+
+void AutoAcceptEngine::AcceptReadyCheck(std::chrono::steady_clock::time_point detected_at,
+                                        const char* detection_method) {
+    // Without a timer, assume the ready check popped when it was detected
+    std::chrono::steady_clock::time_point deadline = ready_check_deadline_ > detected_at
+        ? ready_check_deadline_ : GetReadyCheckDeadline(0.0, detected_at);
+
+    // The POST goes out immediately; the ready-check state is only read
+    // back afterwards to confirm
+    AcceptResult result = acceptor_.Accept(detected_at, deadline);
+    Log({"READY CHECK DETECTED via ", detection_method});
+
+    if (!result.accepted && result.deadline_reached) {
+        Log("READY CHECK EXPIRED before it could be accepted");
+        if (metrics_) {
+            metrics_->RecordAcceptDeadlineMiss();
+        }
+    } else if (!result.accepted) {
+        std::string reason = !result.error_code.empty() ? result.error_code
+                           : result.status_code == 0 ? session_.GetLastError()
+                           : "HTTP " + std::to_string(result.status_code);
+        Log({"READY CHECK ACCEPT FAILED: ", reason});
+        if (metrics_) {
+            metrics_->RecordError("Ready check accept failed: " + reason);
+        }
+    } else {
+        acceptor_.Verify(result);
+
+        if (result.attempts > 1) {
+            Log({"Ready check accepted via ", result.endpoint, " (learned after ", std::to_string(result.attempts),
+                 " tries)"});
+        } else {
+            Log({"Ready check accepted via ", result.endpoint});
+        }
+        Log({"  Timings: dispatch ", std::to_string(result.GetStageLatency(AcceptStage::DISPATCH).count()),
+             "us, post ", std::to_string(result.GetStageLatency(AcceptStage::POST).count()),
+             "us, verify ", std::to_string(result.GetStageLatency(AcceptStage::VERIFY).count()), "us"});
+        if (!result.verified) {
+            Log("  Ready check not confirmed as accepted yet");
+        }
+
+        if (metrics_) {
+            metrics_->RecordAcceptResult(result);
+            metrics_->RecordAcceptanceLatency(result.GetStageLatency(AcceptStage::POST));
+            metrics_->RecordMatchAccepted();
+        }
+    }
+
+    if (accept_callback_) {
+        accept_callback_(result);
+    }
+}
+
+void AutoAcceptEngine::Log(std::string_view message) {
+    if (log_callback_) {
+        log_callback_(message);
+    }
+}
+
+void AutoAcceptEngine::Log(std::initializer_list<std::string_view> parts) {
+    if (!log_callback_) {
+        return;
+    }
+
+    size_t length = 0;
+    for (std::string_view part : parts) {
+        length += part.size();
+    }
+    std::pmr::string line(cycle_arena_.GetResource());
+    line.reserve(length);
+    for (std::string_view part : parts) {
+        line += part;
+    }
+    log_callback_(line);
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,32 @@
+#include "league_auto_accept/core/base64.h"
+
+namespace league_auto_accept {
+namespace core {
+
+std::string Base64Encode(std::string_view input) {
+    static const char encoding_table[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+    encoded.reserve(((input.size() + 2) / 3) * 4);
+
+    int val = 0, valb = -6;
+    for (unsigned char c : input) {
+        val = (val << 8) + c;
+        valb += 8;
+        while (valb >= 0) {
+            encoded.push_back(encoding_table[(val >> valb) & 0x3F]);
+            valb -= 6;
+        }
+    }
+    if (valb > -6) encoded.push_back(encoding_table[((val << 8) >> (valb + 8)) & 0x3F]);
+    while (encoded.size() % 4) encoded.push_back('=');
+    return encoded;
+}
+
+std::string BuildBasicAuthValue(const std::string& auth_token) {
+    return "Basic " + Base64Encode("riot:" + auth_token);
+}
+
+} // namespace core
+} // namespace league_auto_accept
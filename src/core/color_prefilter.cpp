@@ -0,0 +1,275 @@
+#include "league_auto_accept/core/color_prefilter.h"
+#include <algorithm>
+#include <bitset>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define LAA_HAVE_X86_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define LAA_TARGET_AVX2
+#else
+#define LAA_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr int ColorBandPrefilter::BAND_TOLERANCE;
+constexpr double ColorBandPrefilter::MIN_COVERAGE;
+
+namespace {
+constexpr int CHANNELS = Frame::BYTES_PER_PIXEL;
+
+inline bool InBand(const uint8_t* pixel, const ColorBand& band) {
+    return pixel[0] >= band.low[0] && pixel[0] <= band.high[0] &&
+           pixel[1] >= band.low[1] && pixel[1] <= band.high[1] &&
+           pixel[2] >= band.low[2] && pixel[2] <= band.high[2];
+}
+
+size_t CountRowScalar(const uint8_t* row, int width, const ColorBand& band) {
+    size_t count = 0;
+    for (int x = 0; x < width; ++x, row += CHANNELS) {
+        count += InBand(row, band) ? 1 : 0;
+    }
+    return count;
+}
+
+#ifdef LAA_HAVE_X86_SIMD
+// 16 pixels are 48 bytes: bit 3i of a 48-bit byte mask starts pixel i
+constexpr uint64_t PIXEL_START_BITS = 0x249249249249ull;
+
+// Pixels whose three bytes are all set in a 48-bit byte mask
+inline size_t CountPixelTriples(uint64_t byte_mask) {
+    return std::bitset<64>(byte_mask & (byte_mask >> 1) & (byte_mask >> 2) & PIXEL_START_BITS).count();
+}
+
+// Band bounds repeated to line up with `bytes` bytes of BGR pixels
+template <size_t bytes>
+struct BandPattern {
+    alignas(32) uint8_t low[bytes];
+    alignas(32) uint8_t high[bytes];
+
+    explicit BandPattern(const ColorBand& band) {
+        for (size_t i = 0; i < bytes; ++i) {
+            low[i] = band.low[i % CHANNELS];
+            high[i] = band.high[i % CHANNELS];
+        }
+    }
+};
+
+// Bytes within [low, high]: saturating subtraction is zero both ways
+inline uint32_t InRangeMask(__m128i value, __m128i low, __m128i high) {
+    __m128i zero = _mm_setzero_si128();
+    __m128i above = _mm_cmpeq_epi8(_mm_subs_epu8(value, high), zero);
+    __m128i below = _mm_cmpeq_epi8(_mm_subs_epu8(low, value), zero);
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(above, below)));
+}
+
+size_t CountRowSse2(const uint8_t* row, int width, const ColorBand& band) {
+    BandPattern<48> pattern(band);
+    __m128i low[3];
+    __m128i high[3];
+    for (int i = 0; i < 3; ++i) {
+        low[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.low + 16 * i));
+        high[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern.high + 16 * i));
+    }
+
+    size_t count = 0;
+    int x = 0;
+    for (; x + 16 <= width; x += 16, row += 48) {
+        uint64_t mask = InRangeMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row)), low[0], high[0]);
+        mask |= static_cast<uint64_t>(
+                    InRangeMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 16)), low[1], high[1]))
+                << 16;
+        mask |= static_cast<uint64_t>(
+                    InRangeMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 32)), low[2], high[2]))
+                << 32;
+        count += CountPixelTriples(mask);
+    }
+    return count + CountRowScalar(row, width - x, band);
+}
+
+LAA_TARGET_AVX2 inline uint32_t InRangeMask256(__m256i value, __m256i low, __m256i high) {
+    __m256i zero = _mm256_setzero_si256();
+    __m256i above = _mm256_cmpeq_epi8(_mm256_subs_epu8(value, high), zero);
+    __m256i below = _mm256_cmpeq_epi8(_mm256_subs_epu8(low, value), zero);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(above, below)));
+}
+
+LAA_TARGET_AVX2 size_t CountRowAvx2(const uint8_t* row, int width, const ColorBand& band) {
+    BandPattern<96> pattern(band);
+    __m256i low[3];
+    __m256i high[3];
+    for (int i = 0; i < 3; ++i) {
+        low[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern.low + 32 * i));
+        high[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern.high + 32 * i));
+    }
+
+    size_t count = 0;
+    int x = 0;
+    for (; x + 32 <= width; x += 32, row += 96) {
+        uint64_t m0 = InRangeMask256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row)), low[0], high[0]);
+        uint64_t m1 =
+            InRangeMask256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + 32)), low[1], high[1]);
+        uint64_t m2 =
+            InRangeMask256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + 64)), low[2], high[2]);
+        // Two 48-byte halves of 16 pixels each
+        count += CountPixelTriples(m0 | (m1 & 0xFFFF) << 32);
+        count += CountPixelTriples(m1 >> 16 | m2 << 16);
+    }
+    return count + CountRowScalar(row, width - x, band);
+}
+
+bool CpuSupportsAvx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+    if (!os_saves_ymm) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+}
+
+SimdLevel GetSupportedSimdLevel() {
+#ifdef LAA_HAVE_X86_SIMD
+    static const SimdLevel level = CpuSupportsAvx2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+    return level;
+#else
+    return SimdLevel::SCALAR;
+#endif
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::SSE2: return "SSE2";
+    case SimdLevel::AVX2: return "AVX2";
+    default: return "scalar";
+    }
+}
+
+size_t CountPixelsInBand(const Frame& frame, const ColorBand& band, size_t stop_at, SimdLevel level) {
+    level = std::min(level, GetSupportedSimdLevel());
+    size_t count = 0;
+    for (int y = 0; y < frame.height && count < stop_at; ++y) {
+        const uint8_t* row = frame.Row(y);
+        switch (level) {
+#ifdef LAA_HAVE_X86_SIMD
+        case SimdLevel::AVX2: count += CountRowAvx2(row, frame.width, band); break;
+        case SimdLevel::SSE2: count += CountRowSse2(row, frame.width, band); break;
+#endif
+        default: count += CountRowScalar(row, frame.width, band); break;
+        }
+    }
+    return count;
+}
+
+ColorBandPrefilter::ColorBandPrefilter(SimdLevel level)
+    : level_(level)
+    , has_template_(false)
+    , template_band_pixels_(0)
+    , template_coverage_(0.0)
+    , minimum_scale_(1.0)
+    , required_pixels_(0) {
+}
+
+bool ColorBandPrefilter::SetTemplate(const Frame& template_image) {
+    has_template_ = false;
+    required_pixels_ = 0;
+    size_t pixel_count = static_cast<size_t>(template_image.width) * static_cast<size_t>(template_image.height);
+    if (pixel_count == 0) {
+        return false;
+    }
+
+    // The dominant colour: the fullest bin of a 4x4x4 histogram
+    size_t bins[64] = {};
+    for (int y = 0; y < template_image.height; ++y) {
+        const uint8_t* pixel = template_image.Row(y);
+        for (int x = 0; x < template_image.width; ++x, pixel += CHANNELS) {
+            bins[(pixel[0] >> 6) << 4 | (pixel[1] >> 6) << 2 | pixel[2] >> 6]++;
+        }
+    }
+    int dominant = static_cast<int>(std::max_element(bins, bins + 64) - bins);
+
+    // Its spread per channel, from the pixels in that bin
+    size_t values[CHANNELS][256] = {};
+    for (int y = 0; y < template_image.height; ++y) {
+        const uint8_t* pixel = template_image.Row(y);
+        for (int x = 0; x < template_image.width; ++x, pixel += CHANNELS) {
+            if (((pixel[0] >> 6) << 4 | (pixel[1] >> 6) << 2 | pixel[2] >> 6) == dominant) {
+                for (int c = 0; c < CHANNELS; ++c) {
+                    values[c][pixel[c]]++;
+                }
+            }
+        }
+    }
+    size_t in_bin = bins[dominant];
+    for (int c = 0; c < CHANNELS; ++c) {
+        size_t seen = 0;
+        int p10 = -1;
+        int p90 = 255;
+        for (int v = 0; v < 256; ++v) {
+            seen += values[c][v];
+            if (p10 < 0 && seen * 10 >= in_bin) p10 = v;
+            if (seen * 10 >= in_bin * 9) {
+                p90 = v;
+                break;
+            }
+        }
+        band_.low[c] = static_cast<uint8_t>(std::max(p10 - BAND_TOLERANCE, 0));
+        band_.high[c] = static_cast<uint8_t>(std::min(p90 + BAND_TOLERANCE, 255));
+    }
+
+    template_band_pixels_ = CountPixelsInBand(template_image, band_, SIZE_MAX, SimdLevel::SCALAR);
+    template_coverage_ = static_cast<double>(template_band_pixels_) / static_cast<double>(pixel_count);
+    has_template_ = true;
+    UpdateRequiredPixels();
+    return true;
+}
+
+void ColorBandPrefilter::SetMinimumScale(double scale) {
+    if (scale > 0.0 && scale != minimum_scale_) {
+        minimum_scale_ = scale;
+        UpdateRequiredPixels();
+    }
+}
+
+bool ColorBandPrefilter::MayContain(const Frame& image) {
+    if (!has_template_) {
+        return true;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    bool may_contain = CountPixelsInBand(image, band_, required_pixels_, level_) >= required_pixels_;
+    stats_.time += std::chrono::steady_clock::now() - start;
+    stats_.frames++;
+    if (!may_contain) {
+        stats_.rejected++;
+    }
+    return may_contain;
+}
+
+double ColorBandPrefilter::GetRejectRate() const {
+    if (stats_.frames == 0) return 0.0;
+    return static_cast<double>(stats_.rejected) / static_cast<double>(stats_.frames);
+}
+
+void ColorBandPrefilter::ResetStats() {
+    stats_ = Stats();
+}
+
+void ColorBandPrefilter::UpdateRequiredPixels() {
+    double scaled = static_cast<double>(template_band_pixels_) * minimum_scale_ * minimum_scale_;
+    required_pixels_ = std::max<size_t>(1, static_cast<size_t>(scaled * MIN_COVERAGE));
+}
+
+} // namespace core
+} // namespace league_auto_accept
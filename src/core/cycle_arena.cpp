@@ -0,0 +1,44 @@
+#include "league_auto_accept/core/cycle_arena.h"
+
+namespace league_auto_accept {
+namespace core {
+
+CycleArena::CycleArena(size_t size)
+    : size_(size)
+    , buffer_(size > 0 ? std::make_unique<std::byte[]>(size) : nullptr)
+    , arena_(buffer_.get(), size, &overflow_) {
+}
+
+std::pmr::memory_resource* CycleArena::GetResource() {
+    if (size_ == 0) {
+        return std::pmr::new_delete_resource();
+    }
+    return &arena_;
+}
+
+void CycleArena::Reset() {
+    stats_.resets++;
+    if (overflow_.bytes > 0) {
+        stats_.overflows++;
+        stats_.overflow_bytes += overflow_.bytes;
+        overflow_.bytes = 0;
+    }
+    // Back to the start of the buffer; heap blocks of the pass are freed
+    arena_.release();
+}
+
+void* CycleArena::OverflowResource::do_allocate(size_t bytes, size_t alignment) {
+    this->bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void CycleArena::OverflowResource::do_deallocate(void* memory, size_t bytes, size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+}
+
+bool CycleArena::OverflowResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,103 @@
+#include "league_auto_accept/core/deadline_ticker.h"
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+#ifdef __linux__
+// Nice value of an elevated thread; lowering it needs CAP_SYS_NICE
+constexpr int ELEVATED_NICE = -5;
+#endif
+
+void CheckPeriod(std::chrono::nanoseconds period) {
+    if (period <= std::chrono::nanoseconds::zero()) {
+        throw std::invalid_argument("Tick period must be positive");
+    }
+}
+}
+
+DeadlineTicker::DeadlineTicker(std::chrono::nanoseconds period, Clock::time_point start)
+    : period_(period)
+    , next_deadline_(start + period) {
+    CheckPeriod(period);
+}
+
+void DeadlineTicker::SetPeriod(std::chrono::nanoseconds period) {
+    CheckPeriod(period);
+    next_deadline_ += period - period_;
+    period_ = period;
+}
+
+void DeadlineTicker::Reset(Clock::time_point now) {
+    next_deadline_ = now + period_;
+}
+
+std::chrono::nanoseconds DeadlineTicker::GetTimeUntilNextTick(Clock::time_point now) const {
+    return now < next_deadline_ ? next_deadline_ - now : std::chrono::nanoseconds::zero();
+}
+
+std::chrono::nanoseconds DeadlineTicker::Tick(Clock::time_point now) {
+    std::chrono::nanoseconds jitter = now >= next_deadline_ ? now - next_deadline_ : next_deadline_ - now;
+    next_deadline_ += period_;
+    if (now >= next_deadline_) {
+        // Overran whole periods: the next deadline is the first still ahead
+        uint64_t skipped = static_cast<uint64_t>((now - next_deadline_) / period_) + 1;
+        next_deadline_ += period_ * static_cast<int64_t>(skipped);
+        stats_.missed += skipped;
+    }
+
+    stats_.ticks++;
+    stats_.total_jitter += jitter;
+    if (jitter > stats_.max_jitter) {
+        stats_.max_jitter = jitter;
+    }
+    return jitter;
+}
+
+std::chrono::nanoseconds DeadlineTicker::SleepUntilNextTick() {
+#if defined(__linux__)
+    // steady_clock is CLOCK_MONOTONIC, so its epoch is the deadline's
+    std::chrono::nanoseconds since_epoch = next_deadline_.time_since_epoch();
+    timespec deadline;
+    deadline.tv_sec = static_cast<time_t>(since_epoch.count() / 1000000000);
+    deadline.tv_nsec = static_cast<long>(since_epoch.count() % 1000000000);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(next_deadline_);
+#endif
+    return Tick();
+}
+
+void DeadlineTicker::ResetStats() {
+    stats_ = Stats();
+}
+
+bool SetCurrentThreadPriority(ThreadPriority priority) {
+#ifdef _WIN32
+    int level = priority == ThreadPriority::ELEVATED ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_NORMAL;
+    return SetThreadPriority(GetCurrentThread(), level) != 0;
+#elif defined(__linux__)
+    // Linux applies a thread id's nice value to that thread alone
+    int nice = priority == ThreadPriority::ELEVATED ? ELEVATED_NICE : 0;
+    id_t thread_id = static_cast<id_t>(syscall(SYS_gettid));
+    return setpriority(PRIO_PROCESS, thread_id, nice) == 0;
+#else
+    return priority == ThreadPriority::NORMAL;
+#endif
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,109 @@
+#include "league_auto_accept/core/gdi_capture_source.h"
+#include <cstring>
+
+namespace league_auto_accept {
+namespace core {
+
+GdiCaptureSource::GdiCaptureSource()
+    : screen_dc_(GetDC(nullptr))
+    , memory_dc_(nullptr)
+    , bitmap_(nullptr)
+    , previous_bitmap_(nullptr)
+    , bitmap_bits_(nullptr)
+    , bitmap_width_(0)
+    , bitmap_height_(0) {
+    if (screen_dc_ != nullptr) {
+        memory_dc_ = CreateCompatibleDC(screen_dc_);
+    }
+    if (memory_dc_ == nullptr) {
+        last_error_ = "Cannot create a device context for the screen";
+    }
+}
+
+GdiCaptureSource::~GdiCaptureSource() {
+    ReleaseBitmap();
+    if (memory_dc_ != nullptr) {
+        DeleteDC(memory_dc_);
+    }
+    if (screen_dc_ != nullptr) {
+        ReleaseDC(nullptr, screen_dc_);
+    }
+}
+
+bool GdiCaptureSource::Capture(const CaptureRect& rect, Frame& frame) {
+    if (memory_dc_ == nullptr) {
+        return false;
+    }
+    if (rect.IsEmpty() || rect.Intersect(GetScreenBounds()) != rect) {
+        last_error_ = "Capture rect is outside the screen";
+        return false;
+    }
+    if (!EnsureBitmap(rect.width, rect.height)) {
+        return false;
+    }
+
+    if (!BitBlt(memory_dc_, 0, 0, rect.width, rect.height, screen_dc_, rect.x, rect.y, SRCCOPY)) {
+        last_error_ = "BitBlt failed: " + std::to_string(::GetLastError());
+        return false;
+    }
+    GdiFlush();
+
+    // A top-down 24-bit DIB has the frame's exact layout
+    frame.Resize(rect.width, rect.height);
+    std::memcpy(frame.pixels.data(), bitmap_bits_, frame.pixels.size());
+    return true;
+}
+
+CaptureRect GdiCaptureSource::GetScreenBounds() const {
+    CaptureRect bounds;
+    bounds.x = GetSystemMetrics(SM_XVIRTUALSCREEN);
+    bounds.y = GetSystemMetrics(SM_YVIRTUALSCREEN);
+    bounds.width = GetSystemMetrics(SM_CXVIRTUALSCREEN);
+    bounds.height = GetSystemMetrics(SM_CYVIRTUALSCREEN);
+    return bounds;
+}
+
+std::string GdiCaptureSource::GetLastError() const {
+    return last_error_;
+}
+
+bool GdiCaptureSource::EnsureBitmap(int width, int height) {
+    if (bitmap_ != nullptr && width == bitmap_width_ && height == bitmap_height_) {
+        return true;
+    }
+    ReleaseBitmap();
+
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = width;
+    info.bmiHeader.biHeight = -height;   // Negative: top row first
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 24;
+    info.bmiHeader.biCompression = BI_RGB;
+
+    bitmap_ = CreateDIBSection(screen_dc_, &info, DIB_RGB_COLORS, &bitmap_bits_, nullptr, 0);
+    if (bitmap_ == nullptr || bitmap_bits_ == nullptr) {
+        last_error_ = "CreateDIBSection failed: " + std::to_string(::GetLastError());
+        bitmap_ = nullptr;
+        return false;
+    }
+    previous_bitmap_ = SelectObject(memory_dc_, bitmap_);
+    bitmap_width_ = width;
+    bitmap_height_ = height;
+    return true;
+}
+
+void GdiCaptureSource::ReleaseBitmap() {
+    if (bitmap_ == nullptr) {
+        return;
+    }
+    SelectObject(memory_dc_, previous_bitmap_);
+    DeleteObject(bitmap_);
+    bitmap_ = nullptr;
+    bitmap_bits_ = nullptr;
+    bitmap_width_ = 0;
+    bitmap_height_ = 0;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,96 @@
+#include "league_auto_accept/core/http_wire.h"
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+
+char ToLower(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string_view Trim(std::string_view text) {
+    while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) text.remove_prefix(1);
+    while (!text.empty() && (text.back() == ' ' || text.back() == '\t' || text.back() == '\r')) text.remove_suffix(1);
+    return text;
+}
+
+} // namespace
+
+size_t FindHeaderEnd(std::string_view data) {
+    size_t pos = data.find("\r\n\r\n");
+    return pos == std::string_view::npos ? std::string_view::npos : pos + 4;
+}
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (ToLower(a[i]) != ToLower(b[i])) return false;
+    }
+    return true;
+}
+
+bool FindHeaderValue(std::string_view headers, std::string_view name, std::string_view& value) {
+    size_t line_start = headers.find("\r\n");
+    while (line_start != std::string_view::npos && line_start + 2 < headers.size()) {
+        line_start += 2;
+        size_t line_end = headers.find("\r\n", line_start);
+        std::string_view line = headers.substr(line_start,
+            line_end == std::string_view::npos ? std::string_view::npos : line_end - line_start);
+
+        size_t colon = line.find(':');
+        if (colon != std::string_view::npos && EqualsIgnoreCase(Trim(line.substr(0, colon)), name)) {
+            value = Trim(line.substr(colon + 1));
+            return true;
+        }
+        line_start = line_end;
+    }
+    return false;
+}
+
+int ParseStatusCode(std::string_view status_line) {
+    size_t space = status_line.find(' ');
+    if (space == std::string_view::npos || status_line.size() < space + 4) {
+        return 0;
+    }
+
+    size_t code = 0;
+    if (!ParseUnsigned(status_line.substr(space + 1, 3), code)) {
+        return 0;
+    }
+    return static_cast<int>(code);
+}
+
+bool ParseUnsigned(std::string_view text, size_t& value, int base) {
+    text = Trim(text);
+    if (text.empty()) return false;
+
+    size_t result = 0;
+    for (char c : text) {
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (base == 16 && ToLower(c) >= 'a' && ToLower(c) <= 'f') digit = ToLower(c) - 'a' + 10;
+        else if (base == 16 && c == ';') break; // Chunk extensions
+        else return false;
+        result = result * static_cast<size_t>(base) + static_cast<size_t>(digit);
+    }
+    value = result;
+    return true;
+}
+
+const char* HttpStatusReason(int status_code) {
+    switch (status_code) {
+    case 101: return "Switching Protocols";
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 404: return "Not Found";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "Unknown";
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
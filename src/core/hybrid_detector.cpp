@@ -0,0 +1,213 @@
+#include "league_auto_accept/core/hybrid_detector.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+HybridDetector::HybridDetector(DetectFunction lcu, DetectFunction vision, const HybridDetectorConfig& config)
+    : config_(config) {
+    if (!lcu || !vision) {
+        throw std::invalid_argument("Hybrid detection needs both an LCU and a vision detector");
+    }
+    if (config_.lcu_failures_until_degraded <= 0 || config_.race_timeout.count() <= 0) {
+        throw std::invalid_argument("Invalid hybrid detector configuration");
+    }
+
+    lanes_[LCU_LANE].detect = std::move(lcu);
+    lanes_[VISION_LANE].detect = std::move(vision);
+    lanes_[LCU_LANE].thread = std::thread(&HybridDetector::LaneLoop, this, LCU_LANE);
+    lanes_[VISION_LANE].thread = std::thread(&HybridDetector::LaneLoop, this, VISION_LANE);
+}
+
+HybridDetector::~HybridDetector() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        for (Lane& lane : lanes_) {
+            lane.cancelled = true;
+        }
+    }
+    work_cv_.notify_all();
+    for (Lane& lane : lanes_) {
+        if (lane.thread.joinable()) {
+            lane.thread.join();
+        }
+    }
+}
+
+HybridDetection HybridDetector::Detect(bool lcu_available, bool vision_allowed) {
+    HybridDetection detection;
+    Clock::time_point start = Clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    stats_.detections++;
+
+    // A healthy LCU answers alone, without a thread hop
+    bool race = vision_allowed && (!lcu_available || IsLCUDegradedLocked());
+    if (!race) {
+        if (!lcu_available || lanes_[LCU_LANE].busy) {
+            stats_.busy_skips += lcu_available ? 1 : 0;
+            return detection;
+        }
+        lanes_[LCU_LANE].busy = true;
+        lock.unlock();
+
+        DetectorVerdict verdict = lanes_[LCU_LANE].detect(never_cancelled_);
+        Clock::time_point end = Clock::now();
+
+        lock.lock();
+        lanes_[LCU_LANE].busy = false;
+        RecordLCUResultLocked(verdict, end - start);
+        result_cv_.notify_all();
+
+        if (verdict == DetectorVerdict::FOUND) {
+            detection.found = true;
+            detection.source = models::DetectionSource::LCU_API;
+            detection.latency = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+            stats_.lcu_wins++;
+        }
+        if (verdict != DetectorVerdict::FAILED || !vision_allowed) {
+            return detection;
+        }
+        // The LCU could not look, so the screen looks this time
+        lcu_available = false;
+    }
+
+    round_++;
+    int started = 0;
+    for (LaneId id : {LCU_LANE, VISION_LANE}) {
+        if (id == LCU_LANE && !lcu_available) {
+            continue;
+        }
+        if (lanes_[id].busy) {
+            stats_.busy_skips++;
+            continue;
+        }
+        StartLocked(id);
+        started++;
+    }
+    if (started == 0) {
+        return detection;
+    }
+    detection.raced = started == LANE_COUNT;
+    stats_.races += detection.raced ? 1 : 0;
+    work_cv_.notify_all();
+
+    // Until one finds it, or every detector that started has answered
+    auto decided = [this]() {
+        bool all_done = true;
+        for (const Lane& lane : lanes_) {
+            if (lane.round != round_) {
+                continue;
+            }
+            if (lane.done && lane.verdict == DetectorVerdict::FOUND) {
+                return true;
+            }
+            all_done = all_done && lane.done;
+        }
+        return all_done;
+    };
+    result_cv_.wait_until(lock, start + config_.race_timeout, decided);
+
+    // Should both have found it by now, the earlier one wins
+    const Lane* winner = nullptr;
+    for (const Lane& lane : lanes_) {
+        if (lane.round == round_ && lane.done && lane.verdict == DetectorVerdict::FOUND &&
+            (winner == nullptr || lane.finished_at < winner->finished_at)) {
+            winner = &lane;
+        }
+    }
+
+    for (Lane& lane : lanes_) {
+        if (lane.round == round_ && !lane.done) {
+            lane.cancelled = true;
+            detection.loser_cancelled = true;
+            stats_.cancelled++;
+        }
+    }
+
+    if (winner != nullptr) {
+        bool lcu = winner == &lanes_[LCU_LANE];
+        detection.found = true;
+        detection.source = lcu ? models::DetectionSource::LCU_API : models::DetectionSource::UI_AUTOMATION;
+        detection.latency = std::chrono::duration_cast<std::chrono::microseconds>(winner->finished_at - start);
+        (lcu ? stats_.lcu_wins : stats_.vision_wins)++;
+    }
+    return detection;
+}
+
+void HybridDetector::SetLCUHealth(const LCUHealthMonitor* health, LCUEndpointId endpoint) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    health_ = health;
+    health_endpoint_ = endpoint;
+}
+
+bool HybridDetector::WaitForVisionIdle(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return result_cv_.wait_for(lock, timeout, [this]() { return !lanes_[VISION_LANE].busy; });
+}
+
+bool HybridDetector::IsLCUDegraded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return IsLCUDegradedLocked();
+}
+
+HybridDetector::Stats HybridDetector::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void HybridDetector::LaneLoop(LaneId id) {
+    Lane& lane = lanes_[id];
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true) {
+        work_cv_.wait(lock, [this, &lane]() { return stopping_ || lane.has_job; });
+        if (stopping_) {
+            return;
+        }
+        lane.has_job = false;
+        Clock::time_point start = Clock::now();
+        lock.unlock();
+
+        DetectorVerdict verdict = lane.detect(lane.cancelled);
+        Clock::time_point end = Clock::now();
+
+        lock.lock();
+        lane.busy = false;
+        if (id == LCU_LANE) {
+            RecordLCUResultLocked(verdict, end - start);
+        }
+        // Only Detect() of the lane's round looks at this; a later round
+        // cannot have started it while it was busy
+        lane.done = true;
+        lane.verdict = verdict;
+        lane.finished_at = end;
+        result_cv_.notify_all();
+    }
+}
+
+void HybridDetector::RecordLCUResultLocked(DetectorVerdict verdict, Clock::duration elapsed) {
+    lcu_failures_ = verdict == DetectorVerdict::FAILED ? lcu_failures_ + 1 : 0;
+    last_lcu_latency_ = elapsed;
+}
+
+bool HybridDetector::IsLCUDegradedLocked() const {
+    // A read that has not come back is as bad as a slow one
+    return lcu_failures_ >= config_.lcu_failures_until_degraded ||
+           last_lcu_latency_ > config_.lcu_slow_threshold ||
+           lanes_[LCU_LANE].busy ||
+           (health_ != nullptr && health_->IsDegraded(health_endpoint_));
+}
+
+void HybridDetector::StartLocked(LaneId id) {
+    Lane& lane = lanes_[id];
+    lane.cancelled = false;
+    lane.busy = true;
+    lane.has_job = true;
+    lane.done = false;
+    lane.round = round_;
+}
+
+} // namespace core
+} // namespace league_auto_accept
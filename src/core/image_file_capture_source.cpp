@@ -0,0 +1,134 @@
+#include "league_auto_accept/core/image_file_capture_source.h"
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+// Next header number of a PPM, skipping whitespace and # comments
+bool ReadPpmNumber(std::istream& in, int& value) {
+    int c = in.peek();
+    while (c != EOF && (std::isspace(c) || c == '#')) {
+        if (c == '#') {
+            std::string comment;
+            std::getline(in, comment);
+        } else {
+            in.get();
+        }
+        c = in.peek();
+    }
+    return static_cast<bool>(in >> value);
+}
+}
+
+bool ImageFileCaptureSource::AddImage(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        last_error_ = "Cannot open " + path;
+        return false;
+    }
+
+    char magic[2] = {};
+    int width = 0;
+    int height = 0;
+    int max_value = 0;
+    in.read(magic, 2);
+    if (!in || magic[0] != 'P' || magic[1] != '6' || !ReadPpmNumber(in, width) ||
+        !ReadPpmNumber(in, height) || !ReadPpmNumber(in, max_value)) {
+        last_error_ = path + " is not a binary PPM";
+        return false;
+    }
+    if (width <= 0 || height <= 0 || max_value != 255) {
+        last_error_ = path + ": only 8-bit PPM images are supported";
+        return false;
+    }
+    in.get();   // The single whitespace before the pixels
+
+    Frame image;
+    image.Resize(width, height);
+    size_t row_bytes = static_cast<size_t>(width) * Frame::BYTES_PER_PIXEL;
+    for (int y = 0; y < height; ++y) {
+        uint8_t* row = image.Row(y);
+        if (!in.read(reinterpret_cast<char*>(row), static_cast<std::streamsize>(row_bytes))) {
+            last_error_ = path + " is truncated";
+            return false;
+        }
+        // PPM stores RGB
+        for (size_t i = 0; i < row_bytes; i += Frame::BYTES_PER_PIXEL) {
+            std::swap(row[i], row[i + 2]);
+        }
+    }
+
+    images_.push_back(std::move(image));
+    return true;
+}
+
+void ImageFileCaptureSource::SetCurrentIndex(size_t index) {
+    if (index < images_.size()) {
+        current_ = index;
+    }
+}
+
+void ImageFileCaptureSource::Advance() {
+    if (!images_.empty()) {
+        current_ = (current_ + 1) % images_.size();
+    }
+}
+
+bool ImageFileCaptureSource::Capture(const CaptureRect& rect, Frame& frame) {
+    if (images_.empty()) {
+        last_error_ = "No images loaded";
+        return false;
+    }
+    if (rect.IsEmpty() || rect.Intersect(GetScreenBounds()) != rect) {
+        last_error_ = "Capture rect is outside the screen";
+        return false;
+    }
+
+    const Frame& image = images_[current_];
+    frame.Resize(rect.width, rect.height);
+    size_t row_bytes = static_cast<size_t>(rect.width) * Frame::BYTES_PER_PIXEL;
+    size_t offset = static_cast<size_t>(rect.x) * Frame::BYTES_PER_PIXEL;
+    for (int y = 0; y < rect.height; ++y) {
+        std::memcpy(frame.Row(y), image.Row(rect.y + y) + offset, row_bytes);
+    }
+    return true;
+}
+
+CaptureRect ImageFileCaptureSource::GetScreenBounds() const {
+    CaptureRect bounds;
+    if (!images_.empty()) {
+        bounds.width = images_[current_].width;
+        bounds.height = images_[current_].height;
+    }
+    return bounds;
+}
+
+std::string ImageFileCaptureSource::GetLastError() const {
+    return last_error_;
+}
+
+bool WritePpmImage(const std::string& path, const Frame& frame) {
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        return false;
+    }
+
+    out << "P6\n" << frame.width << " " << frame.height << "\n255\n";
+    std::vector<uint8_t> row;
+    for (int y = 0; y < frame.height; ++y) {
+        const uint8_t* pixels = frame.Row(y);
+        row.assign(pixels, pixels + static_cast<size_t>(frame.width) * Frame::BYTES_PER_PIXEL);
+        for (size_t i = 0; i < row.size(); i += Frame::BYTES_PER_PIXEL) {
+            std::swap(row[i], row[i + 2]);
+        }
+        out.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+    return static_cast<bool>(out);
+}
+
+} // namespace core
+} // namespace league_auto_accept
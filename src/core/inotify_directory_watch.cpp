@@ -0,0 +1,154 @@
+#include "league_auto_accept/core/inotify_directory_watch.h"
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+// Creation, writes, deletion and both halves of a rename, plus the directory
+// itself going away
+constexpr uint32_t WATCH_MASK = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_DELETE |
+                                IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+}
+
+InotifyDirectoryWatch::InotifyDirectoryWatch()
+    : inotify_fd_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+    , interrupt_fd_(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (inotify_fd_ < 0 || interrupt_fd_ < 0) {
+        SetError("inotify setup failed: " + std::string(std::strerror(errno)));
+    }
+}
+
+InotifyDirectoryWatch::~InotifyDirectoryWatch() {
+    if (inotify_fd_ >= 0) close(inotify_fd_);
+    if (interrupt_fd_ >= 0) close(interrupt_fd_);
+}
+
+bool InotifyDirectoryWatch::AddDirectory(const std::string& directory) {
+    if (inotify_fd_ < 0) {
+        return false;
+    }
+
+    int wd = inotify_add_watch(inotify_fd_, directory.c_str(), WATCH_MASK | IN_ONLYDIR);
+    if (wd < 0) {
+        SetError("Cannot watch " + directory + ": " + std::strerror(errno));
+        return false;
+    }
+
+    // Re-adding a watched directory returns the same descriptor
+    directories_[wd] = directory;
+    return true;
+}
+
+bool InotifyDirectoryWatch::IsWatching(const std::string& directory) const {
+    for (const auto& entry : directories_) {
+        if (entry.second == directory) return true;
+    }
+    return false;
+}
+
+bool InotifyDirectoryWatch::WaitForChanges(std::vector<std::string>& changed_paths,
+                                           std::chrono::milliseconds timeout) {
+    if (inotify_fd_ < 0 || interrupt_fd_ < 0) {
+        return false;
+    }
+
+    pollfd fds[2] = {
+        {inotify_fd_, POLLIN, 0},
+        {interrupt_fd_, POLLIN, 0}
+    };
+
+    int ready;
+    do {
+        ready = poll(fds, 2, static_cast<int>(timeout.count()));
+    } while (ready < 0 && errno == EINTR);
+
+    if (ready < 0) {
+        SetError("poll failed: " + std::string(std::strerror(errno)));
+        return false;
+    }
+
+    if (fds[1].revents & POLLIN) {
+        uint64_t count;
+        (void)read(interrupt_fd_, &count, sizeof(count));
+        return false;
+    }
+
+    if (!(fds[0].revents & POLLIN)) {
+        return false; // Timeout
+    }
+
+    size_t previous_size = changed_paths.size();
+    ReadEvents(changed_paths);
+    return changed_paths.size() > previous_size;
+}
+
+void InotifyDirectoryWatch::ReadEvents(std::vector<std::string>& changed_paths) {
+    while (true) {
+        ssize_t length = read(inotify_fd_, buffer_, sizeof(buffer_));
+        if (length <= 0) {
+            return; // EAGAIN: queue drained
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer_ + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // Names lost; every directory may have changed
+                for (const auto& entry : directories_) {
+                    changed_paths.push_back(entry.second);
+                }
+                continue;
+            }
+
+            auto directory = directories_.find(event->wd);
+            if (directory == directories_.end()) {
+                continue;
+            }
+
+            if (event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) {
+                // The directory itself is gone; the caller has to re-add it
+                changed_paths.push_back(directory->second);
+                if (!(event->mask & IN_IGNORED)) {
+                    inotify_rm_watch(inotify_fd_, event->wd);
+                }
+                directories_.erase(directory);
+                continue;
+            }
+
+            if (event->len > 0) {
+                changed_paths.push_back(directory->second + "/" + event->name);
+            }
+        }
+    }
+}
+
+void InotifyDirectoryWatch::Interrupt() {
+    if (interrupt_fd_ >= 0) {
+        uint64_t one = 1;
+        (void)write(interrupt_fd_, &one, sizeof(one));
+    }
+}
+
+std::string InotifyDirectoryWatch::GetLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+void InotifyDirectoryWatch::SetError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = message;
+}
+
+std::unique_ptr<DirectoryWatch> CreatePlatformDirectoryWatch() {
+    return std::make_unique<InotifyDirectoryWatch>();
+}
+
+} // namespace core
+} // namespace league_auto_accept
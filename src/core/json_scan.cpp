@@ -0,0 +1,136 @@
+#include "league_auto_accept/core/json_scan.h"
+#include <array>
+#include <charconv>
+#include <cstring>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+
+bool IsWhitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// Characters MeasureContainer has to stop at
+constexpr std::array<bool, 256> BuildStructuralTable() {
+    std::array<bool, 256> table{};
+    table['"'] = table['{'] = table['['] = table['}'] = table[']'] = true;
+    return table;
+}
+
+constexpr std::array<bool, 256> STRUCTURAL_CHARS = BuildStructuralTable();
+
+size_t MeasureString(std::string_view text) {
+    // Jump between quotes; one is escaped only if an odd run of backslashes precedes it
+    size_t i = 1;
+    while (i < text.size()) {
+        const void* quote = std::memchr(text.data() + i, '"', text.size() - i);
+        if (quote == nullptr) return 0;
+        i = static_cast<size_t>(static_cast<const char*>(quote) - text.data());
+
+        size_t backslashes = 0;
+        while (backslashes < i - 1 && text[i - 1 - backslashes] == '\\') ++backslashes;
+        if (backslashes % 2 == 0) return i + 1;
+        ++i;
+    }
+    return 0;
+}
+
+size_t MeasureContainer(std::string_view text) {
+    int depth = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (!STRUCTURAL_CHARS[static_cast<unsigned char>(c)]) continue;
+        if (c == '"') {
+            size_t length = MeasureString(text.substr(i));
+            if (length == 0) return 0;
+            i += length - 1;
+        } else if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) return i + 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace
+
+std::string_view SkipJsonWhitespace(std::string_view text) {
+    size_t i = 0;
+    while (i < text.size() && IsWhitespace(text[i])) ++i;
+    return text.substr(i);
+}
+
+size_t MeasureJsonValue(std::string_view text) {
+    if (text.empty()) return 0;
+
+    switch (text.front()) {
+    case '"':
+        return MeasureString(text);
+    case '{':
+    case '[':
+        return MeasureContainer(text);
+    default: {
+        // Number or literal: runs until a delimiter
+        size_t i = 0;
+        while (i < text.size() && text[i] != ',' && text[i] != '}' && text[i] != ']' && !IsWhitespace(text[i])) {
+            ++i;
+        }
+        return i;
+    }
+    }
+}
+
+bool FindJsonMember(std::string_view object, std::string_view key, std::string_view& value) {
+    bool found = false;
+    VisitJsonObject(object, [&](std::string_view member_key, std::string_view member_value) {
+        if (member_key != key) return true;
+        value = member_value;
+        found = true;
+        return false;
+    });
+    return found;
+}
+
+bool UnquoteJsonString(std::string_view raw, std::string_view& value) {
+    if (raw.size() < 2 || raw.front() != '"' || raw.back() != '"') return false;
+    value = raw.substr(1, raw.size() - 2);
+    return true;
+}
+
+int CountJsonArray(std::string_view array) {
+    array = SkipJsonWhitespace(array);
+    if (array.empty() || array.front() != '[') return -1;
+    array = SkipJsonWhitespace(array.substr(1));
+    if (!array.empty() && array.front() == ']') return 0;
+
+    int count = 0;
+    for (;;) {
+        size_t length = MeasureJsonValue(array);
+        if (length == 0) return -1;
+        count++;
+
+        array = SkipJsonWhitespace(array.substr(length));
+        if (array.empty()) return -1;
+        if (array.front() == ']') return count;
+        if (array.front() != ',') return -1;
+        array = SkipJsonWhitespace(array.substr(1));
+    }
+}
+
+bool ParseJsonNumber(std::string_view raw, double& value) {
+    if (raw.empty()) return false;
+    auto result = std::from_chars(raw.data(), raw.data() + raw.size(), value);
+    return result.ec == std::errc() && result.ptr == raw.data() + raw.size();
+}
+
+bool ParseJsonInteger(std::string_view raw, long long& value) {
+    if (raw.empty()) return false;
+    auto result = std::from_chars(raw.data(), raw.data() + raw.size(), value);
+    return result.ec == std::errc() && result.ptr == raw.data() + raw.size();
+}
+
+} // namespace core
+} // namespace league_auto_accept
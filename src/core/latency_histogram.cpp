@@ -0,0 +1,263 @@
+#include "league_auto_accept/core/latency_histogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr uint64_t EMPTY_MIN = std::numeric_limits<uint64_t>::max();
+
+// Index of the highest set bit; value must be non-zero
+int HighestBit(uint64_t value) {
+    int bit = 0;
+    for (int step = 32; step > 0; step /= 2) {
+        if (value >> step) {
+            value >>= step;
+            bit += step;
+        }
+    }
+    return bit;
+}
+
+uint64_t ToMicros(std::chrono::microseconds latency) {
+    return latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+}
+}
+
+constexpr std::chrono::seconds RollingLatencyHistogram::SLOT_DURATION;
+constexpr std::chrono::minutes RollingLatencyHistogram::MAX_WINDOW;
+
+size_t LatencyHistogram::GetBucketIndex(uint64_t value_us) {
+    value_us = std::min(value_us, MAX_VALUE_US);
+    if (value_us < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value_us);
+    }
+    int shift = HighestBit(value_us) - SUB_BUCKET_BITS;
+    uint64_t sub_bucket = (value_us >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<size_t>(SUB_BUCKET_COUNT + static_cast<uint64_t>(shift) * SUB_BUCKET_COUNT + sub_bucket);
+}
+
+uint64_t LatencyHistogram::GetBucketLowerBound(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    uint64_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    uint64_t sub_bucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + sub_bucket) << shift;
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    uint64_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    return GetBucketLowerBound(index) + (uint64_t(1) << shift) - 1;
+}
+
+LatencyHistogram::Snapshot::Snapshot() {
+    Clear();
+}
+
+void LatencyHistogram::Snapshot::Add(uint64_t value_us, uint64_t count) {
+    if (count == 0) return;
+    buckets_[GetBucketIndex(value_us)] += count;
+    count_ += count;
+    sum_us_ += value_us * count;
+    min_us_ = std::min(min_us_, value_us);
+    max_us_ = std::max(max_us_, value_us);
+}
+
+void LatencyHistogram::Snapshot::Merge(const Snapshot& other) {
+    if (other.IsEmpty()) return;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    sum_us_ += other.sum_us_;
+    min_us_ = std::min(min_us_, other.min_us_);
+    max_us_ = std::max(max_us_, other.max_us_);
+}
+
+void LatencyHistogram::Snapshot::Clear() {
+    buckets_.fill(0);
+    count_ = 0;
+    sum_us_ = 0;
+    min_us_ = EMPTY_MIN;
+    max_us_ = 0;
+}
+
+std::chrono::microseconds LatencyHistogram::Snapshot::GetMin() const {
+    return std::chrono::microseconds(IsEmpty() ? 0 : static_cast<long long>(min_us_));
+}
+
+std::chrono::microseconds LatencyHistogram::Snapshot::GetMax() const {
+    return std::chrono::microseconds(static_cast<long long>(max_us_));
+}
+
+double LatencyHistogram::Snapshot::GetMeanUs() const {
+    if (IsEmpty()) return 0.0;
+    return static_cast<double>(sum_us_) / static_cast<double>(count_);
+}
+
+std::chrono::microseconds LatencyHistogram::Snapshot::GetPercentile(double percentile) const {
+    if (IsEmpty()) {
+        return std::chrono::microseconds(0);
+    }
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    auto rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(count_)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            uint64_t value = std::clamp(GetBucketUpperBound(i), min_us_, max_us_);
+            return std::chrono::microseconds(static_cast<long long>(value));
+        }
+    }
+    return GetMax();
+}
+
+LatencyHistogram::LatencyHistogram()
+    : count_(0)
+    , sum_us_(0)
+    , min_us_(EMPTY_MIN)
+    , max_us_(0) {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::Record(std::chrono::microseconds latency) {
+    RecordValue(ToMicros(latency));
+}
+
+void LatencyHistogram::RecordValue(uint64_t value_us) {
+    buckets_[GetBucketIndex(value_us)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_us_.fetch_add(value_us, std::memory_order_relaxed);
+    UpdateMin(value_us);
+    UpdateMax(value_us);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::TakeSnapshot() const {
+    Snapshot snapshot;
+    // Rebuilt from the buckets so the count always matches them; sum, min and
+    // max are taken as they are
+    uint64_t count = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        uint64_t bucket_count = buckets_[i].load(std::memory_order_relaxed);
+        snapshot.buckets_[i] = bucket_count;
+        count += bucket_count;
+    }
+    if (count == 0) {
+        return snapshot;
+    }
+
+    snapshot.count_ = count;
+    snapshot.sum_us_ = sum_us_.load(std::memory_order_relaxed);
+    snapshot.min_us_ = min_us_.load(std::memory_order_relaxed);
+    snapshot.max_us_ = max_us_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void LatencyHistogram::Merge(const Snapshot& snapshot) {
+    if (snapshot.IsEmpty()) return;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (snapshot.buckets_[i] != 0) {
+            buckets_[i].fetch_add(snapshot.buckets_[i], std::memory_order_relaxed);
+        }
+    }
+    count_.fetch_add(snapshot.count_, std::memory_order_relaxed);
+    sum_us_.fetch_add(snapshot.sum_us_, std::memory_order_relaxed);
+    UpdateMin(snapshot.min_us_);
+    UpdateMax(snapshot.max_us_);
+}
+
+void LatencyHistogram::Reset() {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_us_.store(0, std::memory_order_relaxed);
+    min_us_.store(EMPTY_MIN, std::memory_order_relaxed);
+    max_us_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::GetCount() const {
+    return count_.load(std::memory_order_relaxed);
+}
+
+void LatencyHistogram::UpdateMin(uint64_t value_us) {
+    uint64_t current = min_us_.load(std::memory_order_relaxed);
+    while (value_us < current &&
+           !min_us_.compare_exchange_weak(current, value_us, std::memory_order_relaxed)) {
+    }
+}
+
+void LatencyHistogram::UpdateMax(uint64_t value_us) {
+    uint64_t current = max_us_.load(std::memory_order_relaxed);
+    while (value_us > current &&
+           !max_us_.compare_exchange_weak(current, value_us, std::memory_order_relaxed)) {
+    }
+}
+
+RollingLatencyHistogram::RollingLatencyHistogram() {
+    for (auto& epoch : slot_epochs_) {
+        epoch.store(-1, std::memory_order_relaxed);
+    }
+}
+
+void RollingLatencyHistogram::Record(std::chrono::microseconds latency,
+                                     std::chrono::steady_clock::time_point now) {
+    int64_t epoch = GetSlotEpoch(now);
+    size_t index = static_cast<size_t>(epoch % static_cast<int64_t>(SLOT_COUNT));
+
+    // Whoever moves the slot to the new epoch clears what it held before
+    int64_t slot_epoch = slot_epochs_[index].load(std::memory_order_acquire);
+    if (slot_epoch < epoch &&
+        slot_epochs_[index].compare_exchange_strong(slot_epoch, epoch, std::memory_order_acq_rel)) {
+        slots_[index].Reset();
+    } else if (slot_epoch > epoch) {
+        return;   // Older than the whole ring
+    }
+    slots_[index].Record(latency);
+}
+
+LatencyHistogram::Snapshot RollingLatencyHistogram::TakeSnapshot(std::chrono::seconds window,
+                                                                 std::chrono::steady_clock::time_point now) const {
+    LatencyHistogram::Snapshot snapshot;
+    window = std::min<std::chrono::seconds>(window, MAX_WINDOW);
+    if (window.count() <= 0) {
+        return snapshot;
+    }
+
+    int64_t newest = GetSlotEpoch(now);
+    int64_t oldest = GetSlotEpoch(now - window);
+    oldest = std::max(oldest, newest - static_cast<int64_t>(SLOT_COUNT) + 1);
+
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        int64_t epoch = slot_epochs_[i].load(std::memory_order_acquire);
+        if (epoch >= oldest && epoch <= newest) {
+            snapshot.Merge(slots_[i].TakeSnapshot());
+        }
+    }
+    return snapshot;
+}
+
+void RollingLatencyHistogram::Reset() {
+    for (size_t i = 0; i < SLOT_COUNT; ++i) {
+        slot_epochs_[i].store(-1, std::memory_order_release);
+        slots_[i].Reset();
+    }
+}
+
+int64_t RollingLatencyHistogram::GetSlotEpoch(std::chrono::steady_clock::time_point time) {
+    return static_cast<int64_t>(time.time_since_epoch() / SLOT_DURATION);
+}
+
+} // namespace core
+} // namespace league_auto_accept
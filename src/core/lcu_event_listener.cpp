@@ -0,0 +1,180 @@
+#include "league_auto_accept/core/lcu_event_listener.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+LCUEventListener::LCUEventListener(std::unique_ptr<LCUEventStream> stream)
+    : stream_(std::move(stream))
+    , credentials_generation_(0)
+    , connection_epoch_(0)
+    , stopping_(false)
+    , connected_(false)
+    , event_count_(0)
+    , reconnect_count_(0) {
+    if (!stream_) {
+        throw std::invalid_argument("LCUEventListener requires an event stream");
+    }
+}
+
+LCUEventListener::~LCUEventListener() {
+    Stop();
+}
+
+void LCUEventListener::UpdateCredentials(const LCUCredentials& credentials) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool changed = credentials != credentials_;
+    if (changed) {
+        credentials_ = credentials;
+        credentials_generation_++;
+    }
+
+    if (!listener_thread_.joinable()) {
+        stopping_ = false;
+        listener_thread_ = std::thread([this]() { ListenLoop(); });
+    } else if (changed) {
+        // Drop the stream that belongs to the old client instance
+        stream_->Interrupt();
+        state_cv_.notify_all();
+    }
+}
+
+void LCUEventListener::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!listener_thread_.joinable()) return;
+        stopping_ = true;
+        connection_epoch_++;
+        stream_->Interrupt();
+    }
+    state_cv_.notify_all();
+    events_cv_.notify_all();
+
+    listener_thread_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    credentials_ = LCUCredentials{};
+}
+
+bool LCUEventListener::IsConnected() const {
+    return connected_;
+}
+
+bool LCUEventListener::WaitForEvent(LCUEvent& event, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t epoch = connection_epoch_;
+
+    events_cv_.wait_for(lock, timeout, [&]() {
+        return !events_.empty() || epoch != connection_epoch_;
+    });
+
+    if (events_.empty()) {
+        return false;
+    }
+
+    event = std::move(events_.front());
+    events_.pop_front();
+    return true;
+}
+
+int LCUEventListener::GetEventCount() const {
+    return event_count_.load();
+}
+
+int LCUEventListener::GetReconnectCount() const {
+    return reconnect_count_.load();
+}
+
+std::string LCUEventListener::GetLastError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_error_;
+}
+
+void LCUEventListener::ListenLoop() {
+    std::string message;
+    LCUEvent event;
+    bool connected_before = false;
+
+    for (;;) {
+        LCUCredentials credentials;
+        uint64_t generation;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            state_cv_.wait(lock, [this]() { return stopping_ || credentials_.IsValid(); });
+            if (stopping_) break;
+            credentials = credentials_;
+            generation = credentials_generation_;
+        }
+
+        if (ConnectAndSubscribe(credentials)) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (stopping_ || generation != credentials_generation_) {
+                    stream_->Close();
+                    continue;
+                }
+            }
+
+            if (connected_before) {
+                reconnect_count_++;
+            }
+            connected_before = true;
+            SetConnected(true);
+
+            while (stream_->ReadMessage(message)) {
+                if (!ParseWampEvent(message, event)) continue;
+                if (event.uri != GAMEFLOW_PHASE_URI && event.uri != READY_CHECK_URI) continue;
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (events_.size() >= MAX_QUEUED_EVENTS) {
+                    events_.pop_front();
+                }
+                events_.push_back(std::move(event));
+                event_count_++;
+                events_cv_.notify_one();
+            }
+
+            SetError(stream_->GetLastError());
+            stream_->Close();
+            SetConnected(false);
+        }
+
+        // Back off before reconnecting unless the credentials changed meanwhile
+        std::unique_lock<std::mutex> lock(mutex_);
+        state_cv_.wait_for(lock, RECONNECT_DELAY, [&]() {
+            return stopping_ || generation != credentials_generation_;
+        });
+        if (stopping_) break;
+    }
+
+    stream_->Close();
+    SetConnected(false);
+}
+
+bool LCUEventListener::ConnectAndSubscribe(const LCUCredentials& credentials) {
+    if (!stream_->Connect(credentials) ||
+        !stream_->Subscribe(BuildEndpointEventTopic(GAMEFLOW_PHASE_URI)) ||
+        !stream_->Subscribe(BuildEndpointEventTopic(READY_CHECK_URI))) {
+        SetError(stream_->GetLastError());
+        stream_->Close();
+        return false;
+    }
+    return true;
+}
+
+void LCUEventListener::SetConnected(bool connected) {
+    if (connected_.exchange(connected) == connected) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    connection_epoch_++;
+    events_cv_.notify_all();
+}
+
+void LCUEventListener::SetError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_error_ = message;
+}
+
+} // namespace core
+} // namespace league_auto_accept
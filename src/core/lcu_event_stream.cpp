@@ -0,0 +1,88 @@
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/json_scan.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/models/gameflow_state.h"
+
+namespace league_auto_accept {
+namespace core {
+
+bool ParseWampEvent(std::string_view message, LCUEvent& event) {
+    message = SkipJsonWhitespace(message);
+    if (message.empty() || message.front() != '[') return false;
+    message = SkipJsonWhitespace(message.substr(1));
+
+    // Message type id
+    size_t length = MeasureJsonValue(message);
+    if (length == 0 || message.substr(0, length) != "8") return false;
+    message = SkipJsonWhitespace(message.substr(length));
+    if (message.empty() || message.front() != ',') return false;
+    message = SkipJsonWhitespace(message.substr(1));
+
+    // Topic
+    length = MeasureJsonValue(message);
+    if (length == 0 || message.front() != '"') return false;
+    message = SkipJsonWhitespace(message.substr(length));
+    if (message.empty() || message.front() != ',') return false;
+    message = SkipJsonWhitespace(message.substr(1));
+
+    // Payload object
+    length = MeasureJsonValue(message);
+    if (length == 0 || message.front() != '{') return false;
+    std::string_view payload = message.substr(0, length);
+
+    std::string_view uri;
+    std::string_view event_type;
+    std::string_view data;
+    if (!FindJsonMember(payload, "uri", uri) || !UnquoteJsonString(uri, uri)) return false;
+    if (!FindJsonMember(payload, "data", data)) return false;
+    if (FindJsonMember(payload, "eventType", event_type)) {
+        UnquoteJsonString(event_type, event_type);
+    }
+
+    event.uri.assign(uri);
+    event.event_type.assign(event_type);
+    event.data.assign(data);
+    event.received_time = std::chrono::steady_clock::now();
+    return true;
+}
+
+std::string BuildEndpointEventTopic(std::string_view uri) {
+    std::string topic = JSON_API_EVENT_TOPIC;
+    for (char c : uri) {
+        topic.push_back(c == '/' ? '_' : c);
+    }
+    return topic;
+}
+
+std::string BuildWampSubscribe(std::string_view topic) {
+    std::string message = "[" + std::to_string(WAMP_SUBSCRIBE) + ",\"";
+    message.append(topic);
+    message += "\"]";
+    return message;
+}
+
+bool GetPhaseFromEvent(const LCUEvent& event, std::string_view& phase) {
+    if (event.uri == GAMEFLOW_PHASE_URI) {
+        return ParseGameflowPhase(event.data, phase);
+    }
+
+    if (event.uri == READY_CHECK_URI && event.event_type != "Delete") {
+        ReadyCheckView ready_check;
+        if (ParseReadyCheck(event.data, ready_check) && ready_check.IsPending()) {
+            phase = models::GameflowPhaseName(models::GameflowPhase::READY_CHECK);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool GetPhaseFromEvent(const LCUEvent& event, std::string& phase) {
+    std::string_view value;
+    if (!GetPhaseFromEvent(event, value)) return false;
+    phase.assign(value);
+    return true;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,201 @@
+#include "league_auto_accept/core/lcu_health.h"
+#include "league_auto_accept/core/retry_policy.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+const char* BreakerStateToString(BreakerState state) {
+    switch (state) {
+    case BreakerState::CLOSED: return "closed";
+    case BreakerState::OPEN: return "open";
+    case BreakerState::HALF_OPEN: return "half-open";
+    }
+    return "unknown";
+}
+
+LCUHealthMonitor::LCUHealthMonitor(const LCUHealthConfig& config)
+    : config_(config) {
+    if (config_.window == 0 || config_.open_below_success_rate < 0.0 || config_.open_below_success_rate > 1.0 ||
+        config_.open_after_failures <= 0 || config_.probe_interval.count() <= 0 ||
+        config_.max_probe_interval < config_.probe_interval ||
+        config_.latency_weight <= 0.0 || config_.latency_weight > 1.0) {
+        throw std::invalid_argument("Invalid LCU health configuration");
+    }
+    for (Endpoint& endpoint : endpoints_) {
+        endpoint.outcomes.assign(config_.window, 0);
+    }
+}
+
+bool LCUHealthMonitor::AllowRequest(LCUEndpointId id, Clock::time_point now, uint64_t* probe) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (probe) {
+        *probe = 0;
+    }
+    Endpoint& endpoint = At(id);
+    switch (endpoint.state) {
+    case BreakerState::CLOSED:
+        return true;
+    case BreakerState::OPEN:
+    case BreakerState::HALF_OPEN:
+        // A half-open probe that never reported back is given up, so this
+        // request probes in its place
+        if (now >= endpoint.next_probe) {
+            endpoint.state = BreakerState::HALF_OPEN;
+            endpoint.next_probe = now + endpoint.probe_interval;
+            endpoint.probe = ++probe_count_;
+            if (probe) {
+                *probe = endpoint.probe;
+            }
+            return true;
+        }
+        break;
+    }
+    endpoint.refused++;
+    return false;
+}
+
+void LCUHealthMonitor::ReleaseProbe(LCUEndpointId id, uint64_t probe, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Endpoint& endpoint = At(id);
+    if (endpoint.state == BreakerState::HALF_OPEN && probe != 0 && endpoint.probe == probe) {
+        endpoint.state = BreakerState::OPEN;
+        endpoint.next_probe = now;
+    }
+}
+
+BreakerState LCUHealthMonitor::RecordResult(LCUEndpointId id, bool success, Clock::duration latency,
+                                            Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Endpoint& endpoint = At(id);
+
+    double latency_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    endpoint.latency_us = endpoint.has_latency
+        ? endpoint.latency_us + config_.latency_weight * (latency_us - endpoint.latency_us)
+        : latency_us;
+    endpoint.has_latency = true;
+
+    if (endpoint.samples == config_.window) {
+        endpoint.successes -= endpoint.outcomes[endpoint.next];
+    } else {
+        endpoint.samples++;
+    }
+    endpoint.outcomes[endpoint.next] = success ? 1 : 0;
+    endpoint.successes += success ? 1 : 0;
+    endpoint.next = (endpoint.next + 1) % config_.window;
+    endpoint.consecutive_failures = success ? 0 : endpoint.consecutive_failures + 1;
+
+    switch (endpoint.state) {
+    case BreakerState::HALF_OPEN:
+    case BreakerState::OPEN:
+        // Late answers to requests sent before opening count as probes too
+        if (success) {
+            endpoint.state = BreakerState::CLOSED;
+            endpoint.probe_interval = Clock::duration(0);
+            ClearOutcomes(endpoint);
+        } else if (endpoint.state == BreakerState::HALF_OPEN) {
+            Open(endpoint, now, std::min<Clock::duration>(endpoint.probe_interval * 2, config_.max_probe_interval));
+        }
+        break;
+    case BreakerState::CLOSED: {
+        double rate = static_cast<double>(endpoint.successes) / static_cast<double>(endpoint.samples);
+        if (endpoint.consecutive_failures >= config_.open_after_failures ||
+            (endpoint.samples >= config_.min_samples && rate < config_.open_below_success_rate)) {
+            endpoint.opened++;
+            Open(endpoint, now, config_.probe_interval);
+        }
+        break;
+    }
+    }
+    return endpoint.state;
+}
+
+BreakerState LCUHealthMonitor::RecordResponse(LCUEndpointId endpoint, const HttpResponse& response,
+                                              Clock::duration latency, Clock::time_point now) {
+    return RecordResult(endpoint, !IsRetryableResponse(response), latency, now);
+}
+
+BreakerState LCUHealthMonitor::RecordResponse(LCUEndpointId endpoint, const HttpResponseView& response,
+                                              Clock::duration latency, Clock::time_point now) {
+    return RecordResult(endpoint, !IsRetryableStatus(response.status_code), latency, now);
+}
+
+EndpointHealth LCUHealthMonitor::GetHealth(LCUEndpointId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Endpoint& endpoint = At(id);
+
+    EndpointHealth health;
+    health.state = endpoint.state;
+    health.success_rate = endpoint.samples == 0 ? 1.0
+        : static_cast<double>(endpoint.successes) / static_cast<double>(endpoint.samples);
+    health.latency = std::chrono::microseconds(static_cast<long long>(endpoint.latency_us));
+    health.consecutive_failures = endpoint.consecutive_failures;
+    health.score = GetScore(endpoint);
+    health.refused = endpoint.refused;
+    health.opened = endpoint.opened;
+    return health;
+}
+
+BreakerState LCUHealthMonitor::GetState(LCUEndpointId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return At(id).state;
+}
+
+LCUHealthMonitor::Clock::duration LCUHealthMonitor::GetTimeUntilProbe(LCUEndpointId id,
+                                                                      Clock::time_point now) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Endpoint& endpoint = At(id);
+    if (endpoint.state != BreakerState::OPEN || now >= endpoint.next_probe) {
+        return Clock::duration(0);
+    }
+    return endpoint.next_probe - now;
+}
+
+bool LCUHealthMonitor::IsDegraded(LCUEndpointId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Endpoint& endpoint = At(id);
+    return endpoint.state != BreakerState::CLOSED || GetScore(endpoint) < config_.degraded_below_score;
+}
+
+void LCUHealthMonitor::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (Endpoint& endpoint : endpoints_) {
+        endpoint.state = BreakerState::CLOSED;
+        endpoint.latency_us = 0.0;
+        endpoint.has_latency = false;
+        endpoint.probe_interval = Clock::duration(0);
+        ClearOutcomes(endpoint);
+    }
+}
+
+void LCUHealthMonitor::Open(Endpoint& endpoint, Clock::time_point now, Clock::duration interval) {
+    endpoint.state = BreakerState::OPEN;
+    endpoint.probe_interval = interval;
+    endpoint.next_probe = now + interval;
+}
+
+void LCUHealthMonitor::ClearOutcomes(Endpoint& endpoint) {
+    std::fill(endpoint.outcomes.begin(), endpoint.outcomes.end(), 0);
+    endpoint.next = 0;
+    endpoint.samples = 0;
+    endpoint.successes = 0;
+    endpoint.consecutive_failures = 0;
+}
+
+double LCUHealthMonitor::GetScore(const Endpoint& endpoint) const {
+    if (endpoint.state == BreakerState::OPEN) {
+        return 0.0;
+    }
+    double score = endpoint.samples == 0 ? 1.0
+        : static_cast<double>(endpoint.successes) / static_cast<double>(endpoint.samples);
+    double slow_us = static_cast<double>(std::chrono::duration_cast<std::chrono::microseconds>(
+        config_.slow_latency).count());
+    if (endpoint.latency_us > slow_us) {
+        score *= slow_us / endpoint.latency_us;
+    }
+    return endpoint.state == BreakerState::HALF_OPEN ? score / 2.0 : score;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,269 @@
+#include "league_auto_accept/core/lcu_request_pool.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <atomic>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+struct LCURequestPool::Counters {
+    std::atomic<uint64_t> submitted{0};
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> cancelled{0};
+    std::atomic<uint64_t> expired{0};
+    std::atomic<uint64_t> rejected{0};
+};
+
+struct AsyncLCURequest::State {
+    HttpMethod method = HttpMethod::GET;
+    std::string path;
+    std::string body;
+    std::chrono::steady_clock::time_point deadline;
+    std::shared_ptr<LCURequestPool::Counters> counters;
+
+    mutable std::mutex mutex;
+    mutable std::condition_variable finished_cv;
+    AsyncRequestResult result;
+
+    // Callers hold the mutex
+    bool IsFinished() const {
+        return result.status != AsyncRequestStatus::PENDING && result.status != AsyncRequestStatus::RUNNING;
+    }
+
+    // Moves an unfinished request to `status`; false if it had finished.
+    // Callers hold the mutex and notify once they let go of it.
+    bool Finish(AsyncRequestStatus status) {
+        if (IsFinished()) {
+            return false;
+        }
+        result.status = status;
+        switch (status) {
+        case AsyncRequestStatus::COMPLETED: counters->completed++; break;
+        case AsyncRequestStatus::CANCELLED: counters->cancelled++; break;
+        case AsyncRequestStatus::EXPIRED: counters->expired++; break;
+        case AsyncRequestStatus::REJECTED: counters->rejected++; break;
+        default: break;
+        }
+        return true;
+    }
+};
+
+const char* AsyncRequestStatusToString(AsyncRequestStatus status) {
+    switch (status) {
+    case AsyncRequestStatus::PENDING: return "pending";
+    case AsyncRequestStatus::RUNNING: return "running";
+    case AsyncRequestStatus::COMPLETED: return "completed";
+    case AsyncRequestStatus::CANCELLED: return "cancelled";
+    case AsyncRequestStatus::EXPIRED: return "expired";
+    case AsyncRequestStatus::REJECTED: return "rejected";
+    }
+    return "unknown";
+}
+
+bool AsyncLCURequest::Cancel() {
+    if (!state_) return false;
+
+    bool cancelled;
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        cancelled = state_->Finish(AsyncRequestStatus::CANCELLED);
+    }
+    if (cancelled) {
+        state_->finished_cv.notify_all();
+    }
+    return cancelled;
+}
+
+AsyncRequestStatus AsyncLCURequest::GetStatus() const {
+    if (!state_) return AsyncRequestStatus::REJECTED;
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->result.status;
+}
+
+bool AsyncLCURequest::IsFinished() const {
+    if (!state_) return true;
+
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->IsFinished();
+}
+
+AsyncRequestResult AsyncLCURequest::Get() {
+    if (!state_) {
+        AsyncRequestResult result;
+        result.status = AsyncRequestStatus::REJECTED;
+        return result;
+    }
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    if (!state_->finished_cv.wait_until(lock, state_->deadline, [this]() { return state_->IsFinished(); }) &&
+        state_->Finish(AsyncRequestStatus::EXPIRED)) {
+        lock.unlock();
+        state_->finished_cv.notify_all();
+        lock.lock();
+    }
+    return state_->result;
+}
+
+bool AsyncLCURequest::WaitFor(std::chrono::milliseconds timeout) const {
+    if (!state_) return true;
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    return state_->finished_cv.wait_for(lock, timeout, [this]() { return state_->IsFinished(); });
+}
+
+LCURequestPool::LCURequestPool(const RequestPoolConfig& config, TransportFactory transport_factory)
+    : config_(config)
+    , counters_(std::make_shared<Counters>())
+    , stopping_(false)
+    , credentials_generation_(0)
+    , transport_factory_(std::move(transport_factory)) {
+    if (config_.workers == 0 || config_.max_queued == 0) {
+        throw std::invalid_argument("Request pool needs at least one worker and one queue slot");
+    }
+    if (!transport_factory_) {
+        std::chrono::milliseconds timeout = config_.request_timeout;
+        transport_factory_ = [timeout]() { return CreatePlatformTransport(timeout); };
+    }
+
+    workers_.reserve(config_.workers);
+    for (size_t i = 0; i < config_.workers; ++i) {
+        workers_.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+LCURequestPool::~LCURequestPool() {
+    Stop();
+}
+
+void LCURequestPool::UpdateCredentials(const LCUCredentials& credentials) {
+    std::lock_guard<std::mutex> lock(credentials_mutex_);
+    if (credentials != credentials_) {
+        credentials_ = credentials;
+        credentials_generation_++;
+    }
+}
+
+AsyncLCURequest LCURequestPool::Submit(HttpMethod method, const std::string& path, const std::string& body,
+                                       std::chrono::milliseconds deadline) {
+    auto state = std::make_shared<AsyncLCURequest::State>();
+    state->method = method;
+    state->path = path;
+    state->body = body;
+    state->deadline = std::chrono::steady_clock::now() +
+                      (deadline > std::chrono::milliseconds(0) ? deadline : config_.default_deadline);
+    state->counters = counters_;
+    counters_->submitted++;
+
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (!stopping_ && queue_.size() < config_.max_queued) {
+            queue_.push_back(state);
+            queue_cv_.notify_one();
+            return AsyncLCURequest(state);
+        }
+    }
+
+    // Nobody waits on it yet, so no notification
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->Finish(AsyncRequestStatus::REJECTED);
+    return AsyncLCURequest(state);
+}
+
+void LCURequestPool::Stop() {
+    std::deque<std::shared_ptr<AsyncLCURequest::State>> abandoned;
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        stopping_ = true;
+        abandoned.swap(queue_);
+    }
+    queue_cv_.notify_all();
+
+    for (const auto& state : abandoned) {
+        AsyncLCURequest(state).Cancel();
+    }
+    for (std::thread& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+size_t LCURequestPool::GetQueuedCount() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    return queue_.size();
+}
+
+LCURequestPool::Stats LCURequestPool::GetStats() const {
+    Stats stats;
+    stats.submitted = counters_->submitted.load();
+    stats.completed = counters_->completed.load();
+    stats.cancelled = counters_->cancelled.load();
+    stats.expired = counters_->expired.load();
+    stats.rejected = counters_->rejected.load();
+    return stats;
+}
+
+void LCURequestPool::WorkerLoop() {
+    // The worker's own connection; never touched by another thread
+    LCUSession session(transport_factory_());
+    uint64_t generation = 0;
+
+    while (true) {
+        std::shared_ptr<AsyncLCURequest::State> state;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_cv_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            state = std::move(queue_.front());
+            queue_.pop_front();
+        }
+
+        bool expired;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->IsFinished()) {
+                continue;   // Cancelled or expired while queued
+            }
+            expired = std::chrono::steady_clock::now() >= state->deadline;
+            if (expired) {
+                state->Finish(AsyncRequestStatus::EXPIRED);
+            } else {
+                state->result.status = AsyncRequestStatus::RUNNING;
+            }
+        }
+        if (expired) {
+            state->finished_cv.notify_all();
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(credentials_mutex_);
+            if (generation != credentials_generation_) {
+                generation = credentials_generation_;
+                session.UpdateCredentials(credentials_);
+            }
+        }
+
+        HttpResponse response = session.Send(state->method, state->path, state->body);
+        bool completed;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            completed = state->Finish(AsyncRequestStatus::COMPLETED);
+            if (completed) {
+                state->result.response = std::move(response);
+                if (state->result.response.IsTransportError()) {
+                    state->result.error = session.IsReady() ? session.GetLastError() : "Not connected to the LCU";
+                }
+            }
+        }
+        if (completed) {
+            state->finished_cv.notify_all();
+        }
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
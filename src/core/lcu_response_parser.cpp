@@ -0,0 +1,94 @@
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/json_scan.h"
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr double ReadyCheckView::DURATION_SECONDS;
+
+namespace {
+bool FindStringMember(std::string_view body, std::string_view key, std::string_view& value) {
+    std::string_view raw;
+    return FindJsonMember(body, key, raw) && UnquoteJsonString(raw, value);
+}
+}
+
+bool ParseGameflowPhase(std::string_view body, std::string_view& phase) {
+    body = SkipJsonWhitespace(body);
+    size_t length = MeasureJsonValue(body);
+    if (length == 0 || !SkipJsonWhitespace(body.substr(length)).empty()) {
+        return false;
+    }
+    return UnquoteJsonString(body.substr(0, length), phase);
+}
+
+bool ParseSessionPhase(std::string_view body, std::string_view& phase) {
+    return FindStringMember(body, "phase", phase);
+}
+
+bool ParseReadyCheck(std::string_view body, ReadyCheckView& view) {
+    view = ReadyCheckView();
+    bool has_state = false;
+
+    bool well_formed = VisitJsonObject(body, [&](std::string_view key, std::string_view value) {
+        if (key == "state") {
+            has_state = UnquoteJsonString(value, view.state);
+        } else if (key == "playerResponse") {
+            UnquoteJsonString(value, view.player_response);
+        } else if (key == "dodgeWarning") {
+            UnquoteJsonString(value, view.dodge_warning);
+        } else if (key == "suppressUx") {
+            view.suppress_ux = value == "true";
+        } else if (key == "timer") {
+            ParseJsonNumber(value, view.timer);
+        } else if (key == "declinerIds") {
+            int count = CountJsonArray(value);
+            if (count >= 0) {
+                view.decliner_ids = value;
+                view.decliner_count = count;
+            }
+        }
+        return true;
+    });
+
+    return well_formed && has_state;
+}
+
+bool ParseSearchReadyCheck(std::string_view body, ReadyCheckView& view) {
+    std::string_view ready_check;
+    return FindJsonMember(body, "readyCheck", ready_check) && ParseReadyCheck(ready_check, view);
+}
+
+bool ParseErrorCode(std::string_view body, std::string_view& error_code) {
+    return FindStringMember(body, "errorCode", error_code);
+}
+
+int ParseDeclinerIds(std::string_view decliner_ids, long long* ids, size_t capacity) {
+    std::string_view array = SkipJsonWhitespace(decliner_ids);
+    if (array.empty() || array.front() != '[') return -1;
+    array = SkipJsonWhitespace(array.substr(1));
+
+    size_t written = 0;
+    while (!array.empty() && array.front() != ']') {
+        size_t length = MeasureJsonValue(array);
+        if (length == 0) return -1;
+
+        long long id = 0;
+        if (!ParseJsonInteger(array.substr(0, length), id)) return -1;
+        if (written < capacity) {
+            ids[written++] = id;
+        }
+
+        array = SkipJsonWhitespace(array.substr(length));
+        if (array.empty()) return -1;
+        if (array.front() == ',') {
+            array = SkipJsonWhitespace(array.substr(1));
+        } else if (array.front() != ']') {
+            return -1;
+        }
+    }
+    return array.empty() ? -1 : static_cast<int>(written);
+}
+
+} // namespace core
+} // namespace league_auto_accept
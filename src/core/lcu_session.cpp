@@ -0,0 +1,126 @@
+#include "league_auto_accept/core/lcu_session.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+LCUSession::LCUSession(std::unique_ptr<LCUTransport> transport)
+    : transport_(std::move(transport))
+    , rebuild_count_(0) {
+    if (!transport_) {
+        throw std::invalid_argument("LCUSession requires a transport");
+    }
+}
+
+LCUSession::~LCUSession() {
+    transport_->Close();
+}
+
+bool LCUSession::UpdateCredentials(const LCUCredentials& credentials) {
+    if (credentials == credentials_ && transport_->IsOpen()) {
+        return false;
+    }
+
+    transport_->Close();
+    credentials_ = credentials;
+    last_answer_time_ = std::chrono::steady_clock::time_point();
+    if (credentials_.IsValid()) {
+        transport_->Open(credentials_);
+    }
+    rebuild_count_++;
+    return true;
+}
+
+const LCUCredentials& LCUSession::GetCredentials() const {
+    return credentials_;
+}
+
+bool LCUSession::IsReady() const {
+    return credentials_.IsValid() && transport_->IsOpen();
+}
+
+void LCUSession::Reset() {
+    transport_->Close();
+    credentials_ = LCUCredentials{};
+    last_answer_time_ = std::chrono::steady_clock::time_point();
+}
+
+HttpResponse LCUSession::Get(std::string_view path) {
+    return Send(HttpMethod::GET, path);
+}
+
+HttpResponse LCUSession::Post(std::string_view path, std::string_view body) {
+    return Send(HttpMethod::POST, path, body);
+}
+
+HttpResponse LCUSession::Send(HttpMethod method, std::string_view path, std::string_view body) {
+    return CopyResponse(SendView(method, path, body));
+}
+
+HttpResponseView LCUSession::GetView(std::string_view path) {
+    return SendView(HttpMethod::GET, path);
+}
+
+HttpResponseView LCUSession::SendView(HttpMethod method, std::string_view path, std::string_view body) {
+    if (!IsReady()) {
+        return HttpResponseView{};
+    }
+    HttpResponseView response = transport_->SendView(method, path, body);
+    if (!response.IsTransportError()) {
+        last_answer_time_ = std::chrono::steady_clock::now();
+    }
+    return response;
+}
+
+bool LCUSession::Prewarm(HttpMethod method, std::string_view path, std::string_view probe_path,
+                         std::chrono::milliseconds max_idle) {
+    if (!IsReady()) {
+        return false;
+    }
+    transport_->Prepare(method, path);
+
+    if (std::chrono::steady_clock::now() - last_answer_time_ < max_idle) {
+        return true;
+    }
+    return !GetView(probe_path).IsTransportError();
+}
+
+std::chrono::steady_clock::time_point LCUSession::GetLastAnswerTime() const {
+    return last_answer_time_;
+}
+
+int LCUSession::GetRebuildCount() const {
+    return rebuild_count_;
+}
+
+int LCUSession::GetConnectionCount() const {
+    return transport_->GetConnectionCount();
+}
+
+std::string LCUSession::GetLastError() const {
+    if (!credentials_.IsValid()) {
+        return "No LCU credentials";
+    }
+    return transport_->GetLastError();
+}
+
+HttpResponse CopyResponse(const HttpResponseView& view) {
+    HttpResponse response;
+    response.status_code = view.status_code;
+    response.body.assign(view.body);
+    response.latency = view.latency;
+    response.reused_connection = view.reused_connection;
+    return response;
+}
+
+const char* HttpMethodToString(HttpMethod method) {
+    switch (method) {
+    case HttpMethod::GET: return "GET";
+    case HttpMethod::POST: return "POST";
+    case HttpMethod::PUT: return "PUT";
+    default: return "GET";
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
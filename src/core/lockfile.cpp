@@ -0,0 +1,114 @@
+#include "league_auto_accept/core/lockfile.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <array>
+#include <cstdlib>
+#include <fstream>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr size_t LOCKFILE_FIELD_COUNT = 5;
+constexpr size_t MAX_PORT = 65535;
+
+std::string GetEnvironment(const char* name) {
+    const char* value = std::getenv(name);
+    return value != nullptr ? value : "";
+}
+}
+
+bool ParseLockfile(std::string_view content, LockfileInfo& info) {
+    // Single line, no trailing newline from the client, but tolerate one
+    size_t line_end = content.find_first_of("\r\n");
+    if (line_end != std::string_view::npos) {
+        content = content.substr(0, line_end);
+    }
+
+    std::array<std::string_view, LOCKFILE_FIELD_COUNT> fields;
+    size_t field_count = 0;
+    size_t start = 0;
+    while (field_count < LOCKFILE_FIELD_COUNT) {
+        size_t colon = content.find(':', start);
+        if (field_count + 1 == LOCKFILE_FIELD_COUNT) {
+            // The protocol is last; anything after it is malformed
+            if (colon != std::string_view::npos) return false;
+            fields[field_count++] = content.substr(start);
+            break;
+        }
+        if (colon == std::string_view::npos) return false;
+        fields[field_count++] = content.substr(start, colon - start);
+        start = colon + 1;
+    }
+
+    size_t process_id = 0;
+    size_t port = 0;
+    if (fields[0].empty() || fields[3].empty() ||
+        !ParseUnsigned(fields[1], process_id) ||
+        !ParseUnsigned(fields[2], port) || port == 0 || port > MAX_PORT) {
+        return false;
+    }
+
+    info.process_name.assign(fields[0]);
+    info.process_id = static_cast<int>(process_id);
+    info.port = static_cast<int>(port);
+    info.password.assign(fields[3]);
+    info.protocol.assign(fields[4]);
+    return true;
+}
+
+bool ReadLockfile(const std::string& path, LockfileInfo& info) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::string line;
+    return std::getline(file, line) && ParseLockfile(line, info);
+}
+
+std::vector<std::string> GetDefaultLockfilePaths() {
+    std::vector<std::string> paths;
+
+    std::string override_path = GetEnvironment("LAA_LOCKFILE");
+    if (!override_path.empty()) {
+        paths.push_back(override_path);
+    }
+
+#ifdef _WIN32
+    const std::string league_suffix = "\\Riot Games\\League of Legends\\lockfile";
+    std::string local_appdata = GetEnvironment("LOCALAPPDATA");
+    std::string program_files = GetEnvironment("PROGRAMFILES");
+    std::string program_files_x86 = GetEnvironment("PROGRAMFILES(X86)");
+    std::string user_profile = GetEnvironment("USERPROFILE");
+
+    if (!local_appdata.empty()) paths.push_back(local_appdata + league_suffix);
+    paths.push_back("C:" + league_suffix);
+    if (!program_files.empty()) paths.push_back(program_files + league_suffix);
+    if (!program_files_x86.empty()) paths.push_back(program_files_x86 + league_suffix);
+    if (!user_profile.empty()) paths.push_back(user_profile + "\\AppData\\Local" + league_suffix);
+    if (!local_appdata.empty()) {
+        paths.push_back(local_appdata + "\\Riot Games\\Riot Client\\Config\\lockfile");
+    }
+#endif
+
+    return paths;
+}
+
+bool FindLockfile(const std::vector<std::string>& paths, LockfileInfo& info, std::string* found_path) {
+    for (const std::string& path : paths) {
+        LockfileInfo candidate;
+        if (!ReadLockfile(path, candidate) || candidate.IsRiotClient()) {
+            continue;
+        }
+
+        info = std::move(candidate);
+        if (found_path != nullptr) {
+            *found_path = path;
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace core
+} // namespace league_auto_accept
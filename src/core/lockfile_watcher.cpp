@@ -0,0 +1,175 @@
+#include "league_auto_accept/core/lockfile_watcher.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <filesystem>
+#include <map>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+// Wait used once every candidate directory is watched; only changes matter
+constexpr std::chrono::milliseconds IDLE_WAIT{std::chrono::hours(1)};
+
+#ifdef _WIN32
+constexpr char PATH_SEPARATOR = '\\';
+#else
+constexpr char PATH_SEPARATOR = '/';
+#endif
+
+bool SamePath(const std::string& a, const std::string& b) {
+#ifdef _WIN32
+    return EqualsIgnoreCase(a, b);
+#else
+    return a == b;
+#endif
+}
+}
+
+LockfileWatcher::LockfileWatcher(std::vector<std::string> paths, std::unique_ptr<DirectoryWatch> watch)
+    : paths_(std::move(paths))
+    , watch_(std::move(watch))
+    , stopping_(false)
+    , stale_(true)
+    , fully_watched_(false)
+    , scan_count_(0)
+    , cached_found_(false) {
+    for (const std::string& path : paths_) {
+        std::filesystem::path file(path);
+        std::string directory = file.parent_path().string();
+        if (directory.empty()) directory = ".";
+        candidates_.push_back({path, directory, directory + PATH_SEPARATOR + file.filename().string()});
+    }
+}
+
+LockfileWatcher::~LockfileWatcher() {
+    Stop();
+}
+
+bool LockfileWatcher::GetLockfile(LockfileInfo& info, std::string* found_path) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (!watch_thread_.joinable()) {
+        Start();
+    }
+
+    // Cleared before reading, so a change during the scan triggers another
+    if (stale_.exchange(false)) {
+        scan_count_++;
+        cached_found_ = FindLockfile(paths_, cached_info_, &cached_path_);
+    }
+
+    if (!cached_found_) {
+        return false;
+    }
+    info = cached_info_;
+    if (found_path != nullptr) {
+        *found_path = cached_path_;
+    }
+    return true;
+}
+
+void LockfileWatcher::Stop() {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    if (!watch_thread_.joinable()) {
+        return;
+    }
+
+    stopping_ = true;
+    watch_->Interrupt();
+    watch_thread_.join();
+
+    // Changes while nobody watches go unnoticed
+    stale_ = true;
+}
+
+bool LockfileWatcher::IsFullyWatched() const {
+    return fully_watched_.load();
+}
+
+int LockfileWatcher::GetScanCount() const {
+    return scan_count_.load();
+}
+
+void LockfileWatcher::Start() {
+    stopping_ = false;
+    // Watches go up before the first scan, so nothing written in between is missed
+    fully_watched_ = WatchDirectories();
+    stale_ = true;
+    watch_thread_ = std::thread([this]() { WatchLoop(); });
+}
+
+bool LockfileWatcher::WatchDirectories() {
+    bool all_watched = true;
+    bool added = false;
+    for (const Candidate& candidate : candidates_) {
+        if (watch_->IsWatching(candidate.directory)) {
+            continue;
+        }
+        if (watch_->AddDirectory(candidate.directory)) {
+            added = true;
+        } else {
+            all_watched = false;
+        }
+    }
+
+    // The lockfile may have been written before the watch existed
+    if (added) {
+        stale_ = true;
+    }
+    return all_watched;
+}
+
+void LockfileWatcher::WatchLoop() {
+    std::vector<std::string> changed_paths;
+
+    while (!stopping_) {
+        changed_paths.clear();
+        bool changed = watch_->WaitForChanges(changed_paths, fully_watched_ ? IDLE_WAIT : RESCAN_INTERVAL);
+        if (stopping_) {
+            break;
+        }
+
+        if (changed) {
+            for (const std::string& path : changed_paths) {
+                if (IsCandidate(path)) {
+                    stale_ = true;
+                    break;
+                }
+            }
+        }
+
+        // A removed directory drops its watch; a missing one may have been
+        // created since. Either way only the directory is probed, not the lockfile.
+        if (!fully_watched_ || changed) {
+            fully_watched_ = WatchDirectories();
+        }
+    }
+}
+
+bool LockfileWatcher::IsCandidate(const std::string& changed_path) const {
+    for (const Candidate& candidate : candidates_) {
+        // The directory itself is reported when its file names were lost
+        if (SamePath(changed_path, candidate.watched_path) || SamePath(changed_path, candidate.directory)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ReadWatchedLockfile(const std::string& path, LockfileInfo& info) {
+    static std::mutex watchers_mutex;
+    static std::map<std::string, std::unique_ptr<LockfileWatcher>> watchers;
+
+    LockfileWatcher* watcher;
+    {
+        std::lock_guard<std::mutex> lock(watchers_mutex);
+        auto& entry = watchers[path];
+        if (!entry) {
+            entry = std::make_unique<LockfileWatcher>(std::vector<std::string>{path});
+        }
+        watcher = entry.get();
+    }
+    return watcher->GetLockfile(info);
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,57 @@
+#include "league_auto_accept/core/log_history.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+LogHistory::LogHistory(size_t max_lines)
+    : first_(0)
+    , count_(0)
+    , text_length_(0) {
+    if (max_lines == 0) {
+        throw std::invalid_argument("LogHistory needs room for at least one line");
+    }
+    lines_.resize(max_lines);
+}
+
+size_t LogHistory::Append(std::string line) {
+    size_t evicted = 0;
+    text_length_ += line.size();
+
+    if (count_ < lines_.size()) {
+        lines_[(first_ + count_) % lines_.size()] = std::move(line);
+        count_++;
+    } else {
+        // The oldest line's slot takes the new one
+        evicted = lines_[first_].size();
+        text_length_ -= evicted;
+        lines_[first_] = std::move(line);
+        first_ = (first_ + 1) % lines_.size();
+    }
+    return evicted;
+}
+
+const std::string& LogHistory::GetLine(size_t index) const {
+    return lines_[(first_ + index) % lines_.size()];
+}
+
+std::string LogHistory::GetText() const {
+    std::string text;
+    text.reserve(text_length_);
+    for (size_t i = 0; i < count_; ++i) {
+        text += GetLine(i);
+    }
+    return text;
+}
+
+void LogHistory::Clear() {
+    for (std::string& line : lines_) {
+        line.clear();
+    }
+    first_ = 0;
+    count_ = 0;
+    text_length_ = 0;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,82 @@
+#include "league_auto_accept/core/log_ring.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+LogRing::LogRing(size_t capacity)
+    : mask_(0)
+    , enqueue_position_(0)
+    , dequeue_position_(0)
+    , dropped_count_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("LogRing capacity must be positive");
+    }
+
+    size_t rounded = 1;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    mask_ = rounded - 1;
+
+    slots_.reset(new Slot[rounded]);
+    for (size_t i = 0; i < rounded; ++i) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool LogRing::Push(std::string message) {
+    return Push(std::move(message), std::chrono::system_clock::now());
+}
+
+bool LogRing::Push(std::string message, std::chrono::system_clock::time_point time) {
+    // A slot is free for position p when its sequence is p; it holds a line
+    // for the consumer when its sequence is p + 1
+    size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots_[position & mask_];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            dropped_count_.fetch_add(1, std::memory_order_relaxed);
+            return false;   // Full: the consumer has not freed this slot yet
+        } else {
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->entry.time = time;
+    slot->entry.message = std::move(message);
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+size_t LogRing::Drain(std::vector<LogEntry>& entries, size_t max_entries) {
+    size_t drained = 0;
+    while (drained < max_entries) {
+        Slot& slot = slots_[dequeue_position_ & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != dequeue_position_ + 1) {
+            break;   // Empty, or the next producer has not finished writing
+        }
+
+        entries.push_back(std::move(slot.entry));
+        slot.entry.message.clear();
+        slot.sequence.store(dequeue_position_ + mask_ + 1, std::memory_order_release);
+        dequeue_position_++;
+        drained++;
+    }
+    return drained;
+}
+
+uint64_t LogRing::GetDroppedCount() const {
+    return dropped_count_.load(std::memory_order_relaxed);
+}
+
+} // namespace core
+} // namespace league_auto_accept
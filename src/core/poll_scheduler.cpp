@@ -0,0 +1,88 @@
+#include "league_auto_accept/core/poll_scheduler.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+bool PollSchedule::IsValid() const {
+    return active.count() > 0 && active <= idle && idle <= dormant;
+}
+
+PollScheduler::PollScheduler(const PollSchedule& schedule)
+    : schedule_(schedule)
+    , has_last_poll_(false)
+    , poll_count_(0)
+    , requests_saved_(0)
+    , carry_(0) {
+    if (!schedule_.IsValid()) {
+        throw std::invalid_argument("Poll schedule intervals must be positive and increase from active to dormant");
+    }
+}
+
+std::chrono::milliseconds PollScheduler::GetInterval(models::GameflowPhase phase) const {
+    switch (phase) {
+    case models::GameflowPhase::MATCHMAKING:
+    case models::GameflowPhase::CHECKED_INTO_TOURNAMENT:
+    case models::GameflowPhase::READY_CHECK:
+        return schedule_.active;
+
+    case models::GameflowPhase::GAME_START:
+    case models::GameflowPhase::IN_PROGRESS:
+    case models::GameflowPhase::RECONNECT:
+    case models::GameflowPhase::WAITING_FOR_STATS:
+    case models::GameflowPhase::PRE_END_OF_GAME:
+    case models::GameflowPhase::END_OF_GAME:
+        return schedule_.dormant;
+
+    default:
+        return schedule_.idle;
+    }
+}
+
+std::chrono::milliseconds PollScheduler::GetInterval(std::string_view phase) const {
+    models::GameflowPhase parsed;
+    if (!models::TryParseGameflowPhase(phase, parsed)) {
+        return schedule_.idle;
+    }
+    return GetInterval(parsed);
+}
+
+void PollScheduler::RecordPoll(std::chrono::steady_clock::time_point now) {
+    poll_count_++;
+
+    if (has_last_poll_) {
+        // A fixed-interval loop would have polled once per `active` over the
+        // same gap; we polled once
+        auto gap = std::chrono::duration_cast<std::chrono::microseconds>(now - last_poll_) + carry_;
+        auto active = std::chrono::duration_cast<std::chrono::microseconds>(schedule_.active);
+        auto fixed_polls = static_cast<uint64_t>(gap / active);
+        if (fixed_polls > 1) {
+            requests_saved_ += fixed_polls - 1;
+        }
+        carry_ = gap % active;
+    }
+
+    last_poll_ = now;
+    has_last_poll_ = true;
+}
+
+void PollScheduler::ResetClock() {
+    has_last_poll_ = false;
+    carry_ = std::chrono::microseconds(0);
+}
+
+uint64_t PollScheduler::GetPollCount() const {
+    return poll_count_.load();
+}
+
+uint64_t PollScheduler::GetRequestsSaved() const {
+    return requests_saved_.load();
+}
+
+void PollScheduler::ResetStats() {
+    poll_count_ = 0;
+    requests_saved_ = 0;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,98 @@
+#include "league_auto_accept/core/proc_process_source.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+// The kernel cuts comm at TASK_COMM_LEN - 1 characters
+constexpr size_t COMM_MAX_LENGTH = 15;
+
+std::string BaseName(const std::string& path) {
+    size_t slash = path.rfind('/');
+    return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+}
+
+ProcProcessSource::ProcProcessSource(std::string root)
+    : root_(std::move(root)) {
+}
+
+bool ProcProcessSource::ListProcessIds(std::vector<uint32_t>& process_ids) {
+    process_ids.clear();
+
+    DIR* directory = opendir(root_.c_str());
+    if (directory == nullptr) {
+        last_error_ = "Cannot open " + root_ + ": " + std::strerror(errno);
+        return false;
+    }
+
+    while (dirent* entry = readdir(directory)) {
+        size_t process_id = 0;
+        if (entry->d_name[0] >= '1' && entry->d_name[0] <= '9' &&
+            ParseUnsigned(entry->d_name, process_id)) {
+            process_ids.push_back(static_cast<uint32_t>(process_id));
+        }
+    }
+
+    closedir(directory);
+    return true;
+}
+
+bool ProcProcessSource::GetProcessName(uint32_t process_id, std::string& name) {
+    std::string comm_path = root_ + "/" + std::to_string(process_id) + "/comm";
+    int fd = open(comm_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        last_error_ = "Cannot open " + comm_path + ": " + std::strerror(errno);
+        return false;
+    }
+
+    char buffer[64];
+    ssize_t length = read(fd, buffer, sizeof(buffer));
+    close(fd);
+    if (length <= 0) {
+        last_error_ = "Cannot read " + comm_path;
+        return false;
+    }
+
+    name.assign(buffer, static_cast<size_t>(length));
+    if (!name.empty() && name.back() == '\n') {
+        name.pop_back();
+    }
+
+    // A cut-off name: the executable link has the full one when we may read it
+    std::string path;
+    if (name.size() == COMM_MAX_LENGTH && GetExecutablePath(process_id, path)) {
+        name = BaseName(path);
+    }
+    return true;
+}
+
+bool ProcProcessSource::GetExecutablePath(uint32_t process_id, std::string& path) {
+    std::string exe_link = root_ + "/" + std::to_string(process_id) + "/exe";
+    char buffer[4096];
+    ssize_t length = readlink(exe_link.c_str(), buffer, sizeof(buffer));
+    if (length <= 0 || static_cast<size_t>(length) == sizeof(buffer)) {
+        last_error_ = "Cannot resolve " + exe_link + ": " + std::strerror(errno);
+        return false;
+    }
+
+    path.assign(buffer, static_cast<size_t>(length));
+    return true;
+}
+
+std::string ProcProcessSource::GetLastError() const {
+    return last_error_;
+}
+
+std::unique_ptr<ProcessSource> CreatePlatformProcessSource() {
+    return std::make_unique<ProcProcessSource>();
+}
+
+} // namespace core
+} // namespace league_auto_accept
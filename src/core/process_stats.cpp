@@ -0,0 +1,109 @@
+#include "league_auto_accept/core/process_stats.h"
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <unistd.h>
+#include <fstream>
+#include <string>
+#endif
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+// Cumulative idle and total CPU time, in platform ticks
+bool ReadSystemCpuTimes(uint64_t& idle, uint64_t& total) {
+#ifdef _WIN32
+    FILETIME idle_time, kernel_time, user_time;
+    if (!GetSystemTimes(&idle_time, &kernel_time, &user_time)) {
+        return false;
+    }
+
+    auto FileTimeToULL = [](const FILETIME& ft) -> uint64_t {
+        return static_cast<uint64_t>(ft.dwHighDateTime) << 32 | ft.dwLowDateTime;
+    };
+
+    // Kernel time already includes idle time
+    idle = FileTimeToULL(idle_time);
+    total = FileTimeToULL(kernel_time) + FileTimeToULL(user_time);
+    return true;
+#else
+    std::ifstream stat("/proc/stat");
+    std::string label;
+    if (!(stat >> label) || label != "cpu") {
+        return false;
+    }
+
+    // user nice system idle iowait irq softirq steal
+    uint64_t fields[8] = {};
+    for (uint64_t& field : fields) {
+        if (!(stat >> field)) return false;
+    }
+
+    idle = fields[3] + fields[4];
+    total = 0;
+    for (uint64_t field : fields) total += field;
+    return true;
+#endif
+}
+}
+
+double GetProcessMemoryUsageMB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS_EX pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(),
+                             reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&pmc),
+                             sizeof(pmc))) {
+        return static_cast<double>(pmc.WorkingSetSize) / BYTES_PER_MB;
+    }
+    return 0.0;
+#else
+    // statm: total and resident size in pages
+    std::ifstream statm("/proc/self/statm");
+    uint64_t total_pages = 0;
+    uint64_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) {
+        return 0.0;
+    }
+    return static_cast<double>(resident_pages) * static_cast<double>(sysconf(_SC_PAGESIZE)) / BYTES_PER_MB;
+#endif
+}
+
+CpuUsageSampler::CpuUsageSampler()
+    : last_idle_(0)
+    , last_total_(0)
+    , has_baseline_(false) {
+}
+
+double CpuUsageSampler::Sample() {
+    uint64_t idle = 0;
+    uint64_t total = 0;
+    if (!ReadSystemCpuTimes(idle, total)) {
+        return 0.0;
+    }
+
+    if (!has_baseline_) {
+        last_idle_ = idle;
+        last_total_ = total;
+        has_baseline_ = true;
+        return 0.0; // No previous measurement
+    }
+
+    uint64_t idle_diff = idle - last_idle_;
+    uint64_t total_diff = total - last_total_;
+    last_idle_ = idle;
+    last_total_ = total;
+
+    if (total_diff == 0) return 0.0;
+
+    double cpu_usage = 100.0 * (1.0 - static_cast<double>(idle_diff) / static_cast<double>(total_diff));
+    return std::max(0.0, std::min(100.0, cpu_usage));
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,110 @@
+#include "league_auto_accept/core/process_tracker.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+ProcessTracker::ProcessTracker(std::unique_ptr<ProcessSource> source)
+    : source_(std::move(source)) {
+    if (!source_) {
+        throw std::invalid_argument("ProcessTracker requires a process source");
+    }
+}
+
+bool ProcessTracker::Update() {
+    last_stats_ = UpdateStats();
+    if (!source_->ListProcessIds(current_ids_)) {
+        return false;
+    }
+    std::sort(current_ids_.begin(), current_ids_.end());
+
+    // Merge the sorted id list with the sorted cache: ids on both sides keep
+    // their cached name, new ids get looked up, cached ids not listed exited
+    merged_.clear();
+    merged_.reserve(current_ids_.size());
+    auto cached = processes_.begin();
+    for (uint32_t process_id : current_ids_) {
+        while (cached != processes_.end() && cached->process_id < process_id) {
+            last_stats_.exited++;
+            ++cached;
+        }
+
+        if (cached != processes_.end() && cached->process_id == process_id) {
+            merged_.push_back(std::move(*cached));
+            ++cached;
+            continue;
+        }
+
+        TrackedProcess process{process_id, std::string()};
+        last_stats_.started++;
+        last_stats_.name_lookups++;
+        if (!source_->GetProcessName(process_id, process.name)) {
+            process.name.clear();
+        }
+        merged_.push_back(std::move(process));
+    }
+    last_stats_.exited += static_cast<size_t>(processes_.end() - cached);
+
+    processes_.swap(merged_);
+    return true;
+}
+
+bool ProcessTracker::FindProcess(std::string_view name, uint32_t& process_id) const {
+    for (const TrackedProcess& process : processes_) {
+        if (EqualsIgnoreCase(process.name, name)) {
+            process_id = process.process_id;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<uint32_t> ProcessTracker::FindAllProcesses(std::string_view name) const {
+    std::vector<uint32_t> process_ids;
+    for (const TrackedProcess& process : processes_) {
+        if (EqualsIgnoreCase(process.name, name)) {
+            process_ids.push_back(process.process_id);
+        }
+    }
+    return process_ids;
+}
+
+bool ProcessTracker::IsTracked(uint32_t process_id) const {
+    return FindTracked(process_id) != nullptr;
+}
+
+bool ProcessTracker::GetProcessName(uint32_t process_id, std::string& name) const {
+    const TrackedProcess* process = FindTracked(process_id);
+    if (process == nullptr || process->name.empty()) {
+        return false;
+    }
+    name = process->name;
+    return true;
+}
+
+size_t ProcessTracker::GetProcessCount() const {
+    return processes_.size();
+}
+
+const ProcessTracker::UpdateStats& ProcessTracker::GetLastUpdateStats() const {
+    return last_stats_;
+}
+
+ProcessSource& ProcessTracker::GetSource() {
+    return *source_;
+}
+
+void ProcessTracker::Clear() {
+    processes_.clear();
+}
+
+const ProcessTracker::TrackedProcess* ProcessTracker::FindTracked(uint32_t process_id) const {
+    auto process = std::lower_bound(processes_.begin(), processes_.end(), process_id,
+                                    [](const TrackedProcess& tracked, uint32_t id) { return tracked.process_id < id; });
+    return process != processes_.end() && process->process_id == process_id ? &*process : nullptr;
+}
+
+} // namespace core
+} // namespace league_auto_accept
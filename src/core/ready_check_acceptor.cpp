@@ -0,0 +1,123 @@
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/lcu_session.h"
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr int STATUS_NOT_FOUND = 404;
+
+std::chrono::microseconds ElapsedMicros(std::chrono::steady_clock::time_point from,
+                                        std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(to - from);
+}
+}
+
+const char* AcceptStageToString(AcceptStage stage) {
+    switch (stage) {
+    case AcceptStage::DISPATCH: return "dispatch";
+    case AcceptStage::POST: return "post";
+    case AcceptStage::VERIFY: return "verify";
+    case AcceptStage::TOTAL: return "total";
+    default: return "unknown";
+    }
+}
+
+ReadyCheckAcceptor::ReadyCheckAcceptor(LCUSession& session)
+    : ReadyCheckAcceptor([&session](HttpMethod method, std::string_view path) {
+          return session.SendView(method, path);
+      }) {
+}
+
+ReadyCheckAcceptor::ReadyCheckAcceptor(SendFunction send)
+    : send_(std::move(send))
+    , cached_endpoint_index_(-1) {
+    if (!send_) {
+        throw std::invalid_argument("ReadyCheckAcceptor requires a send function");
+    }
+}
+
+AcceptResult ReadyCheckAcceptor::Accept(std::chrono::steady_clock::time_point detected_at,
+                                        std::chrono::steady_clock::time_point deadline) {
+    AcceptResult result;
+    result.detected_at = detected_at;
+    auto post_start = std::chrono::steady_clock::now();
+    result.stage_latency[static_cast<size_t>(AcceptStage::DISPATCH)] = ElapsedMicros(detected_at, post_start);
+
+    // Learned endpoint first, then the rest in their documented order
+    int count = static_cast<int>(READY_CHECK_ACCEPT_ENDPOINTS.size());
+    int first = cached_endpoint_index_ >= 0 ? cached_endpoint_index_ : 0;
+
+    for (int offset = 0; offset < count; ++offset) {
+        int index = (first + offset) % count;
+        const char* endpoint = READY_CHECK_ACCEPT_ENDPOINTS[index];
+        if (std::chrono::steady_clock::now() >= deadline) {
+            result.deadline_reached = true;
+            break;
+        }
+
+        HttpResponseView response = send_(HttpMethod::POST, endpoint);
+        result.attempts++;
+        result.status_code = response.status_code;
+
+        if (response.IsSuccess()) {
+            result.accepted = true;
+            result.endpoint = endpoint;
+            result.error_code.clear();
+            cached_endpoint_index_ = index;
+            break;
+        }
+
+        std::string_view error_code;
+        if (ParseErrorCode(response.body, error_code)) {
+            result.error_code.assign(error_code);
+        }
+
+        // Only an unknown endpoint is worth another try; anything else (no
+        // ready check, connection lost) fails the same way everywhere
+        if (response.status_code != STATUS_NOT_FOUND) {
+            break;
+        }
+        if (index == cached_endpoint_index_) {
+            cached_endpoint_index_ = -1;
+        }
+    }
+
+    auto post_end = std::chrono::steady_clock::now();
+    result.stage_latency[static_cast<size_t>(AcceptStage::POST)] = ElapsedMicros(post_start, post_end);
+    result.stage_latency[static_cast<size_t>(AcceptStage::TOTAL)] = ElapsedMicros(detected_at, post_end);
+    return result;
+}
+
+bool ReadyCheckAcceptor::Verify(AcceptResult& result) {
+    auto verify_start = std::chrono::steady_clock::now();
+    HttpResponseView response = send_(HttpMethod::GET, READY_CHECK_URI);
+
+    ReadyCheckView ready_check;
+    result.verified = response.IsSuccess() &&
+                      ParseReadyCheck(response.body, ready_check) &&
+                      ready_check.IsAccepted();
+
+    auto verify_end = std::chrono::steady_clock::now();
+    result.stage_latency[static_cast<size_t>(AcceptStage::VERIFY)] = ElapsedMicros(verify_start, verify_end);
+    result.stage_latency[static_cast<size_t>(AcceptStage::TOTAL)] = ElapsedMicros(result.detected_at, verify_end);
+    return result.verified;
+}
+
+void ReadyCheckAcceptor::ResetEndpointCache() {
+    cached_endpoint_index_ = -1;
+}
+
+const char* ReadyCheckAcceptor::GetCachedEndpoint() const {
+    return cached_endpoint_index_ >= 0 ? READY_CHECK_ACCEPT_ENDPOINTS[cached_endpoint_index_] : nullptr;
+}
+
+const char* ReadyCheckAcceptor::GetNextEndpoint() const {
+    return READY_CHECK_ACCEPT_ENDPOINTS[cached_endpoint_index_ >= 0 ? cached_endpoint_index_ : 0];
+}
+
+} // namespace core
+} // namespace league_auto_accept
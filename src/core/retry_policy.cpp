@@ -0,0 +1,266 @@
+#include "league_auto_accept/core/retry_policy.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+const char* RetryOutcomeToString(RetryOutcome outcome) {
+    switch (outcome) {
+    case RetryOutcome::SUCCEEDED: return "succeeded";
+    case RetryOutcome::NOT_RETRYABLE: return "not retryable";
+    case RetryOutcome::ATTEMPTS_EXHAUSTED: return "attempts exhausted";
+    case RetryOutcome::BUDGET_EXHAUSTED: return "retry budget exhausted";
+    case RetryOutcome::DEADLINE_REACHED: return "deadline reached";
+    case RetryOutcome::REFUSED: return "retry refused";
+    }
+    return "unknown";
+}
+
+bool IsRetryableStatus(int status_code) {
+    return status_code == 0 || status_code == 408 || status_code == 429 || status_code >= 500;
+}
+
+bool IsRetryableResponse(const HttpResponse& response) {
+    return IsRetryableStatus(response.status_code);
+}
+
+bool RetryWaiter::WaitFor(std::chrono::nanoseconds timeout) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t generation = generation_;
+    return wake_cv_.wait_for(lock, timeout, [this, generation]() { return generation_ != generation; });
+}
+
+void RetryWaiter::Wake() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        generation_++;
+    }
+    wake_cv_.notify_all();
+}
+
+RetryPolicy::RetryPolicy(const RetryPolicyConfig& config, uint32_t seed)
+    : config_(config)
+    , random_(seed)
+    , requests_(0)
+    , attempts_(0)
+    , succeeded_(0)
+    , budget_exhausted_(0)
+    , deadline_reached_(0) {
+    if (config_.max_attempts < 1 || config_.retry_budget < 0 ||
+        config_.initial_backoff.count() < 0 || config_.max_backoff < config_.initial_backoff ||
+        config_.backoff_multiplier < 1.0 || config_.jitter < 0.0 || config_.jitter > 1.0 ||
+        config_.budget_window.count() <= 0) {
+        throw std::invalid_argument("Invalid retry policy");
+    }
+}
+
+std::chrono::milliseconds RetryPolicy::GetBackoff(int retry) {
+    double backoff = static_cast<double>(config_.initial_backoff.count()) *
+                     std::pow(config_.backoff_multiplier, std::max(retry - 1, 0));
+    backoff = std::min(backoff, static_cast<double>(config_.max_backoff.count()));
+
+    double fraction;
+    {
+        std::lock_guard<std::mutex> lock(random_mutex_);
+        fraction = std::uniform_real_distribution<double>(0.0, 1.0)(random_);
+    }
+    return std::chrono::milliseconds(std::llround(backoff * (1.0 - config_.jitter * fraction)));
+}
+
+RetryPolicy::Budget& RetryPolicy::RefillBudget(const std::string& endpoint, Clock::time_point now) {
+    auto it = budgets_.find(endpoint);
+    if (it == budgets_.end()) {
+        Budget full;
+        full.tokens = static_cast<double>(config_.retry_budget);
+        full.refilled_at = now;
+        return budgets_.emplace(endpoint, full).first->second;
+    }
+
+    Budget& budget = it->second;
+    if (now > budget.refilled_at) {
+        double elapsed = std::chrono::duration<double>(now - budget.refilled_at).count();
+        double window = std::chrono::duration<double>(config_.budget_window).count();
+        budget.tokens = std::min(static_cast<double>(config_.retry_budget),
+                                 budget.tokens + elapsed / window * config_.retry_budget);
+        budget.refilled_at = now;
+    }
+    return budget;
+}
+
+bool RetryPolicy::TryConsumeBudget(const std::string& endpoint, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(budget_mutex_);
+    Budget& budget = RefillBudget(endpoint, now);
+    if (budget.tokens < 1.0) {
+        return false;
+    }
+    budget.tokens -= 1.0;
+    return true;
+}
+
+int RetryPolicy::GetRemainingBudget(const std::string& endpoint, Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(budget_mutex_);
+    return static_cast<int>(RefillBudget(endpoint, now).tokens);
+}
+
+RetryResult RetryPolicy::Execute(const std::string& endpoint, Clock::time_point deadline, const Attempt& attempt,
+                                 RetryWaiter* waiter, const FailureCallback& on_failure,
+                                 const RetryCheck& may_retry) {
+    RetryResult result;
+    requests_++;
+
+    while (true) {
+        if (Clock::now() >= deadline) {
+            result.outcome = RetryOutcome::DEADLINE_REACHED;
+            deadline_reached_++;
+            return result;
+        }
+        // The budget is only spent on retries that will happen
+        if (result.attempts > 0) {
+            if (may_retry && !may_retry()) {
+                result.outcome = RetryOutcome::REFUSED;
+                return result;
+            }
+            if (!TryConsumeBudget(endpoint)) {
+                result.outcome = RetryOutcome::BUDGET_EXHAUSTED;
+                budget_exhausted_++;
+                return result;
+            }
+        }
+
+        result.response = attempt();
+        result.attempts++;
+        attempts_++;
+        if (result.response.IsSuccess()) {
+            result.outcome = RetryOutcome::SUCCEEDED;
+            succeeded_++;
+            return result;
+        }
+        if (!IsRetryableResponse(result.response)) {
+            result.outcome = RetryOutcome::NOT_RETRYABLE;
+            return result;
+        }
+        if (on_failure) {
+            on_failure(result.response);
+        }
+        if (result.attempts >= config_.max_attempts) {
+            result.outcome = RetryOutcome::ATTEMPTS_EXHAUSTED;
+            return result;
+        }
+
+        // Give up now rather than sleep into the deadline or for a retry
+        // the budget cannot pay for
+        std::chrono::milliseconds backoff = GetBackoff(result.attempts);
+        Clock::time_point now = Clock::now();
+        if (now + backoff >= deadline) {
+            result.outcome = RetryOutcome::DEADLINE_REACHED;
+            deadline_reached_++;
+            return result;
+        }
+        if (GetRemainingBudget(endpoint, now) < 1) {
+            result.outcome = RetryOutcome::BUDGET_EXHAUSTED;
+            budget_exhausted_++;
+            return result;
+        }
+
+        if (waiter) {
+            waiter->WaitFor(backoff);
+        } else {
+            std::this_thread::sleep_for(backoff);
+        }
+        result.waited += std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - now);
+    }
+}
+
+RetryPolicy::Stats RetryPolicy::GetStats() const {
+    Stats stats;
+    stats.requests = requests_.load();
+    stats.attempts = attempts_.load();
+    stats.succeeded = succeeded_.load();
+    stats.budget_exhausted = budget_exhausted_.load();
+    stats.deadline_reached = deadline_reached_.load();
+    return stats;
+}
+
+void RetryPolicy::ResetStats() {
+    requests_ = 0;
+    attempts_ = 0;
+    succeeded_ = 0;
+    budget_exhausted_ = 0;
+    deadline_reached_ = 0;
+}
+
+BackgroundReconnector::BackgroundReconnector(ReconnectFunction reconnect, RetryWaiter* waiter)
+    : reconnect_(std::move(reconnect))
+    , waiter_(waiter)
+    , requested_(false)
+    , running_(false)
+    , stopping_(false)
+    , attempts_(0)
+    , successes_(0) {
+    if (!reconnect_) {
+        throw std::invalid_argument("Background reconnector needs a reconnect function");
+    }
+}
+
+BackgroundReconnector::~BackgroundReconnector() {
+    Stop();
+}
+
+void BackgroundReconnector::Request() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) return;
+        requested_ = true;
+        if (!thread_.joinable()) {
+            thread_ = std::thread([this]() { Run(); });
+        }
+    }
+    request_cv_.notify_one();
+}
+
+bool BackgroundReconnector::IsReconnecting() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return requested_ || running_;
+}
+
+void BackgroundReconnector::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    request_cv_.notify_one();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void BackgroundReconnector::Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        request_cv_.wait(lock, [this]() { return stopping_ || requested_; });
+        if (stopping_) {
+            requested_ = false;
+            return;
+        }
+        requested_ = false;
+        running_ = true;
+        lock.unlock();
+
+        attempts_++;
+        bool connected = reconnect_();
+        if (connected) {
+            successes_++;
+            if (waiter_) {
+                waiter_->Wake();
+            }
+        }
+
+        lock.lock();
+        running_ = false;
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
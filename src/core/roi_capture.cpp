@@ -0,0 +1,111 @@
+#include "league_auto_accept/core/roi_capture.h"
+#include <cmath>
+#include <cstring>
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr RelativeRegion RoiCapture::ACCEPT_BUTTON_REGION;
+
+namespace {
+constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+inline uint64_t RotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Mix(uint64_t lane, uint64_t word) {
+    return RotateLeft((lane ^ word) * HASH_MULTIPLIER, 31);
+}
+
+inline uint64_t LoadWord(const uint8_t* bytes) {
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return word;
+}
+}
+
+uint64_t HashFramePixels(const Frame& frame) {
+    // Four independent lanes keep the multiplies from waiting on each other
+    uint64_t lanes[4] = {
+        static_cast<uint64_t>(frame.width) << 32 | static_cast<uint32_t>(frame.height),
+        HASH_MULTIPLIER, ~HASH_MULTIPLIER, 0x5851F42D4C957F2Dull};
+    size_t row_bytes = static_cast<size_t>(frame.width) * Frame::BYTES_PER_PIXEL;
+
+    for (int y = 0; y < frame.height; ++y) {
+        const uint8_t* row = frame.Row(y);
+        size_t i = 0;
+        for (; i + 32 <= row_bytes; i += 32) {
+            lanes[0] = Mix(lanes[0], LoadWord(row + i));
+            lanes[1] = Mix(lanes[1], LoadWord(row + i + 8));
+            lanes[2] = Mix(lanes[2], LoadWord(row + i + 16));
+            lanes[3] = Mix(lanes[3], LoadWord(row + i + 24));
+        }
+        for (; i + 8 <= row_bytes; i += 8) {
+            lanes[0] = Mix(lanes[0], LoadWord(row + i));
+        }
+        for (; i < row_bytes; ++i) {
+            lanes[1] = Mix(lanes[1], row[i]);
+        }
+    }
+
+    uint64_t hash = lanes[0] ^ RotateLeft(lanes[1], 17) ^ RotateLeft(lanes[2], 29) ^ RotateLeft(lanes[3], 43);
+    // MurmurHash3 finalizer
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+RoiCapture::RoiCapture(CaptureSource& source, RelativeRegion region)
+    : source_(source)
+    , region_(region)
+    , has_previous_(false)
+    , previous_hash_(0) {
+}
+
+CaptureRect RoiCapture::ComputeRect(const CaptureRect& window) const {
+    CaptureRect rect;
+    rect.x = window.x + static_cast<int>(std::lround(window.width * region_.x));
+    rect.y = window.y + static_cast<int>(std::lround(window.height * region_.y));
+    rect.width = static_cast<int>(std::lround(window.width * region_.width));
+    rect.height = static_cast<int>(std::lround(window.height * region_.height));
+    return rect.Intersect(window).Intersect(source_.GetScreenBounds());
+}
+
+RoiCapture::Result RoiCapture::Capture(const CaptureRect& window) {
+    Result result;
+    result.rect = ComputeRect(window);
+    if (result.rect.IsEmpty() || !source_.Capture(result.rect, frame_)) {
+        stats_.failures++;
+        has_previous_ = false;
+        return result;
+    }
+
+    result.captured = true;
+    result.hash = HashFramePixels(frame_);
+    result.changed = !has_previous_ || result.hash != previous_hash_ || result.rect != previous_rect_;
+
+    stats_.captures++;
+    if (!result.changed) {
+        stats_.unchanged++;
+    }
+    has_previous_ = true;
+    previous_hash_ = result.hash;
+    previous_rect_ = result.rect;
+    return result;
+}
+
+void RoiCapture::Invalidate() {
+    has_previous_ = false;
+}
+
+void RoiCapture::SetRegion(RelativeRegion region) {
+    region_ = region;
+    has_previous_ = false;
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,32 @@
+#include "league_auto_accept/core/screen_capture.h"
+#include <algorithm>
+
+namespace league_auto_accept {
+namespace core {
+
+CaptureRect CaptureRect::Intersect(const CaptureRect& other) const {
+    int left = std::max(x, other.x);
+    int top = std::max(y, other.y);
+    int right = std::min(x + width, other.x + other.width);
+    int bottom = std::min(y + height, other.y + other.height);
+
+    CaptureRect overlap;
+    if (right > left && bottom > top) {
+        overlap.x = left;
+        overlap.y = top;
+        overlap.width = right - left;
+        overlap.height = bottom - top;
+    }
+    return overlap;
+}
+
+void Frame::Resize(int new_width, int new_height) {
+    width = std::max(new_width, 0);
+    height = std::max(new_height, 0);
+    stride = (static_cast<size_t>(width) * BYTES_PER_PIXEL + 3) & ~static_cast<size_t>(3);
+    // resize() never gives capacity back
+    pixels.resize(stride * static_cast<size_t>(height));
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,435 @@
+#include "league_auto_accept/core/template_matcher.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr double PyramidTemplateMatcher::COARSE_MARGIN;
+constexpr int PyramidTemplateMatcher::MIN_COARSE_TEMPLATE_SIZE;
+constexpr int PyramidTemplateMatcher::SCALE_REFINE_RADIUS;
+
+namespace {
+bool BuildScaled(const GrayImage& source, double scale, GrayImage& scaled, TemplateLevel& level) {
+    int width = static_cast<int>(std::lround(source.width * scale));
+    int height = static_cast<int>(std::lround(source.height * scale));
+    if (width < 2 || height < 2) {
+        return false;
+    }
+    ResizeGray(source, width, height, scaled);
+    return level.Build(scaled);
+}
+
+// Eight independent sums the compiler can keep in one vector register
+float Dot(const float* a, const float* b, int count) {
+    float lanes[8] = {};
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        for (int k = 0; k < 8; ++k) {
+            lanes[k] += a[i + k] * b[i + k];
+        }
+    }
+    float total = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+    for (; i < count; ++i) {
+        total += a[i] * b[i];
+    }
+    return total;
+}
+
+// Dot() plus the sum and the sum of squares of `b`, for windows without
+// precomputed sums
+void DotAndSums(const float* a, const float* b, int count, float& dot, float& sum, float& square_sum) {
+    float dot_lanes[8] = {};
+    float sum_lanes[8] = {};
+    float square_lanes[8] = {};
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        for (int k = 0; k < 8; ++k) {
+            dot_lanes[k] += a[i + k] * b[i + k];
+            sum_lanes[k] += b[i + k];
+            square_lanes[k] += b[i + k] * b[i + k];
+        }
+    }
+    dot = 0.0f;
+    sum = 0.0f;
+    square_sum = 0.0f;
+    for (int k = 0; k < 8; ++k) {
+        dot += dot_lanes[k];
+        sum += sum_lanes[k];
+        square_sum += square_lanes[k];
+    }
+    for (; i < count; ++i) {
+        dot += a[i] * b[i];
+        sum += b[i];
+        square_sum += b[i] * b[i];
+    }
+}
+
+size_t ScaleCount(const PyramidMatchSettings& settings) {
+    return static_cast<size_t>(std::floor((settings.max_scale - settings.min_scale) / settings.scale_step + 1e-6)) + 1;
+}
+
+void ValidateSettings(const PyramidMatchSettings& settings) {
+    if (settings.min_scale <= 0.0 || settings.max_scale < settings.min_scale || settings.scale_step <= 0.0) {
+        throw std::invalid_argument("Template scales must be positive and min_scale <= max_scale");
+    }
+    if (settings.threshold <= 0.0 || settings.threshold > 1.0) {
+        throw std::invalid_argument("Match threshold must be in (0, 1]");
+    }
+    if (settings.candidates == 0 || settings.max_pyramid_levels < 0 || settings.scale_subdivisions < 1) {
+        throw std::invalid_argument("Matcher needs at least one candidate, scale subdivision and no negative "
+                                    "pyramid levels");
+    }
+}
+}
+
+void GrayImage::Resize(int new_width, int new_height) {
+    width = std::max(new_width, 0);
+    height = std::max(new_height, 0);
+    pixels.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+    sums.clear();
+    square_sums.clear();
+}
+
+void GrayImage::ComputeSums() {
+    size_t stride = static_cast<size_t>(width) + 1;
+    sums.assign(stride * (static_cast<size_t>(height) + 1), 0.0);
+    square_sums.assign(sums.size(), 0.0);
+
+    for (int y = 0; y < height; ++y) {
+        const float* row = Row(y);
+        double row_sum = 0.0;
+        double row_square_sum = 0.0;
+        size_t above = static_cast<size_t>(y) * stride;
+        size_t current = above + stride;
+        for (int x = 0; x < width; ++x) {
+            row_sum += row[x];
+            row_square_sum += static_cast<double>(row[x]) * row[x];
+            sums[current + x + 1] = sums[above + x + 1] + row_sum;
+            square_sums[current + x + 1] = square_sums[above + x + 1] + row_square_sum;
+        }
+    }
+}
+
+void ConvertToGray(const Frame& frame, GrayImage& gray) {
+    gray.Resize(frame.width, frame.height);
+    for (int y = 0; y < frame.height; ++y) {
+        const uint8_t* pixel = frame.Row(y);
+        float* row = gray.Row(y);
+        for (int x = 0; x < frame.width; ++x, pixel += Frame::BYTES_PER_PIXEL) {
+            row[x] = 0.114f * pixel[0] + 0.587f * pixel[1] + 0.299f * pixel[2];
+        }
+    }
+}
+
+void DownsampleGray(const GrayImage& source, GrayImage& half) {
+    half.Resize(source.width / 2, source.height / 2);
+    for (int y = 0; y < half.height; ++y) {
+        const float* top = source.Row(2 * y);
+        const float* bottom = source.Row(2 * y + 1);
+        float* row = half.Row(y);
+        for (int x = 0; x < half.width; ++x) {
+            row[x] = 0.25f * (top[2 * x] + top[2 * x + 1] + bottom[2 * x] + bottom[2 * x + 1]);
+        }
+    }
+}
+
+void ResizeGray(const GrayImage& source, int width, int height, GrayImage& resized) {
+    resized.Resize(width, height);
+    if (source.width == 0 || source.height == 0) {
+        std::fill(resized.pixels.begin(), resized.pixels.end(), 0.0f);
+        return;
+    }
+
+    double x_ratio = static_cast<double>(source.width) / width;
+    double y_ratio = static_cast<double>(source.height) / height;
+    for (int y = 0; y < height; ++y) {
+        double source_y = std::clamp((y + 0.5) * y_ratio - 0.5, 0.0, source.height - 1.0);
+        int y0 = static_cast<int>(source_y);
+        int y1 = std::min(y0 + 1, source.height - 1);
+        float fy = static_cast<float>(source_y - y0);
+        const float* top = source.Row(y0);
+        const float* bottom = source.Row(y1);
+        float* row = resized.Row(y);
+
+        for (int x = 0; x < width; ++x) {
+            double source_x = std::clamp((x + 0.5) * x_ratio - 0.5, 0.0, source.width - 1.0);
+            int x0 = static_cast<int>(source_x);
+            int x1 = std::min(x0 + 1, source.width - 1);
+            float fx = static_cast<float>(source_x - x0);
+            float upper = top[x0] + (top[x1] - top[x0]) * fx;
+            float lower = bottom[x0] + (bottom[x1] - bottom[x0]) * fx;
+            row[x] = upper + (lower - upper) * fy;
+        }
+    }
+}
+
+bool TemplateLevel::Build(const GrayImage& image) {
+    width = image.width;
+    height = image.height;
+    centered.assign(image.pixels.begin(), image.pixels.end());
+    norm = 0.0;
+    if (centered.empty()) {
+        return false;
+    }
+
+    double sum = 0.0;
+    for (float value : centered) {
+        sum += value;
+    }
+    float mean = static_cast<float>(sum / static_cast<double>(centered.size()));
+    double square_sum = 0.0;
+    for (float& value : centered) {
+        value -= mean;
+        square_sum += static_cast<double>(value) * value;
+    }
+    norm = std::sqrt(square_sum);
+    return norm > 1e-3;
+}
+
+double CorrelationAt(const GrayImage& image, const TemplateLevel& templ, int x, int y) {
+    // The template is zero-mean, so correlating it with the raw window
+    // equals correlating it with the window minus its mean
+    double cross = 0.0;
+    double sum = 0.0;
+    double square_sum = 0.0;
+
+    if (image.HasSums()) {
+        for (int j = 0; j < templ.height; ++j) {
+            cross += Dot(templ.centered.data() + static_cast<size_t>(j) * templ.width, image.Row(y + j) + x,
+                         templ.width);
+        }
+        size_t stride = static_cast<size_t>(image.width) + 1;
+        size_t top = static_cast<size_t>(y) * stride + x;
+        size_t bottom = static_cast<size_t>(y + templ.height) * stride + x;
+        sum = image.sums[bottom + templ.width] - image.sums[top + templ.width] - image.sums[bottom] + image.sums[top];
+        square_sum = image.square_sums[bottom + templ.width] - image.square_sums[top + templ.width] -
+                     image.square_sums[bottom] + image.square_sums[top];
+    } else {
+        for (int j = 0; j < templ.height; ++j) {
+            const float* t = templ.centered.data() + static_cast<size_t>(j) * templ.width;
+            const float* row = image.Row(y + j) + x;
+            float row_cross;
+            float row_sum;
+            float row_square_sum;
+            DotAndSums(t, row, templ.width, row_cross, row_sum, row_square_sum);
+            cross += row_cross;
+            sum += row_sum;
+            square_sum += row_square_sum;
+        }
+    }
+
+    double count = static_cast<double>(templ.width) * templ.height;
+    double variance = square_sum - sum * sum / count;
+    if (variance <= 1e-6 * count || templ.norm <= 0.0) {
+        return 0.0;
+    }
+    return cross / (templ.norm * std::sqrt(variance));
+}
+
+PyramidTemplateMatcher::PyramidTemplateMatcher(const PyramidMatchSettings& settings)
+    : settings_(settings)
+    , scale_factor_(1.0)
+    , templates_valid_(false)
+    , pyramid_levels_(0) {
+    ValidateSettings(settings_);
+}
+
+bool PyramidTemplateMatcher::SetTemplate(const Frame& template_image) {
+    GrayImage gray;
+    ConvertToGray(template_image, gray);
+    TemplateLevel check;
+    if (!check.Build(gray)) {
+        return false;
+    }
+
+    template_ = std::move(gray);
+    templates_valid_ = false;
+    return true;
+}
+
+void PyramidTemplateMatcher::SetScaleFactor(double factor) {
+    if (factor > 0.0 && factor != scale_factor_) {
+        scale_factor_ = factor;
+        templates_valid_ = false;
+    }
+}
+
+void PyramidTemplateMatcher::SetSettings(const PyramidMatchSettings& settings) {
+    ValidateSettings(settings);
+    bool scales_changed = settings.min_scale != settings_.min_scale || settings.max_scale != settings_.max_scale ||
+                          settings.scale_step != settings_.scale_step ||
+                          settings.max_pyramid_levels != settings_.max_pyramid_levels ||
+                          settings.scale_subdivisions != settings_.scale_subdivisions;
+    settings_ = settings;
+    if (scales_changed) {
+        templates_valid_ = false;
+    }
+}
+
+void PyramidTemplateMatcher::EnsureTemplates() {
+    if (templates_valid_) {
+        return;
+    }
+    templates_valid_ = true;
+    templates_.clear();
+    stats_.template_builds++;
+
+    // Scale the template once per scale; the coarse copies follow once the
+    // smallest scaled template decides how far the pyramid can go
+    std::vector<GrayImage> scaled;
+    int smallest_side = 0;
+    size_t count = ScaleCount(settings_);
+    double fine_step = settings_.scale_step / settings_.scale_subdivisions;
+    int fine_range = settings_.scale_subdivisions / 2;
+    for (size_t i = 0; i < count; ++i) {
+        double relative = settings_.min_scale + static_cast<double>(i) * settings_.scale_step;
+        GrayImage image;
+        ScaledTemplate entry;
+        entry.scale = relative * scale_factor_;
+        if (!BuildScaled(template_, entry.scale, image, entry.full)) {
+            continue;
+        }
+
+        for (int k = -fine_range; k <= fine_range; ++k) {
+            FineTemplate fine;
+            fine.scale = (relative + k * fine_step) * scale_factor_;
+            if (k != 0 && BuildScaled(template_, fine.scale, scratch_, fine.full)) {
+                entry.neighbours.push_back(std::move(fine));
+            }
+        }
+
+        int side = std::min(image.width, image.height);
+        smallest_side = smallest_side == 0 ? side : std::min(smallest_side, side);
+        templates_.push_back(std::move(entry));
+        scaled.push_back(std::move(image));
+    }
+
+    pyramid_levels_ = settings_.max_pyramid_levels;
+    while (pyramid_levels_ > 0 && (smallest_side >> pyramid_levels_) < MIN_COARSE_TEMPLATE_SIZE) {
+        pyramid_levels_--;
+    }
+
+    for (size_t i = 0; i < templates_.size(); ++i) {
+        for (int level = 0; level < pyramid_levels_; ++level) {
+            DownsampleGray(scaled[i], scratch_);
+            std::swap(scaled[i], scratch_);
+        }
+        templates_[i].coarse.Build(scaled[i]);
+    }
+}
+
+PyramidTemplateMatcher::Match PyramidTemplateMatcher::Find(const Frame& image) {
+    Match best;
+    stats_.searches++;
+    if (!HasTemplate()) {
+        return best;
+    }
+    EnsureTemplates();
+
+    pyramid_.resize(static_cast<size_t>(pyramid_levels_) + 1);
+    ConvertToGray(image, pyramid_[0]);
+    for (int level = 1; level <= pyramid_levels_; ++level) {
+        DownsampleGray(pyramid_[level - 1], pyramid_[level]);
+    }
+    GrayImage& coarse = pyramid_[pyramid_levels_];
+    coarse.ComputeSums();
+
+    // Every scale, every position, at the coarsest level
+    candidates_.clear();
+    for (size_t i = 0; i < templates_.size(); ++i) {
+        const TemplateLevel& templ = templates_[i].coarse;
+        for (int y = 0; y + templ.height <= coarse.height; ++y) {
+            for (int x = 0; x + templ.width <= coarse.width; ++x) {
+                OfferCandidate({i, x, y, CorrelationAt(coarse, templ, x, y)});
+                stats_.coarse_positions++;
+            }
+        }
+    }
+
+    // Full resolution only around the candidates; a coarse pixel covers
+    // 2^levels full ones and the halved template may be off by as much
+    int radius = pyramid_levels_ > 0 ? (1 << pyramid_levels_) : 0;
+    double refine_floor = settings_.threshold - COARSE_MARGIN;
+    for (const Candidate& candidate : candidates_) {
+        if (candidate.score < refine_floor) {
+            continue;
+        }
+        const ScaledTemplate& scaled = templates_[candidate.template_index];
+        Match refined;
+        SearchAround(scaled.full, scaled.scale, candidate.x << pyramid_levels_, candidate.y << pyramid_levels_,
+                     radius, refined);
+        if (refined.confidence < refine_floor) {
+            continue;
+        }
+
+        // The scales in between, kept centred on the position found
+        int center_x = refined.x + refined.width / 2;
+        int center_y = refined.y + refined.height / 2;
+        for (const FineTemplate& fine : scaled.neighbours) {
+            SearchAround(fine.full, fine.scale, center_x - fine.full.width / 2, center_y - fine.full.height / 2,
+                         SCALE_REFINE_RADIUS, refined);
+        }
+        if (refined.confidence > best.confidence) {
+            best = refined;
+        }
+    }
+
+    best.found = best.confidence >= settings_.threshold;
+    return best;
+}
+
+void PyramidTemplateMatcher::SearchAround(const TemplateLevel& templ, double scale, int x, int y, int radius,
+                                          Match& match) {
+    const GrayImage& full = pyramid_[0];
+    int last_x = std::min(x + radius, full.width - templ.width);
+    int last_y = std::min(y + radius, full.height - templ.height);
+    for (int top = std::max(y - radius, 0); top <= last_y; ++top) {
+        for (int left = std::max(x - radius, 0); left <= last_x; ++left) {
+            double score = CorrelationAt(full, templ, left, top);
+            stats_.refined_positions++;
+            if (score > match.confidence) {
+                match.confidence = score;
+                match.x = left;
+                match.y = top;
+                match.width = templ.width;
+                match.height = templ.height;
+                match.scale = scale;
+            }
+        }
+    }
+}
+
+void PyramidTemplateMatcher::OfferCandidate(const Candidate& candidate) {
+    if (candidates_.size() >= settings_.candidates && candidate.score <= candidates_.back().score) {
+        return;
+    }
+
+    // One candidate per neighbourhood: the same button is found at several
+    // neighbouring positions and scales
+    const TemplateLevel& templ = templates_[candidate.template_index].coarse;
+    int near_x = std::max(templ.width / 2, 1);
+    int near_y = std::max(templ.height / 2, 1);
+    for (auto it = candidates_.begin(); it != candidates_.end();) {
+        if (std::abs(it->x - candidate.x) < near_x && std::abs(it->y - candidate.y) < near_y) {
+            if (it->score >= candidate.score) {
+                return;
+            }
+            it = candidates_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto position = std::find_if(candidates_.begin(), candidates_.end(),
+                                 [&](const Candidate& kept) { return kept.score < candidate.score; });
+    candidates_.insert(position, candidate);
+    if (candidates_.size() > settings_.candidates) {
+        candidates_.pop_back();
+    }
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,204 @@
+#include "league_auto_accept/core/tls_connection.h"
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace league_auto_accept {
+namespace core {
+
+TlsConnection::TlsConnection()
+    : socket_fd_(-1)
+    , ssl_context_(nullptr)
+    , ssl_(nullptr) {
+}
+
+TlsConnection::~TlsConnection() {
+    Close();
+    if (ssl_context_) {
+        SSL_CTX_free(ssl_context_);
+    }
+}
+
+bool TlsConnection::EnsureContext() {
+    if (ssl_context_) return true;
+
+    ssl_context_ = SSL_CTX_new(TLS_client_method());
+    if (!ssl_context_) {
+        SetError("Failed to create TLS context");
+        return false;
+    }
+
+    // LCU uses a self-signed certificate
+    SSL_CTX_set_verify(ssl_context_, SSL_VERIFY_NONE, nullptr);
+    return true;
+}
+
+bool TlsConnection::Connect(const std::string& host, int port, std::chrono::milliseconds timeout) {
+    Close();
+    if (!EnsureContext()) return false;
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(static_cast<uint16_t>(port));
+    if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+        SetError("Invalid host address: " + host);
+        return false;
+    }
+
+    socket_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_fd_ < 0) {
+        SetError("Failed to create socket: " + std::string(std::strerror(errno)));
+        return false;
+    }
+
+    // Non-blocking connect so the timeout also covers a dead port
+    int flags = fcntl(socket_fd_, F_GETFL, 0);
+    fcntl(socket_fd_, F_SETFL, flags | O_NONBLOCK);
+
+    int result = ::connect(socket_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    if (result < 0 && errno != EINPROGRESS) {
+        SetError("Failed to connect to " + host + ":" + std::to_string(port));
+        Close();
+        return false;
+    }
+
+    if (result < 0) {
+        pollfd pfd{socket_fd_, POLLOUT, 0};
+        int socket_error = 0;
+        socklen_t length = sizeof(socket_error);
+        if (::poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0 ||
+            getsockopt(socket_fd_, SOL_SOCKET, SO_ERROR, &socket_error, &length) < 0 ||
+            socket_error != 0) {
+            SetError("Failed to connect to " + host + ":" + std::to_string(port));
+            Close();
+            return false;
+        }
+    }
+
+    fcntl(socket_fd_, F_SETFL, flags & ~O_NONBLOCK);
+
+    int no_delay = 1;
+    setsockopt(socket_fd_, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+    timeval tv{};
+    tv.tv_sec = static_cast<long>(timeout.count() / 1000);
+    tv.tv_usec = static_cast<long>((timeout.count() % 1000) * 1000);
+    setsockopt(socket_fd_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    setsockopt(socket_fd_, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+    ssl_ = SSL_new(ssl_context_);
+    if (!ssl_ || SSL_set_fd(ssl_, socket_fd_) != 1) {
+        SetError("Failed to create TLS session");
+        Close();
+        return false;
+    }
+
+    if (SSL_connect(ssl_) != 1) {
+        unsigned long error = ERR_get_error();
+        char buffer[256];
+        ERR_error_string_n(error, buffer, sizeof(buffer));
+        SetError("TLS handshake failed: " + std::string(buffer));
+        Close();
+        return false;
+    }
+
+    last_error_.clear();
+    return true;
+}
+
+void TlsConnection::Close() {
+    if (ssl_) {
+        SSL_free(ssl_);
+        ssl_ = nullptr;
+    }
+    if (socket_fd_ >= 0) {
+        ::close(socket_fd_);
+        socket_fd_ = -1;
+    }
+}
+
+bool TlsConnection::IsOpen() const {
+    return ssl_ != nullptr;
+}
+
+bool TlsConnection::WriteAll(const char* data, size_t size) {
+    if (!ssl_) {
+        SetError("Connection is not open");
+        return false;
+    }
+
+    while (size > 0) {
+        int written = SSL_write(ssl_, data, static_cast<int>(size));
+        if (written <= 0) {
+            SetError("TLS write failed");
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+int TlsConnection::Read(char* buffer, size_t size) {
+    if (!ssl_) {
+        SetError("Connection is not open");
+        return -1;
+    }
+
+    int received = SSL_read(ssl_, buffer, static_cast<int>(size));
+    if (received > 0) {
+        return received;
+    }
+
+    int error = SSL_get_error(ssl_, received);
+    if (error == SSL_ERROR_ZERO_RETURN) {
+        return 0;
+    }
+    if (error == SSL_ERROR_SYSCALL && received == 0) {
+        return 0; // Peer closed without close_notify
+    }
+
+    SetError(error == SSL_ERROR_WANT_READ || errno == EAGAIN ? "TLS read timed out" : "TLS read failed");
+    return -1;
+}
+
+void TlsConnection::SetReadTimeout(std::chrono::milliseconds timeout) {
+    if (socket_fd_ < 0) return;
+
+    timeval tv{};
+    tv.tv_sec = static_cast<long>(timeout.count() / 1000);
+    tv.tv_usec = static_cast<long>((timeout.count() % 1000) * 1000);
+    setsockopt(socket_fd_, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+bool TlsConnection::WaitReadable(std::chrono::milliseconds timeout) {
+    if (!ssl_) return false;
+    if (SSL_pending(ssl_) > 0) return true;
+
+    pollfd pfd{socket_fd_, POLLIN, 0};
+    return ::poll(&pfd, 1, static_cast<int>(timeout.count())) > 0 && (pfd.revents & POLLIN);
+}
+
+int TlsConnection::GetSocket() const {
+    return socket_fd_;
+}
+
+const std::string& TlsConnection::GetLastError() const {
+    return last_error_;
+}
+
+void TlsConnection::SetError(const std::string& message) {
+    last_error_ = message;
+    ERR_clear_error();
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -0,0 +1,210 @@
+#include "league_auto_accept/core/tls_socket_event_stream.h"
+#include "league_auto_accept/core/base64.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <sys/socket.h>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr const char* LCU_HOST = "127.0.0.1";
+constexpr size_t READ_CHUNK_SIZE = 16 * 1024;
+}
+
+TlsSocketEventStream::TlsSocketEventStream(std::chrono::milliseconds connect_timeout)
+    : connect_timeout_(connect_timeout)
+    , interruptible_fd_(-1) {
+}
+
+TlsSocketEventStream::~TlsSocketEventStream() {
+    Close();
+}
+
+bool TlsSocketEventStream::Connect(const LCUCredentials& credentials) {
+    Close();
+    if (!credentials.IsValid()) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Invalid LCU credentials";
+        return false;
+    }
+
+    if (!connection_.Connect(LCU_HOST, credentials.port, connect_timeout_)) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = connection_.GetLastError();
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(interrupt_mutex_);
+        interruptible_fd_ = connection_.GetSocket();
+    }
+
+    if (!PerformHandshake(credentials)) {
+        Close();
+        return false;
+    }
+
+    // Events can be minutes apart; only Interrupt() or the peer ends a read
+    connection_.SetReadTimeout(std::chrono::milliseconds(0));
+    return true;
+}
+
+void TlsSocketEventStream::Close() {
+    {
+        std::lock_guard<std::mutex> lock(interrupt_mutex_);
+        interruptible_fd_ = -1;
+    }
+    connection_.Close();
+    read_buffer_.clear();
+}
+
+bool TlsSocketEventStream::IsConnected() const {
+    return connection_.IsOpen();
+}
+
+bool TlsSocketEventStream::PerformHandshake(const LCUCredentials& credentials) {
+    std::string key = GenerateWebSocketKey();
+
+    std::string request = "GET / HTTP/1.1\r\n";
+    request += "Host: " + std::string(LCU_HOST) + ":" + std::to_string(credentials.port) + "\r\n";
+    request += "Upgrade: websocket\r\n";
+    request += "Connection: Upgrade\r\n";
+    request += "Sec-WebSocket-Key: " + key + "\r\n";
+    request += "Sec-WebSocket-Version: 13\r\n";
+    request += "Authorization: " + BuildBasicAuthValue(credentials.auth_token) + "\r\n";
+    request += "\r\n";
+
+    if (!connection_.WriteAll(request.data(), request.size())) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Failed to send WebSocket upgrade: " + connection_.GetLastError();
+        return false;
+    }
+
+    char chunk[READ_CHUNK_SIZE];
+    size_t header_end;
+    while ((header_end = FindHeaderEnd(read_buffer_)) == std::string::npos) {
+        int received = connection_.Read(chunk, sizeof(chunk));
+        if (received <= 0) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = "No WebSocket upgrade response";
+            return false;
+        }
+        read_buffer_.append(chunk, static_cast<size_t>(received));
+    }
+
+    std::string_view headers(read_buffer_.data(), header_end);
+    std::string_view accept;
+    if (ParseStatusCode(headers) != 101 ||
+        !FindHeaderValue(headers, "Sec-WebSocket-Accept", accept) ||
+        accept != ComputeWebSocketAccept(key)) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "WebSocket upgrade rejected (HTTP " + std::to_string(ParseStatusCode(headers)) + ")";
+        return false;
+    }
+
+    // Anything after the headers already belongs to the frame stream
+    read_buffer_.erase(0, header_end);
+    return true;
+}
+
+bool TlsSocketEventStream::Subscribe(const std::string& topic) {
+    return SendFrame(WebSocketOpcode::TEXT, BuildWampSubscribe(topic));
+}
+
+bool TlsSocketEventStream::SendFrame(WebSocketOpcode opcode, std::string_view payload) {
+    write_buffer_.clear();
+    EncodeWebSocketFrame(opcode, payload, true, write_buffer_);
+    if (!connection_.WriteAll(write_buffer_.data(), write_buffer_.size())) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "WebSocket write failed: " + connection_.GetLastError();
+        return false;
+    }
+    return true;
+}
+
+bool TlsSocketEventStream::ReadFrame(WebSocketFrame& frame) {
+    char chunk[READ_CHUNK_SIZE];
+    for (;;) {
+        size_t consumed = DecodeWebSocketFrame(read_buffer_, frame, MAX_MESSAGE_SIZE);
+        if (consumed == std::string::npos) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = "Malformed or oversized WebSocket frame";
+            return false;
+        }
+        if (consumed > 0) {
+            read_buffer_.erase(0, consumed);
+            return true;
+        }
+
+        int received = connection_.Read(chunk, sizeof(chunk));
+        if (received <= 0) {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = received == 0 ? "Event stream closed by the client" : connection_.GetLastError();
+            return false;
+        }
+        read_buffer_.append(chunk, static_cast<size_t>(received));
+    }
+}
+
+bool TlsSocketEventStream::ReadMessage(std::string& message) {
+    if (!connection_.IsOpen()) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Event stream is not connected";
+        return false;
+    }
+
+    message.clear();
+    bool in_message = false;
+
+    while (ReadFrame(frame_)) {
+        switch (frame_.opcode) {
+        case WebSocketOpcode::TEXT:
+        case WebSocketOpcode::BINARY:
+            message = std::move(frame_.payload);
+            in_message = !frame_.final;
+            break;
+        case WebSocketOpcode::CONTINUATION:
+            if (!in_message) break;
+            message += frame_.payload;
+            in_message = !frame_.final;
+            break;
+        case WebSocketOpcode::PING:
+            if (!SendFrame(WebSocketOpcode::PONG, frame_.payload)) return false;
+            continue;
+        case WebSocketOpcode::PONG:
+            continue;
+        case WebSocketOpcode::CLOSE: {
+            SendFrame(WebSocketOpcode::CLOSE, frame_.payload);
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            last_error_ = "Event stream closed by the client";
+            return false;
+        }
+        default:
+            continue;
+        }
+
+        if (!in_message && message.size() <= MAX_MESSAGE_SIZE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TlsSocketEventStream::Interrupt() {
+    std::lock_guard<std::mutex> lock(interrupt_mutex_);
+    if (interruptible_fd_ >= 0) {
+        ::shutdown(interruptible_fd_, SHUT_RDWR);
+    }
+}
+
+std::string TlsSocketEventStream::GetLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+std::unique_ptr<LCUEventStream> CreatePlatformEventStream(std::chrono::milliseconds connect_timeout) {
+    return std::make_unique<TlsSocketEventStream>(connect_timeout);
+}
+
+} // namespace core
+} // namespace league_auto_accept
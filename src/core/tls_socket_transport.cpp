@@ -0,0 +1,265 @@
+#include "league_auto_accept/core/tls_socket_transport.h"
+#include "league_auto_accept/core/base64.h"
+#include "league_auto_accept/core/http_wire.h"
+#include <cstring>
+
+namespace league_auto_accept {
+namespace core {
+
+constexpr size_t TlsSocketTransport::MAX_PREPARED;
+
+namespace {
+constexpr const char* LCU_HOST = "127.0.0.1";
+constexpr size_t READ_CHUNK_SIZE = 16 * 1024;
+}
+
+TlsSocketTransport::TlsSocketTransport(std::chrono::milliseconds timeout)
+    : timeout_(timeout)
+    , consumed_(0)
+    , open_(false)
+    , connection_count_(0) {
+}
+
+TlsSocketTransport::~TlsSocketTransport() {
+    Close();
+}
+
+bool TlsSocketTransport::Open(const LCUCredentials& credentials) {
+    Close();
+    if (!credentials.IsValid()) {
+        last_error_ = "Invalid LCU credentials";
+        return false;
+    }
+
+    credentials_ = credentials;
+    common_headers_ = "Host: " + std::string(LCU_HOST) + ":" + std::to_string(credentials.port) + "\r\n" +
+                      "Authorization: " + BuildBasicAuthValue(credentials.auth_token) + "\r\n" +
+                      "Accept: application/json\r\n";
+    for (size_t i = 0; i < LCU_ENDPOINT_COUNT; ++i) {
+        BuildRequest(LCU_ENDPOINTS[i].method, LCU_ENDPOINTS[i].path, {}, endpoint_requests_[i]);
+    }
+    connection_count_ = 0;
+    open_ = true;
+    return true;
+}
+
+void TlsSocketTransport::Close() {
+    connection_.Close();
+    read_buffer_.clear();
+    consumed_ = 0;
+    prepared_.clear();
+    for (std::string& request : endpoint_requests_) {
+        request.clear();
+    }
+    open_ = false;
+}
+
+bool TlsSocketTransport::IsOpen() const {
+    return open_;
+}
+
+bool TlsSocketTransport::EnsureConnected() {
+    if (connection_.IsOpen()) return true;
+
+    read_buffer_.clear();
+    consumed_ = 0;
+    if (!connection_.Connect(LCU_HOST, credentials_.port, timeout_)) {
+        last_error_ = connection_.GetLastError();
+        return false;
+    }
+    connection_count_++;
+    return true;
+}
+
+HttpResponseView TlsSocketTransport::SendView(HttpMethod method, std::string_view path, std::string_view body) {
+    auto start_time = std::chrono::steady_clock::now();
+    HttpResponseView response;
+
+    // Views of the previous body end here; the buffer keeps its capacity
+    read_buffer_.erase(0, consumed_);
+    consumed_ = 0;
+
+    if (!open_) {
+        last_error_ = "Transport is not open";
+        return response;
+    }
+
+    int endpoint = FindLCUEndpoint(method, path);
+    const std::string* request = nullptr;
+    if (body.empty()) {
+        if (endpoint >= 0) {
+            request = &endpoint_requests_[endpoint];
+        } else if (const PreparedRequest* prepared = FindPrepared(method, path)) {
+            request = &prepared->bytes;
+        }
+    }
+    if (!request) {
+        BuildRequest(method, path, body, request_buffer_);
+        request = &request_buffer_;
+    }
+
+    // A keep-alive connection may have been closed by the server while idle;
+    // in that case the request is replayed once on a fresh connection, unless
+    // the registry says it must not be sent twice.
+    bool replayable = endpoint < 0 || LCU_ENDPOINTS[endpoint].idempotent;
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        bool reused = connection_.IsOpen();
+        if (!EnsureConnected()) {
+            break;
+        }
+
+        if (connection_.WriteAll(request->data(), request->size()) && ReadResponse(response)) {
+            response.reused_connection = reused;
+            break;
+        }
+
+        last_error_ = connection_.GetLastError();
+        connection_.Close();
+        response = HttpResponseView{};
+        if (!reused || !replayable) {
+            break;
+        }
+    }
+
+    response.latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    return response;
+}
+
+int TlsSocketTransport::GetConnectionCount() const {
+    return connection_count_;
+}
+
+std::string TlsSocketTransport::GetLastError() const {
+    return last_error_;
+}
+
+void TlsSocketTransport::Prepare(HttpMethod method, std::string_view path) {
+    if (!open_ || FindLCUEndpoint(method, path) >= 0 || FindPrepared(method, path)) {
+        return;
+    }
+    if (prepared_.size() == MAX_PREPARED) {
+        prepared_.erase(prepared_.begin());
+    }
+    PreparedRequest prepared{method, std::string(path), std::string()};
+    BuildRequest(method, path, "", prepared.bytes);
+    prepared_.push_back(std::move(prepared));
+}
+
+const TlsSocketTransport::PreparedRequest* TlsSocketTransport::FindPrepared(HttpMethod method,
+                                                                            std::string_view path) const {
+    for (const PreparedRequest& prepared : prepared_) {
+        if (prepared.method == method && prepared.path == path) {
+            return &prepared;
+        }
+    }
+    return nullptr;
+}
+
+void TlsSocketTransport::BuildRequest(HttpMethod method, std::string_view path, std::string_view body,
+                                      std::string& out) const {
+    out.clear();
+    out += HttpMethodToString(method);
+    out += ' ';
+    out += path;
+    out += " HTTP/1.1\r\n";
+    out += common_headers_;
+    if (method != HttpMethod::GET) {
+        out += "Content-Type: application/json\r\n";
+        out += "Content-Length: ";
+        out += std::to_string(body.size());
+        out += "\r\n";
+    }
+    out += "\r\n";
+    out += body;
+}
+
+bool TlsSocketTransport::FillBuffer() {
+    char chunk[READ_CHUNK_SIZE];
+    int received = connection_.Read(chunk, sizeof(chunk));
+    if (received <= 0) {
+        return false;
+    }
+    read_buffer_.append(chunk, static_cast<size_t>(received));
+    return true;
+}
+
+bool TlsSocketTransport::ReadResponse(HttpResponseView& response) {
+    size_t header_end;
+    while ((header_end = FindHeaderEnd(read_buffer_)) == std::string::npos) {
+        if (!FillBuffer()) return false;
+    }
+
+    std::string_view headers(read_buffer_.data(), header_end);
+    response.status_code = ParseStatusCode(headers.substr(0, headers.find("\r\n")));
+    if (response.status_code == 0) {
+        last_error_ = "Malformed HTTP response";
+        return false;
+    }
+
+    std::string_view value;
+    bool close_after = FindHeaderValue(headers, "Connection", value) && EqualsIgnoreCase(value, "close");
+    bool chunked = FindHeaderValue(headers, "Transfer-Encoding", value) && EqualsIgnoreCase(value, "chunked");
+
+    size_t content_length = 0;
+    bool has_length = FindHeaderValue(headers, "Content-Length", value) && ParseUnsigned(value, content_length);
+
+    // The body is read_buffer_[header_end, body_end); the view is taken once
+    // reading is done, as filling the buffer may move it
+    size_t body_end = header_end;
+    if (response.status_code == 204 || response.status_code == 304) {
+        consumed_ = header_end;
+    } else if (has_length) {
+        while (read_buffer_.size() < header_end + content_length) {
+            if (!FillBuffer()) return false;
+        }
+        body_end = header_end + content_length;
+        consumed_ = body_end;
+    } else if (chunked) {
+        // Each chunk's data is moved down over the size lines before it
+        size_t pos = header_end;
+        for (;;) {
+            size_t line_end;
+            while ((line_end = read_buffer_.find("\r\n", pos)) == std::string::npos) {
+                if (!FillBuffer()) return false;
+            }
+
+            size_t chunk_size = 0;
+            if (!ParseUnsigned(std::string_view(read_buffer_).substr(pos, line_end - pos), chunk_size, 16)) {
+                last_error_ = "Malformed chunked response";
+                return false;
+            }
+
+            size_t chunk_start = line_end + 2;
+            while (read_buffer_.size() < chunk_start + chunk_size + 2) {
+                if (!FillBuffer()) return false;
+            }
+            std::memmove(&read_buffer_[body_end], read_buffer_.data() + chunk_start, chunk_size);
+            body_end += chunk_size;
+            pos = chunk_start + chunk_size + 2;
+
+            if (chunk_size == 0) break;
+        }
+        consumed_ = pos;
+    } else {
+        // Body delimited by connection close
+        while (FillBuffer()) {
+        }
+        body_end = read_buffer_.size();
+        consumed_ = body_end;
+        close_after = true;
+    }
+    response.body = std::string_view(read_buffer_).substr(header_end, body_end - header_end);
+
+    if (close_after) {
+        connection_.Close();
+    }
+    return true;
+}
+
+std::unique_ptr<LCUTransport> CreatePlatformTransport(std::chrono::milliseconds timeout) {
+    return std::make_unique<TlsSocketTransport>(timeout);
+}
+
+} // namespace core
+} // namespace league_auto_accept
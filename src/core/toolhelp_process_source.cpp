@@ -0,0 +1,93 @@
+#include "league_auto_accept/core/toolhelp_process_source.h"
+#include <algorithm>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+std::string NarrowString(const WCHAR* text) {
+    int length = WideCharToMultiByte(CP_ACP, 0, text, -1, nullptr, 0, nullptr, nullptr);
+    if (length <= 1) return "";
+    std::string narrow(static_cast<size_t>(length - 1), '\0');
+    WideCharToMultiByte(CP_ACP, 0, text, -1, &narrow[0], length, nullptr, nullptr);
+    return narrow;
+}
+}
+
+bool ToolhelpProcessSource::ListProcessIds(std::vector<uint32_t>& process_ids) {
+    process_ids.clear();
+    snapshot_.clear();
+
+    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
+    if (snapshot == INVALID_HANDLE_VALUE) {
+        last_error_ = "CreateToolhelp32Snapshot failed: " + std::to_string(::GetLastError());
+        return false;
+    }
+
+    PROCESSENTRY32W pe32;
+    pe32.dwSize = sizeof(PROCESSENTRY32W);
+
+    // Entries are kept as they come; names are only converted when asked for
+    if (Process32FirstW(snapshot, &pe32)) {
+        do {
+            process_ids.push_back(static_cast<uint32_t>(pe32.th32ProcessID));
+            snapshot_.push_back(pe32);
+        } while (Process32NextW(snapshot, &pe32));
+    }
+
+    CloseHandle(snapshot);
+
+    std::sort(snapshot_.begin(), snapshot_.end(), [](const PROCESSENTRY32W& a, const PROCESSENTRY32W& b) {
+        return a.th32ProcessID < b.th32ProcessID;
+    });
+    return true;
+}
+
+bool ToolhelpProcessSource::GetProcessName(uint32_t process_id, std::string& name) {
+    auto entry = std::lower_bound(snapshot_.begin(), snapshot_.end(), process_id,
+                                  [](const PROCESSENTRY32W& pe32, uint32_t id) { return pe32.th32ProcessID < id; });
+    if (entry != snapshot_.end() && entry->th32ProcessID == process_id) {
+        name = NarrowString(entry->szExeFile);
+        return true;
+    }
+
+    // Not in the last snapshot: take the file name of the image path
+    std::string path;
+    if (!GetExecutablePath(process_id, path)) {
+        return false;
+    }
+    size_t separator = path.find_last_of("\\/");
+    name = separator == std::string::npos ? path : path.substr(separator + 1);
+    return true;
+}
+
+bool ToolhelpProcessSource::GetExecutablePath(uint32_t process_id, std::string& path) {
+    HANDLE process = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, process_id);
+    if (process == nullptr) {
+        last_error_ = "OpenProcess failed: " + std::to_string(::GetLastError());
+        return false;
+    }
+
+    char buffer[MAX_PATH];
+    DWORD length = MAX_PATH;
+    bool success = QueryFullProcessImageNameA(process, 0, buffer, &length) != FALSE;
+    CloseHandle(process);
+
+    if (!success) {
+        last_error_ = "QueryFullProcessImageName failed: " + std::to_string(::GetLastError());
+        return false;
+    }
+    path.assign(buffer, length);
+    return true;
+}
+
+std::string ToolhelpProcessSource::GetLastError() const {
+    return last_error_;
+}
+
+std::unique_ptr<ProcessSource> CreatePlatformProcessSource() {
+    return std::make_unique<ToolhelpProcessSource>();
+}
+
+} // namespace core
+} // namespace league_auto_accept
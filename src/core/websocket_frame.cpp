@@ -0,0 +1,114 @@
+#include "league_auto_accept/core/websocket_frame.h"
+#include "league_auto_accept/core/base64.h"
+#include <openssl/rand.h>
+#include <openssl/sha.h>
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr uint8_t FIN_BIT = 0x80;
+constexpr uint8_t MASK_BIT = 0x80;
+constexpr uint8_t OPCODE_MASK = 0x0F;
+constexpr uint8_t LENGTH_MASK = 0x7F;
+constexpr uint8_t LENGTH_16 = 126;
+constexpr uint8_t LENGTH_64 = 127;
+}
+
+void EncodeWebSocketFrame(WebSocketOpcode opcode, std::string_view payload, bool mask, std::string& out) {
+    out.push_back(static_cast<char>(FIN_BIT | static_cast<uint8_t>(opcode)));
+
+    uint8_t mask_flag = mask ? MASK_BIT : 0;
+    uint64_t length = payload.size();
+    if (length < LENGTH_16) {
+        out.push_back(static_cast<char>(mask_flag | length));
+    } else if (length <= 0xFFFF) {
+        out.push_back(static_cast<char>(mask_flag | LENGTH_16));
+        out.push_back(static_cast<char>((length >> 8) & 0xFF));
+        out.push_back(static_cast<char>(length & 0xFF));
+    } else {
+        out.push_back(static_cast<char>(mask_flag | LENGTH_64));
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            out.push_back(static_cast<char>((length >> shift) & 0xFF));
+        }
+    }
+
+    if (!mask) {
+        out.append(payload.data(), payload.size());
+        return;
+    }
+
+    unsigned char key[4];
+    RAND_bytes(key, sizeof(key));
+    out.append(reinterpret_cast<const char*>(key), sizeof(key));
+
+    size_t offset = out.size();
+    out.append(payload.data(), payload.size());
+    for (size_t i = 0; i < payload.size(); ++i) {
+        out[offset + i] = static_cast<char>(out[offset + i] ^ key[i % 4]);
+    }
+}
+
+size_t DecodeWebSocketFrame(std::string_view buffer, WebSocketFrame& frame, size_t max_payload) {
+    if (buffer.size() < 2) return 0;
+
+    const auto* bytes = reinterpret_cast<const uint8_t*>(buffer.data());
+    frame.final = (bytes[0] & FIN_BIT) != 0;
+    frame.opcode = static_cast<WebSocketOpcode>(bytes[0] & OPCODE_MASK);
+
+    bool masked = (bytes[1] & MASK_BIT) != 0;
+    uint64_t length = bytes[1] & LENGTH_MASK;
+    size_t offset = 2;
+
+    if (length == LENGTH_16) {
+        if (buffer.size() < offset + 2) return 0;
+        length = (static_cast<uint64_t>(bytes[2]) << 8) | bytes[3];
+        offset += 2;
+    } else if (length == LENGTH_64) {
+        if (buffer.size() < offset + 8) return 0;
+        length = 0;
+        for (int i = 0; i < 8; ++i) {
+            length = (length << 8) | bytes[offset + i];
+        }
+        offset += 8;
+    }
+
+    if (length > max_payload) {
+        return std::string::npos;
+    }
+
+    const uint8_t* key = nullptr;
+    if (masked) {
+        if (buffer.size() < offset + 4) return 0;
+        key = bytes + offset;
+        offset += 4;
+    }
+
+    if (buffer.size() < offset + length) return 0;
+
+    frame.payload.assign(buffer.data() + offset, static_cast<size_t>(length));
+    if (key) {
+        for (size_t i = 0; i < frame.payload.size(); ++i) {
+            frame.payload[i] = static_cast<char>(frame.payload[i] ^ key[i % 4]);
+        }
+    }
+    return offset + static_cast<size_t>(length);
+}
+
+std::string GenerateWebSocketKey() {
+    unsigned char nonce[16];
+    RAND_bytes(nonce, sizeof(nonce));
+    return Base64Encode(std::string_view(reinterpret_cast<const char*>(nonce), sizeof(nonce)));
+}
+
+std::string ComputeWebSocketAccept(std::string_view key) {
+    std::string input(key);
+    input += WEBSOCKET_GUID;
+
+    unsigned char digest[SHA_DIGEST_LENGTH];
+    SHA1(reinterpret_cast<const unsigned char*>(input.data()), input.size(), digest);
+    return Base64Encode(std::string_view(reinterpret_cast<const char*>(digest), sizeof(digest)));
+}
+
+} // namespace core
+} // namespace league_auto_accept
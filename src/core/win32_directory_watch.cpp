@@ -0,0 +1,196 @@
+#include "league_auto_accept/core/win32_directory_watch.h"
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr DWORD NOTIFY_FILTER = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE |
+                                FILE_NOTIFY_CHANGE_SIZE;
+
+std::string NarrowFileName(const WCHAR* name, DWORD length_bytes) {
+    int wide_length = static_cast<int>(length_bytes / sizeof(WCHAR));
+    int length = WideCharToMultiByte(CP_ACP, 0, name, wide_length, nullptr, 0, nullptr, nullptr);
+    std::string narrow(length > 0 ? length : 0, '\0');
+    if (length > 0) {
+        WideCharToMultiByte(CP_ACP, 0, name, wide_length, &narrow[0], length, nullptr, nullptr);
+    }
+    return narrow;
+}
+}
+
+Win32DirectoryWatch::Win32DirectoryWatch()
+    : interrupt_event_(CreateEventA(nullptr, FALSE, FALSE, nullptr)) {
+    if (interrupt_event_ == nullptr) {
+        SetError("CreateEvent failed: " + std::to_string(::GetLastError()));
+    }
+}
+
+Win32DirectoryWatch::~Win32DirectoryWatch() {
+    for (auto& directory : directories_) {
+        CloseDirectory(*directory);
+    }
+    if (interrupt_event_ != nullptr) {
+        CloseHandle(interrupt_event_);
+    }
+}
+
+bool Win32DirectoryWatch::AddDirectory(const std::string& directory) {
+    if (IsWatching(directory)) {
+        return true;
+    }
+    // One slot is the interrupt event
+    if (directories_.size() + 1 >= MAXIMUM_WAIT_OBJECTS) {
+        SetError("Too many watched directories");
+        return false;
+    }
+
+    auto watched = std::make_unique<WatchedDirectory>();
+    watched->path = directory;
+    watched->handle = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+    if (watched->handle == INVALID_HANDLE_VALUE) {
+        SetError("Cannot watch " + directory + ": error " + std::to_string(::GetLastError()));
+        return false;
+    }
+
+    watched->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    watched->buffer.resize(NOTIFY_BUFFER_SIZE / sizeof(DWORD));
+    if (watched->overlapped.hEvent == nullptr || !IssueRead(*watched)) {
+        CloseDirectory(*watched);
+        return false;
+    }
+
+    directories_.push_back(std::move(watched));
+    return true;
+}
+
+bool Win32DirectoryWatch::IsWatching(const std::string& directory) const {
+    for (const auto& watched : directories_) {
+        if (watched->path == directory) return true;
+    }
+    return false;
+}
+
+bool Win32DirectoryWatch::IssueRead(WatchedDirectory& directory) {
+    ResetEvent(directory.overlapped.hEvent);
+    if (!ReadDirectoryChangesW(directory.handle, directory.buffer.data(),
+                               static_cast<DWORD>(directory.buffer.size() * sizeof(DWORD)),
+                               FALSE, NOTIFY_FILTER, nullptr, &directory.overlapped, nullptr)) {
+        SetError("ReadDirectoryChangesW failed for " + directory.path + ": error " +
+                 std::to_string(::GetLastError()));
+        return false;
+    }
+    return true;
+}
+
+bool Win32DirectoryWatch::WaitForChanges(std::vector<std::string>& changed_paths,
+                                         std::chrono::milliseconds timeout) {
+    if (interrupt_event_ == nullptr) {
+        return false;
+    }
+
+    std::vector<HANDLE> handles;
+    handles.reserve(directories_.size() + 1);
+    handles.push_back(interrupt_event_);
+    for (const auto& watched : directories_) {
+        handles.push_back(watched->overlapped.hEvent);
+    }
+
+    DWORD result = WaitForMultipleObjects(static_cast<DWORD>(handles.size()), handles.data(),
+                                          FALSE, static_cast<DWORD>(timeout.count()));
+    if (result == WAIT_TIMEOUT || result == WAIT_OBJECT_0) {
+        return false; // Timeout or Interrupt(); the auto-reset event is consumed
+    }
+    if (result == WAIT_FAILED || result >= WAIT_OBJECT_0 + handles.size()) {
+        SetError("WaitForMultipleObjects failed: " + std::to_string(::GetLastError()));
+        return false;
+    }
+
+    size_t previous_size = changed_paths.size();
+
+    // Collect every directory that completed, not just the first one signaled
+    for (size_t i = 0; i < directories_.size();) {
+        WatchedDirectory& watched = *directories_[i];
+        DWORD bytes = 0;
+        if (!GetOverlappedResult(watched.handle, &watched.overlapped, &bytes, FALSE)) {
+            if (::GetLastError() == ERROR_IO_INCOMPLETE) {
+                ++i;
+                continue;
+            }
+            // The directory was deleted or became inaccessible
+            changed_paths.push_back(watched.path);
+            CloseDirectory(watched);
+            directories_.erase(directories_.begin() + i);
+            continue;
+        }
+
+        CollectChanges(watched, bytes, changed_paths);
+        if (!IssueRead(watched)) {
+            changed_paths.push_back(watched.path);
+            CloseDirectory(watched);
+            directories_.erase(directories_.begin() + i);
+            continue;
+        }
+        ++i;
+    }
+
+    return changed_paths.size() > previous_size;
+}
+
+void Win32DirectoryWatch::CollectChanges(WatchedDirectory& directory, DWORD bytes,
+                                         std::vector<std::string>& changed_paths) {
+    if (bytes == 0) {
+        // The buffer overflowed and the names are lost
+        changed_paths.push_back(directory.path);
+        return;
+    }
+
+    const char* records = reinterpret_cast<const char*>(directory.buffer.data());
+    DWORD offset = 0;
+    while (true) {
+        const auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(records + offset);
+        changed_paths.push_back(directory.path + "\\" + NarrowFileName(info->FileName, info->FileNameLength));
+        if (info->NextEntryOffset == 0) break;
+        offset += info->NextEntryOffset;
+    }
+}
+
+void Win32DirectoryWatch::CloseDirectory(WatchedDirectory& directory) {
+    if (directory.handle != INVALID_HANDLE_VALUE) {
+        // The pending read owns the buffer until it completes
+        if (CancelIoEx(directory.handle, &directory.overlapped)) {
+            DWORD bytes = 0;
+            GetOverlappedResult(directory.handle, &directory.overlapped, &bytes, TRUE);
+        }
+        CloseHandle(directory.handle);
+        directory.handle = INVALID_HANDLE_VALUE;
+    }
+    if (directory.overlapped.hEvent != nullptr) {
+        CloseHandle(directory.overlapped.hEvent);
+        directory.overlapped.hEvent = nullptr;
+    }
+}
+
+void Win32DirectoryWatch::Interrupt() {
+    if (interrupt_event_ != nullptr) {
+        SetEvent(interrupt_event_);
+    }
+}
+
+std::string Win32DirectoryWatch::GetLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+void Win32DirectoryWatch::SetError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = message;
+}
+
+std::unique_ptr<DirectoryWatch> CreatePlatformDirectoryWatch() {
+    return std::make_unique<Win32DirectoryWatch>();
+}
+
+} // namespace core
+} // namespace league_auto_accept
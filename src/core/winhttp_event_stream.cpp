@@ -0,0 +1,201 @@
+#include "league_auto_accept/core/winhttp_event_stream.h"
+#include "league_auto_accept/core/base64.h"
+
+#pragma comment(lib, "winhttp.lib")
+
+namespace league_auto_accept {
+namespace core {
+
+namespace {
+constexpr DWORD RECEIVE_CHUNK_SIZE = 16 * 1024;
+}
+
+WinHttpEventStream::WinHttpEventStream(std::chrono::milliseconds connect_timeout)
+    : connect_timeout_(connect_timeout)
+    , session_(nullptr)
+    , connect_(nullptr)
+    , websocket_(nullptr)
+    , receive_buffer_(RECEIVE_CHUNK_SIZE) {
+}
+
+WinHttpEventStream::~WinHttpEventStream() {
+    Close();
+}
+
+bool WinHttpEventStream::Connect(const LCUCredentials& credentials) {
+    Close();
+    if (!credentials.IsValid()) {
+        SetError("Invalid LCU credentials");
+        return false;
+    }
+
+    session_ = WinHttpOpen(L"LeagueAutoAccept/1.0",
+                           WINHTTP_ACCESS_TYPE_NO_PROXY,
+                           WINHTTP_NO_PROXY_NAME,
+                           WINHTTP_NO_PROXY_BYPASS, 0);
+    if (!session_) {
+        SetError("Failed to create HTTP session");
+        return false;
+    }
+
+    int timeout_ms = static_cast<int>(connect_timeout_.count());
+    WinHttpSetTimeouts(session_, timeout_ms, timeout_ms, timeout_ms, timeout_ms);
+
+    connect_ = WinHttpConnect(session_, L"127.0.0.1", static_cast<INTERNET_PORT>(credentials.port), 0);
+    if (!connect_) {
+        SetError("Failed to connect to 127.0.0.1:" + std::to_string(credentials.port));
+        Close();
+        return false;
+    }
+
+    HINTERNET request = WinHttpOpenRequest(connect_, L"GET", L"/", nullptr, WINHTTP_NO_REFERER,
+                                           WINHTTP_DEFAULT_ACCEPT_TYPES, WINHTTP_FLAG_SECURE);
+    if (!request) {
+        SetError("Failed to create WebSocket upgrade request");
+        Close();
+        return false;
+    }
+
+    // LCU uses a self-signed certificate
+    DWORD ssl_flags = SECURITY_FLAG_IGNORE_CERT_CN_INVALID |
+                      SECURITY_FLAG_IGNORE_CERT_DATE_INVALID |
+                      SECURITY_FLAG_IGNORE_UNKNOWN_CA;
+    WinHttpSetOption(request, WINHTTP_OPTION_SECURITY_FLAGS, &ssl_flags, sizeof(ssl_flags));
+    WinHttpSetOption(request, WINHTTP_OPTION_UPGRADE_TO_WEB_SOCKET, nullptr, 0);
+
+    std::string auth_header = "Authorization: " + BuildBasicAuthValue(credentials.auth_token);
+    std::wstring wide_auth_header(auth_header.begin(), auth_header.end());
+    WinHttpAddRequestHeaders(request, wide_auth_header.c_str(), static_cast<DWORD>(-1L), WINHTTP_ADDREQ_FLAG_ADD);
+
+    if (!WinHttpSendRequest(request, WINHTTP_NO_ADDITIONAL_HEADERS, 0, WINHTTP_NO_REQUEST_DATA, 0, 0, 0) ||
+        !WinHttpReceiveResponse(request, nullptr)) {
+        SetError("WebSocket upgrade failed (" + std::to_string(::GetLastError()) + ")");
+        WinHttpCloseHandle(request);
+        Close();
+        return false;
+    }
+
+    HINTERNET websocket = WinHttpWebSocketCompleteUpgrade(request, 0);
+    WinHttpCloseHandle(request);
+    if (!websocket) {
+        SetError("WebSocket upgrade rejected (" + std::to_string(::GetLastError()) + ")");
+        Close();
+        return false;
+    }
+
+    // Events can be minutes apart; only Interrupt() or the peer ends a receive
+    DWORD no_timeout = 0;
+    WinHttpSetOption(websocket, WINHTTP_OPTION_RECEIVE_TIMEOUT, &no_timeout, sizeof(no_timeout));
+
+    std::lock_guard<std::mutex> lock(websocket_mutex_);
+    websocket_ = websocket;
+    return true;
+}
+
+void WinHttpEventStream::Close() {
+    {
+        std::lock_guard<std::mutex> lock(websocket_mutex_);
+        if (websocket_) {
+            WinHttpCloseHandle(websocket_);
+            websocket_ = nullptr;
+        }
+    }
+    if (connect_) {
+        WinHttpCloseHandle(connect_);
+        connect_ = nullptr;
+    }
+    if (session_) {
+        WinHttpCloseHandle(session_);
+        session_ = nullptr;
+    }
+}
+
+bool WinHttpEventStream::IsConnected() const {
+    return GetWebSocket() != nullptr;
+}
+
+bool WinHttpEventStream::Subscribe(const std::string& topic) {
+    HINTERNET websocket = GetWebSocket();
+    if (!websocket) {
+        SetError("Event stream is not connected");
+        return false;
+    }
+
+    std::string message = BuildWampSubscribe(topic);
+    DWORD result = WinHttpWebSocketSend(websocket, WINHTTP_WEB_SOCKET_UTF8_MESSAGE_BUFFER_TYPE,
+                                        message.data(), static_cast<DWORD>(message.size()));
+    if (result != ERROR_SUCCESS) {
+        SetError("WebSocket send failed (" + std::to_string(result) + ")");
+        return false;
+    }
+    return true;
+}
+
+bool WinHttpEventStream::ReadMessage(std::string& message) {
+    message.clear();
+
+    for (;;) {
+        HINTERNET websocket = GetWebSocket();
+        if (!websocket) {
+            SetError("Event stream is not connected");
+            return false;
+        }
+
+        DWORD bytes_read = 0;
+        WINHTTP_WEB_SOCKET_BUFFER_TYPE buffer_type;
+        DWORD result = WinHttpWebSocketReceive(websocket, receive_buffer_.data(),
+                                               static_cast<DWORD>(receive_buffer_.size()),
+                                               &bytes_read, &buffer_type);
+        if (result != ERROR_SUCCESS) {
+            SetError("WebSocket receive failed (" + std::to_string(result) + ")");
+            return false;
+        }
+
+        switch (buffer_type) {
+        case WINHTTP_WEB_SOCKET_CLOSE_BUFFER_TYPE:
+            SetError("Event stream closed by the client");
+            return false;
+        case WINHTTP_WEB_SOCKET_UTF8_FRAGMENT_BUFFER_TYPE:
+        case WINHTTP_WEB_SOCKET_BINARY_FRAGMENT_BUFFER_TYPE:
+            if (message.size() + bytes_read > MAX_MESSAGE_SIZE) {
+                SetError("Oversized WebSocket message");
+                return false;
+            }
+            message.append(receive_buffer_.data(), bytes_read);
+            break;
+        default:
+            message.append(receive_buffer_.data(), bytes_read);
+            return true;
+        }
+    }
+}
+
+void WinHttpEventStream::Interrupt() {
+    std::lock_guard<std::mutex> lock(websocket_mutex_);
+    if (websocket_) {
+        WinHttpCloseHandle(websocket_);
+        websocket_ = nullptr;
+    }
+}
+
+std::string WinHttpEventStream::GetLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+HINTERNET WinHttpEventStream::GetWebSocket() const {
+    std::lock_guard<std::mutex> lock(websocket_mutex_);
+    return websocket_;
+}
+
+void WinHttpEventStream::SetError(const std::string& message) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    last_error_ = message;
+}
+
+std::unique_ptr<LCUEventStream> CreatePlatformEventStream(std::chrono::milliseconds connect_timeout) {
+    return std::make_unique<WinHttpEventStream>(connect_timeout);
+}
+
+} // namespace core
+} // namespace league_auto_accept
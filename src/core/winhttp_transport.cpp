@@ -0,0 +1,212 @@
+#include "league_auto_accept/core/winhttp_transport.h"
+#include "league_auto_accept/core/base64.h"
+
+#pragma comment(lib, "winhttp.lib")
+
+namespace league_auto_accept {
+namespace core {
+
+WinHttpTransport::WinHttpTransport(std::chrono::milliseconds timeout)
+    : timeout_(timeout)
+    , session_(nullptr)
+    , connect_(nullptr)
+    , prepared_request_(nullptr)
+    , prepared_method_(HttpMethod::GET)
+    , connection_count_(0) {
+}
+
+WinHttpTransport::~WinHttpTransport() {
+    Close();
+}
+
+bool WinHttpTransport::Open(const LCUCredentials& credentials) {
+    Close();
+    if (!credentials.IsValid()) {
+        last_error_ = "Invalid LCU credentials";
+        return false;
+    }
+
+    session_ = WinHttpOpen(L"LeagueAutoAccept/1.0",
+                           WINHTTP_ACCESS_TYPE_NO_PROXY,
+                           WINHTTP_NO_PROXY_NAME,
+                           WINHTTP_NO_PROXY_BYPASS, 0);
+    if (!session_) {
+        last_error_ = "Failed to create HTTP session";
+        return false;
+    }
+
+    int timeout_ms = static_cast<int>(timeout_.count());
+    WinHttpSetTimeouts(session_, timeout_ms, timeout_ms, timeout_ms, timeout_ms);
+
+    connect_ = WinHttpConnect(session_, L"127.0.0.1", static_cast<INTERNET_PORT>(credentials.port), 0);
+    if (!connect_) {
+        last_error_ = "Failed to connect to 127.0.0.1:" + std::to_string(credentials.port);
+        Close();
+        return false;
+    }
+    connection_count_++;
+
+    std::string auth_header = "Authorization: " + BuildBasicAuthValue(credentials.auth_token);
+    auth_header_.assign(auth_header.begin(), auth_header.end());
+    for (size_t i = 0; i < LCU_ENDPOINT_COUNT; ++i) {
+        std::string_view path = LCU_ENDPOINTS[i].path;
+        endpoint_paths_[i].assign(path.begin(), path.end());
+    }
+    return true;
+}
+
+void WinHttpTransport::Close() {
+    ClosePrepared();
+    if (connect_) {
+        WinHttpCloseHandle(connect_);
+        connect_ = nullptr;
+    }
+    if (session_) {
+        WinHttpCloseHandle(session_);
+        session_ = nullptr;
+    }
+}
+
+bool WinHttpTransport::IsOpen() const {
+    return connect_ != nullptr;
+}
+
+HttpResponseView WinHttpTransport::SendView(HttpMethod method, std::string_view path, std::string_view body) {
+    auto start_time = std::chrono::steady_clock::now();
+    HttpResponseView response;
+    body_buffer_.clear();
+
+    if (!connect_) {
+        last_error_ = "Transport is not open";
+        return response;
+    }
+
+    bool used_prepared = prepared_request_ && body.empty() && method == prepared_method_ && path == prepared_path_;
+    HINTERNET request;
+    if (used_prepared) {
+        request = prepared_request_;
+        prepared_request_ = nullptr;
+    } else {
+        request = OpenRequestHandle(method, path);
+        if (!request) {
+            return response;
+        }
+    }
+
+    BOOL sent;
+    if (body.empty()) {
+        sent = WinHttpSendRequest(request, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
+                                  WINHTTP_NO_REQUEST_DATA, 0, 0, 0);
+    } else {
+        sent = WinHttpSendRequest(request, L"Content-Type: application/json\r\n", static_cast<DWORD>(-1L),
+                                  const_cast<char*>(body.data()), static_cast<DWORD>(body.size()),
+                                  static_cast<DWORD>(body.size()), 0);
+    }
+
+    if (!sent || !WinHttpReceiveResponse(request, nullptr)) {
+        last_error_ = "LCU request failed (" + std::to_string(::GetLastError()) + ")";
+        WinHttpCloseHandle(request);
+        return response;
+    }
+
+    DWORD status_code = 0;
+    DWORD status_code_size = sizeof(status_code);
+    WinHttpQueryHeaders(request, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
+                        WINHTTP_HEADER_NAME_BY_INDEX, &status_code, &status_code_size, WINHTTP_NO_HEADER_INDEX);
+
+    DWORD bytes_available = 0;
+    do {
+        if (!WinHttpQueryDataAvailable(request, &bytes_available)) {
+            last_error_ = "Failed to query data availability";
+            break;
+        }
+
+        if (bytes_available > 0) {
+            // Within the buffer's capacity once it has held a body this large
+            size_t offset = body_buffer_.size();
+            body_buffer_.resize(offset + bytes_available);
+
+            DWORD bytes_read = 0;
+            if (!WinHttpReadData(request, &body_buffer_[offset], bytes_available, &bytes_read)) {
+                last_error_ = "Failed to read response data";
+                body_buffer_.resize(offset);
+                break;
+            }
+            body_buffer_.resize(offset + bytes_read);
+        }
+    } while (bytes_available > 0);
+
+    WinHttpCloseHandle(request);
+
+    response.status_code = static_cast<int>(status_code);
+    response.body = body_buffer_;
+    response.latency = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+
+    // Ready for the next one; off the clock of this request
+    if (used_prepared) {
+        Prepare(method, path);
+    }
+    return response;
+}
+
+void WinHttpTransport::Prepare(HttpMethod method, std::string_view path) {
+    if (!connect_ || (prepared_request_ && method == prepared_method_ && path == prepared_path_)) {
+        return;
+    }
+
+    ClosePrepared();
+    prepared_request_ = OpenRequestHandle(method, path);
+    prepared_method_ = method;
+    prepared_path_.assign(path);
+}
+
+HINTERNET WinHttpTransport::OpenRequestHandle(HttpMethod method, std::string_view path) {
+    const wchar_t* wide_path;
+    int endpoint = FindLCUEndpoint(method, path);
+    if (endpoint >= 0) {
+        wide_path = endpoint_paths_[endpoint].c_str();
+    } else {
+        path_buffer_.assign(path.begin(), path.end());
+        wide_path = path_buffer_.c_str();
+    }
+    const wchar_t* verb = method == HttpMethod::POST ? L"POST" : method == HttpMethod::PUT ? L"PUT" : L"GET";
+
+    HINTERNET request = WinHttpOpenRequest(connect_, verb, wide_path,
+                                           nullptr, WINHTTP_NO_REFERER,
+                                           WINHTTP_DEFAULT_ACCEPT_TYPES, WINHTTP_FLAG_SECURE);
+    if (!request) {
+        last_error_ = "Failed to create HTTP request for " + std::string(path);
+        return nullptr;
+    }
+
+    // LCU uses a self-signed certificate
+    DWORD ssl_flags = SECURITY_FLAG_IGNORE_CERT_CN_INVALID |
+                      SECURITY_FLAG_IGNORE_CERT_DATE_INVALID |
+                      SECURITY_FLAG_IGNORE_UNKNOWN_CA;
+    WinHttpSetOption(request, WINHTTP_OPTION_SECURITY_FLAGS, &ssl_flags, sizeof(ssl_flags));
+    WinHttpAddRequestHeaders(request, auth_header_.c_str(), static_cast<DWORD>(-1L), WINHTTP_ADDREQ_FLAG_ADD);
+    return request;
+}
+
+void WinHttpTransport::ClosePrepared() {
+    if (prepared_request_) {
+        WinHttpCloseHandle(prepared_request_);
+        prepared_request_ = nullptr;
+    }
+}
+
+int WinHttpTransport::GetConnectionCount() const {
+    return connection_count_;
+}
+
+std::string WinHttpTransport::GetLastError() const {
+    return last_error_;
+}
+
+std::unique_ptr<LCUTransport> CreatePlatformTransport(std::chrono::milliseconds timeout) {
+    return std::make_unique<WinHttpTransport>(timeout);
+}
+
+} // namespace core
+} // namespace league_auto_accept
@@ -1,10 +1,27 @@
 #include "league_auto_accept/lcu_client.h"
 #include "league_auto_accept/models/performance_metrics.h"
+#include "league_auto_accept/core/accept_scheduler.h"
+#include "league_auto_accept/core/base64.h"
+#include "league_auto_accept/core/http_wire.h"
+#include "league_auto_accept/core/hybrid_detector.h"
+#include "league_auto_accept/core/lcu_endpoints.h"
+#include "league_auto_accept/core/lcu_request_pool.h"
+#include "league_auto_accept/core/lcu_response_parser.h"
+#include "league_auto_accept/core/retry_policy.h"
+#include <algorithm>
 #include <thread>
-#include <regex>
 
 namespace league_auto_accept {
 
+namespace {
+// For a request an open breaker kept from the client
+LCUResponse RefusedByBreaker() {
+    LCUResponse refused(LCURequestResult::CONNECTION_ERROR);
+    refused.error_message = "LCU not answering - waiting for the next probe";
+    return refused;
+}
+}
+
 LCUClient::LCUClient()
     : LCUClient(nullptr) {
 }
@@ -17,14 +34,34 @@ LCUClient::LCUClient(std::shared_ptr<models::PerformanceMetrics> metrics)
     , auto_reconnect_enabled_(true)
     , successful_requests_(0)
     , failed_requests_(0)
-    , total_request_time_(0) {
+    , total_request_time_(0)
+    , retry_policy_(std::make_unique<core::RetryPolicy>(MakeRetryPolicyConfig(max_retries_, retry_delay_)))
+    , reconnector_([this]() { return ReconnectInBackground(); }, &retry_waiter_)
+    , reset_endpoint_cache_(false)
+    , request_pool_(core::RequestPoolConfig{ASYNC_WORKERS, ASYNC_MAX_QUEUED,
+                                            std::chrono::milliseconds(DEFAULT_TIMEOUT_MS),
+                                            std::chrono::milliseconds(DEFAULT_TIMEOUT_MS)})
+    , ready_check_acceptor_([this](core::HttpMethod method, std::string_view path) {
+          // Single attempt: the acceptor decides about fallbacks, never sleeps
+          LCUResponse response = MakeRequest(method, std::string(path));
+          // Viewed until the acceptor's next call
+          acceptor_body_ = std::move(response.body);
+          core::HttpResponseView http_response;
+          http_response.status_code = response.status_code;
+          http_response.body = acceptor_body_;
+          http_response.latency = response.latency;
+          return http_response;
+      }) {
 }
 
 LCUClient::~LCUClient() {
+    // Before anything it may touch goes away
+    reconnector_.Stop();
     Disconnect();
 }
 
 bool LCUClient::Initialize() {
+    std::lock_guard<std::mutex> lock(session_mutex_);
     return connection_info_.DiscoverFromLockfile();
 }
 
@@ -34,17 +71,24 @@ bool LCUClient::Connect() {
         return false;
     }
 
-    if (!connection_info_.IsValid()) {
+    if (!GetConnectionInfo().IsValid()) {
         UpdateConnectionState(false, "Invalid LCU connection information");
         return false;
     }
 
     try {
-        SetupHTTPClient();
+        SetupSession();
+
+        // A restarted client may be a different build, and deserves a clean slate
+        ready_check_acceptor_.ResetEndpointCache();
+        health_.Reset();
 
         // Test the connection
         if (TestConnection()) {
-            connection_info_.SetConnectionState(models::LCUConnectionState::CONNECTED);
+            {
+                std::lock_guard<std::mutex> lock(session_mutex_);
+                connection_info_.SetConnectionState(models::LCUConnectionState::CONNECTED);
+            }
             UpdateConnectionState(true);
             return true;
         } else {
@@ -63,30 +107,37 @@ bool LCUClient::Reconnect() {
 }
 
 void LCUClient::Disconnect() {
-    http_client_.reset();
-    connection_info_.SetConnectionState(models::LCUConnectionState::DISCONNECTED);
+    {
+        // A request still running keeps its own reference to the session
+        std::lock_guard<std::mutex> lock(session_mutex_);
+        session_.reset();
+        connection_info_.SetConnectionState(models::LCUConnectionState::DISCONNECTED);
+    }
+    request_pool_.UpdateCredentials(core::LCUCredentials{});
     UpdateConnectionState(false);
 }
 
 bool LCUClient::IsConnected() const {
-    return connection_info_.IsConnected() && http_client_ != nullptr;
+    std::lock_guard<std::mutex> lock(session_mutex_);
+    return connection_info_.IsConnected() && session_ != nullptr && session_->IsReady();
 }
 
 bool LCUClient::TestConnection() {
-    if (!http_client_) return false;
+    if (!AcquireSession()) return false;
 
     auto response = GetGameflowPhase();
     return response.IsSuccess() || response.result == LCURequestResult::NOT_FOUND;
 }
 
 models::LCUConnectionInfo LCUClient::GetConnectionInfo() const {
+    std::lock_guard<std::mutex> lock(session_mutex_);
     return connection_info_;
 }
 
 void LCUClient::SetConnectionTimeout(std::chrono::milliseconds timeout) {
     connection_timeout_ = timeout;
-    if (http_client_) {
-        http_client_->set_read_timeout(timeout.count() / 1000, (timeout.count() % 1000) * 1000);
+    if (AcquireSession()) {
+        SetupSession(); // The transport takes its timeout at construction
     }
 }
 
@@ -95,54 +146,84 @@ std::chrono::milliseconds LCUClient::GetConnectionTimeout() const {
 }
 
 LCUResponse LCUClient::GetGameflowPhase() {
-    return MakeRequestWithRetry("GET", GAMEFLOW_ENDPOINT);
+    return MakeRequestWithRetry(core::HttpMethod::GET, GAMEFLOW_ENDPOINT);
 }
 
 LCUResponse LCUClient::GetReadyCheckStatus() {
-    return MakeRequestWithRetry("GET", READY_CHECK_ENDPOINT);
+    return MakeRequestWithRetry(core::HttpMethod::GET, READY_CHECK_ENDPOINT);
 }
 
 LCUResponse LCUClient::AcceptReadyCheck() {
-    return MakeRequestWithRetry("POST", READY_CHECK_ACCEPT_ENDPOINT);
+    return MakeRequestWithRetry(core::HttpMethod::POST, READY_CHECK_ACCEPT_ENDPOINT);
 }
 
 LCUResponse LCUClient::DeclineReadyCheck() {
-    return MakeRequestWithRetry("POST", READY_CHECK_DECLINE_ENDPOINT);
+    return MakeRequestWithRetry(core::HttpMethod::POST, READY_CHECK_DECLINE_ENDPOINT);
+}
+
+core::AsyncLCURequest LCUClient::GetGameflowPhaseAsync(std::chrono::milliseconds deadline) {
+    return request_pool_.Submit(core::HttpMethod::GET, GAMEFLOW_ENDPOINT, "", deadline);
 }
 
-std::future<LCUResponse> LCUClient::GetGameflowPhaseAsync() {
-    return std::async(std::launch::async, [this]() {
-        return GetGameflowPhase();
-    });
+core::AsyncLCURequest LCUClient::GetReadyCheckStatusAsync(std::chrono::milliseconds deadline) {
+    return request_pool_.Submit(core::HttpMethod::GET, READY_CHECK_ENDPOINT, "", deadline);
 }
 
-std::future<LCUResponse> LCUClient::GetReadyCheckStatusAsync() {
-    return std::async(std::launch::async, [this]() {
-        return GetReadyCheckStatus();
-    });
+core::AsyncLCURequest LCUClient::AcceptReadyCheckAsync(std::chrono::milliseconds deadline) {
+    return request_pool_.Submit(core::HttpMethod::POST, READY_CHECK_ACCEPT_ENDPOINT, "", deadline);
 }
 
-std::future<LCUResponse> LCUClient::AcceptReadyCheckAsync() {
-    return std::async(std::launch::async, [this]() {
-        return AcceptReadyCheck();
-    });
+core::AsyncLCURequest LCUClient::DeclineReadyCheckAsync(std::chrono::milliseconds deadline) {
+    return request_pool_.Submit(core::HttpMethod::POST, READY_CHECK_DECLINE_ENDPOINT, "", deadline);
 }
 
-std::future<LCUResponse> LCUClient::DeclineReadyCheckAsync() {
-    return std::async(std::launch::async, [this]() {
-        return DeclineReadyCheck();
-    });
+LCUResponse LCUClient::AwaitResponse(core::AsyncLCURequest& request) {
+    core::AsyncRequestResult result = request.Get();
+
+    LCUResponse response;
+    switch (result.status) {
+    case core::AsyncRequestStatus::COMPLETED:
+        response.latency = std::chrono::duration_cast<std::chrono::milliseconds>(result.response.latency);
+        if (result.response.IsTransportError()) {
+            response.result = LCURequestResult::CONNECTION_ERROR;
+            response.error_message = "No response from LCU: " + result.error;
+        } else {
+            response.status_code = result.response.status_code;
+            response.body = std::move(result.response.body);
+            response.result = MapHTTPStatusToResult(response.status_code);
+            if (!response.IsSuccess()) {
+                response.error_message = "HTTP " + std::to_string(response.status_code) + ": " +
+                                         core::HttpStatusReason(response.status_code);
+            }
+        }
+        break;
+    case core::AsyncRequestStatus::EXPIRED:
+        response.result = LCURequestResult::TIMEOUT;
+        response.error_message = "LCU request deadline passed";
+        break;
+    case core::AsyncRequestStatus::REJECTED:
+        response.result = LCURequestResult::CONNECTION_ERROR;
+        response.error_message = "LCU request queue full";
+        break;
+    default:
+        response.result = LCURequestResult::UNKNOWN_ERROR;
+        response.error_message = std::string("LCU request ") + core::AsyncRequestStatusToString(result.status);
+        break;
+    }
+
+    // Cancelled requests were abandoned on purpose, not failures
+    if (result.status != core::AsyncRequestStatus::CANCELLED) {
+        RecordRequestMetrics(response);
+    }
+    return response;
 }
 
 models::GameflowPhase LCUClient::GetCurrentGameflowPhase() {
     auto response = GetGameflowPhase();
-    if (response.IsSuccess()) {
-        try {
-            std::string phase_str = ParseGameflowPhaseFromResponse(response.body);
-            return models::StringToGameflowPhase(phase_str);
-        } catch (const std::exception&) {
-            return models::GameflowPhase::NONE;
-        }
+    std::string_view phase;
+    if (response.IsSuccess() && core::ParseGameflowPhase(response.body, phase)) {
+        // UNKNOWN for a phase this build does not know
+        return models::GameflowPhaseFromWire(phase);
     }
     return models::GameflowPhase::NONE;
 }
@@ -150,19 +231,90 @@ models::GameflowPhase LCUClient::GetCurrentGameflowPhase() {
 ReadyCheckStatus LCUClient::GetCurrentReadyCheckStatus() {
     auto response = GetReadyCheckStatus();
     if (response.IsSuccess()) {
-        return ParseReadyCheckFromResponse(response.body);
+        ReadyCheckStatus status = ParseReadyCheckFromResponse(response.body);
+        if (status.IsActive()) {
+            // Retries of ready-check calls stop where the LCU drops the match
+            ready_check_deadline_ = core::GetReadyCheckDeadline(
+                status.timer, std::chrono::steady_clock::now() - response.latency);
+        }
+        return status;
     }
     return ReadyCheckStatus{};
 }
 
+core::DetectorVerdict LCUClient::DetectReadyCheck() {
+    // Runs on the hybrid detector's LCU lane, next to accepts and phase
+    // reads on the detection thread: read through the request pool, whose
+    // workers own their connections, never through the shared session.
+    // One attempt; the lane reads again on the next pass.
+    if (!health_.AllowRequest(core::LCUEndpointId::READY_CHECK)) {
+        return core::DetectorVerdict::FAILED;
+    }
+    core::AsyncLCURequest request = GetReadyCheckStatusAsync(connection_timeout_);
+    LCUResponse response = AwaitResponse(request);
+    core::HttpResponse http_response;
+    http_response.status_code = response.status_code;
+    health_.RecordResponse(core::LCUEndpointId::READY_CHECK, http_response, response.latency);
+    if (http_response.IsTransportError() && auto_reconnect_enabled_) {
+        reconnector_.Request();
+    }
+
+    if (!response.IsSuccess()) {
+        // The LCU answers 404 while there is no ready check
+        return response.status_code == 404 ? core::DetectorVerdict::NOT_FOUND : core::DetectorVerdict::FAILED;
+    }
+
+    ReadyCheckStatus status = ParseReadyCheckFromResponse(response.body);
+    if (!status.IsActive()) {
+        return core::DetectorVerdict::NOT_FOUND;
+    }
+    ready_check_deadline_ = core::GetReadyCheckDeadline(status.timer, std::chrono::steady_clock::now() - response.latency);
+    return status.HasTimeRemaining() ? core::DetectorVerdict::FOUND : core::DetectorVerdict::NOT_FOUND;
+}
+
 bool LCUClient::IsReadyCheckActive() {
     auto status = GetCurrentReadyCheckStatus();
     return status.IsActive() && status.HasTimeRemaining();
 }
 
 bool LCUClient::AcceptCurrentReadyCheck() {
-    auto response = AcceptReadyCheck();
-    return response.IsSuccess();
+    return AcceptCurrentReadyCheck(std::chrono::steady_clock::now()).accepted;
+}
+
+core::AcceptResult LCUClient::AcceptCurrentReadyCheck(std::chrono::steady_clock::time_point detected_at) {
+    return AcceptCurrentReadyCheck(detected_at, GetReadyCheckDeadline(detected_at));
+}
+
+core::AcceptResult LCUClient::AcceptCurrentReadyCheck(std::chrono::steady_clock::time_point detected_at,
+                                                      std::chrono::steady_clock::time_point deadline) {
+    // Left for this thread by a background reconnect; the acceptor is not thread-safe
+    if (reset_endpoint_cache_.exchange(false)) {
+        ready_check_acceptor_.ResetEndpointCache();
+    }
+    // The caller's deadline may be tighter than the ready check's own
+    deadline = std::min(deadline, GetReadyCheckDeadline(detected_at));
+    core::AcceptResult result = ready_check_acceptor_.Accept(detected_at, deadline);
+    if (!result.accepted && result.deadline_reached) {
+        if (performance_metrics_) {
+            performance_metrics_->RecordAcceptDeadlineMiss();
+        }
+    } else if (!result.accepted && performance_metrics_) {
+        performance_metrics_->RecordError("Ready check accept failed: " +
+            (result.error_code.empty() ? "HTTP " + std::to_string(result.status_code) : result.error_code));
+    }
+    return result;
+}
+
+bool LCUClient::VerifyReadyCheckAccepted(core::AcceptResult& result) {
+    return ready_check_acceptor_.Verify(result);
+}
+
+bool LCUClient::PrewarmAccept() {
+    std::shared_ptr<core::LCUSession> session = AcquireSession();
+    if (!session) return false;
+
+    return session->Prewarm(core::HttpMethod::POST, ready_check_acceptor_.GetNextEndpoint(), GAMEFLOW_ENDPOINT,
+                            core::ACCEPT_KEEP_WARM_INTERVAL);
 }
 
 void LCUClient::SetPerformanceMetrics(std::shared_ptr<models::PerformanceMetrics> metrics) {
@@ -188,6 +340,24 @@ int LCUClient::GetFailedRequestCount() const {
 void LCUClient::SetRetryPolicy(int max_retries, std::chrono::milliseconds retry_delay) {
     max_retries_ = max_retries;
     retry_delay_ = retry_delay;
+    SetRetryPolicy(MakeRetryPolicyConfig(max_retries, retry_delay));
+}
+
+void LCUClient::SetRetryPolicy(const core::RetryPolicyConfig& config) {
+    retry_policy_ = std::make_unique<core::RetryPolicy>(config);
+}
+
+core::RetryPolicy::Stats LCUClient::GetRetryStats() const {
+    return retry_policy_->GetStats();
+}
+
+core::RetryPolicyConfig LCUClient::MakeRetryPolicyConfig(int max_retries, std::chrono::milliseconds retry_delay) {
+    // retry_delay is the first backoff now; later ones double up to RETRY_MAX_BACKOFF_MS
+    core::RetryPolicyConfig config;
+    config.max_attempts = std::max(max_retries, 0) + 1;
+    config.initial_backoff = retry_delay;
+    config.max_backoff = std::max(retry_delay, std::chrono::milliseconds(RETRY_MAX_BACKOFF_MS));
+    return config;
 }
 
 void LCUClient::EnableAutoReconnect(bool enabled) {
@@ -223,121 +393,215 @@ std::vector<int> LCUClient::FindLCUPorts() {
 }
 
 std::string LCUClient::ParseGameflowPhaseFromResponse(const std::string& response_body) {
-    try {
-        nlohmann::json json = nlohmann::json::parse(response_body);
-        if (json.is_string()) {
-            return json.get<std::string>();
-        }
-    } catch (const std::exception&) {
-        // Fall through to error case
+    std::string_view phase;
+    if (!core::ParseGameflowPhase(response_body, phase)) {
+        throw std::invalid_argument("Invalid gameflow phase response format");
     }
-    throw std::invalid_argument("Invalid gameflow phase response format");
+    return std::string(phase);
 }
 
-ReadyCheckStatus LCUClient::ParseReadyCheckFromResponse(const std::string& response_body) {
+ReadyCheckStatus LCUClient::ParseReadyCheckFromResponse(std::string_view response_body) {
     ReadyCheckStatus status;
 
-    try {
-        nlohmann::json json = nlohmann::json::parse(response_body);
-
-        if (json.contains("declinerIds") && json["declinerIds"].is_array()) {
-            for (const auto& id : json["declinerIds"]) {
-                if (id.is_number_integer()) {
-                    status.decliner_ids.push_back(id.get<int>());
-                }
-            }
-        }
-
-        status.dodge_warning = json.value("dodgeWarning", std::string("None"));
-        status.player_response = json.value("playerResponse", std::string("None"));
-        status.state = json.value("state", std::string("Invalid"));
-        status.suppress_ux = json.value("suppressUx", false);
-        status.timer = json.value("timer", 0.0);
-
-    } catch (const std::exception&) {
+    core::ReadyCheckView view;
+    if (!core::ParseReadyCheck(response_body, view)) {
         // Return default-constructed status on parse error
+        return status;
+    }
+
+    constexpr size_t MAX_DECLINERS = 10;
+    long long decliner_ids[MAX_DECLINERS];
+    int decliner_count = core::ParseDeclinerIds(view.decliner_ids, decliner_ids, MAX_DECLINERS);
+    for (int i = 0; i < decliner_count; ++i) {
+        status.decliner_ids.push_back(static_cast<int>(decliner_ids[i]));
     }
 
+    status.dodge_warning = view.dodge_warning.empty() ? "None" : std::string(view.dodge_warning);
+    status.player_response = view.player_response.empty() ? "None" : std::string(view.player_response);
+    status.state = std::string(view.state);
+    status.suppress_ux = view.suppress_ux;
+    status.timer = view.timer;
+
     return status;
 }
 
-LCUResponse LCUClient::MakeRequest(const std::string& method, const std::string& endpoint,
+LCUResponse LCUClient::MakeRequest(core::HttpMethod method, const std::string& endpoint,
                                   const std::string& body, const std::string& content_type) {
     if (!IsConnected()) {
         return LCUResponse(LCURequestResult::CONNECTION_ERROR);
     }
 
-    auto start_time = std::chrono::steady_clock::now();
-
-    std::shared_ptr<httplib::Response> response;
+    // Every LCU endpoint we use takes JSON; the transports always send it as such
+    (void)content_type;
 
-    if (method == "GET") {
-        response = http_client_->Get(endpoint.c_str());
-    } else if (method == "POST") {
-        response = http_client_->Post(endpoint.c_str(), body, content_type.c_str());
-    } else {
-        LCUResponse error_response(LCURequestResult::UNKNOWN_ERROR);
-        error_response.error_message = "Unsupported HTTP method: " + method;
-        return error_response;
+    std::shared_ptr<core::LCUSession> session = AcquireSession();
+    if (!session) {
+        return LCUResponse(LCURequestResult::CONNECTION_ERROR);
     }
 
-    return ProcessHTTPResponse(response, start_time);
+    core::HttpResponse http_response = session->Send(method, endpoint, body);
+    bool transport_error = http_response.IsTransportError();
+    LCUResponse response = ProcessHTTPResponse(std::move(http_response));
+    if (transport_error) {
+        response.error_message += ": " + session->GetLastError();
+    }
+    return response;
 }
 
-LCUResponse LCUClient::MakeRequestWithRetry(const std::string& method, const std::string& endpoint,
+LCUResponse LCUClient::MakeRequestWithRetry(core::HttpMethod method, const std::string& endpoint,
                                            const std::string& body, const std::string& content_type) {
-    LCUResponse last_response;
-
-    for (int attempt = 0; attempt <= max_retries_; ++attempt) {
-        last_response = MakeRequest(method, endpoint, body, content_type);
+    // A registry endpoint whose breaker is open fails at once until its
+    // next probe; the client is not asked, retried or reconnected to
+    int registered = core::FindLCUEndpoint(method, endpoint);
+    core::LCUEndpointId endpoint_id = static_cast<core::LCUEndpointId>(registered);
+    // Set when this call holds the half-open probe
+    uint64_t probe = 0;
+    if (registered >= 0 && !health_.AllowRequest(endpoint_id, std::chrono::steady_clock::now(), &probe)) {
+        return RefusedByBreaker();
+    }
 
-        if (last_response.IsSuccess()) {
+    LCUResponse last_response;
+    core::RetryResult retry = retry_policy_->Execute(
+        endpoint, GetRetryDeadline(endpoint),
+        [&]() {
+            last_response = MakeRequest(method, endpoint, body, content_type);
+            core::HttpResponse http_response;
+            http_response.status_code = last_response.status_code;
+            if (registered >= 0) {
+                health_.RecordResponse(endpoint_id, http_response, last_response.latency);
+            }
+            return http_response;
+        },
+        &retry_waiter_,
+        [&](const core::HttpResponse& response) {
+            // The backoff goes on meanwhile and ends early once connected
+            if (response.IsTransportError() && auto_reconnect_enabled_) {
+                reconnector_.Request();
+            }
+        },
+        [&]() {
+            // Retries only go out while the breaker is closed. Once earlier
+            // attempts opened it, its probes alone reach the client; a
+            // failed probe of this call's own is not retried either.
+            return registered < 0 || health_.GetState(endpoint_id) == core::BreakerState::CLOSED;
+        });
+
+    if (retry.IsSuccess()) {
+        {
+            std::lock_guard<std::mutex> lock(session_mutex_);
             connection_info_.UpdateLastSuccessfulRequest();
-            RecordRequestMetrics(last_response);
-            return last_response;
         }
+        RecordRequestMetrics(last_response);
+        return last_response;
+    }
 
-        // Check if we should retry
-        if (attempt < max_retries_) {
-            if (last_response.result == LCURequestResult::CONNECTION_ERROR && auto_reconnect_enabled_) {
-                // Try to reconnect
-                if (Reconnect()) {
-                    continue; // Retry immediately after successful reconnection
-                }
-            }
+    if (retry.outcome == core::RetryOutcome::REFUSED) {
+        // Earlier attempts opened the breaker; answered like a request it kept back
+        return RefusedByBreaker();
+    }
 
-            // Wait before retry
-            std::this_thread::sleep_for(retry_delay_);
+    if (retry.attempts == 0) {
+        // Let through but never sent: a probe it held goes to the next caller
+        if (probe != 0) {
+            health_.ReleaseProbe(endpoint_id, probe);
         }
+        last_response = LCUResponse(LCURequestResult::TIMEOUT);
+        last_response.error_message = "Ready check expired before the request";
+    } else if (retry.outcome == core::RetryOutcome::BUDGET_EXHAUSTED ||
+               retry.outcome == core::RetryOutcome::DEADLINE_REACHED) {
+        last_response.error_message += std::string(" (") + core::RetryOutcomeToString(retry.outcome) + ")";
     }
 
-    // All retries failed
-    connection_info_.IncrementConnectionErrors();
+    {
+        std::lock_guard<std::mutex> lock(session_mutex_);
+        connection_info_.IncrementConnectionErrors();
+    }
     RecordRequestMetrics(last_response);
     return last_response;
 }
 
-void LCUClient::SetupHTTPClient() {
-    http_client_ = std::make_unique<httplib::SSLClient>("127.0.0.1", connection_info_.GetPort());
+const core::LCUHealthMonitor& LCUClient::GetHealth() const {
+    return health_;
+}
+
+std::chrono::steady_clock::time_point LCUClient::GetRetryDeadline(const std::string& endpoint) const {
+    auto now = std::chrono::steady_clock::now();
+    // An answer to a ready check after it expired is worthless; without a
+    // fresh status, assume one just started
+    if (endpoint.rfind(READY_CHECK_ENDPOINT, 0) == 0) {
+        return GetReadyCheckDeadline(now);
+    }
+    // Retries included, a call takes no longer than one attempt may
+    return now + connection_timeout_;
+}
+
+std::chrono::steady_clock::time_point LCUClient::GetReadyCheckDeadline(
+    std::chrono::steady_clock::time_point detected_at) const {
+    // Set by the LCU lane as well as this thread
+    std::chrono::steady_clock::time_point deadline = ready_check_deadline_.load();
+    if (deadline > detected_at) {
+        return deadline;
+    }
+    return core::GetReadyCheckDeadline(0.0, detected_at);
+}
+
+void LCUClient::UpdateReadyCheckTimer(double timer, std::chrono::steady_clock::time_point read_at) {
+    ready_check_deadline_ = core::GetReadyCheckDeadline(timer, read_at);
+}
 
-    // Configure timeouts
-    auto timeout_sec = connection_timeout_.count() / 1000;
-    auto timeout_usec = (connection_timeout_.count() % 1000) * 1000;
-    http_client_->set_read_timeout(timeout_sec, timeout_usec);
-    http_client_->set_write_timeout(timeout_sec, timeout_usec);
+std::shared_ptr<core::LCUSession> LCUClient::AcquireSession() const {
+    std::lock_guard<std::mutex> lock(session_mutex_);
+    return session_;
+}
+
+bool LCUClient::ReconnectInBackground() {
+    if (!auto_reconnect_enabled_) return false;
 
-    // Configure SSL
-    ConfigureSSLSettings();
+    // Built and probed off to the side; requests keep using the old session
+    // until the new one is known to work
+    models::LCUConnectionInfo discovered;
+    if (!discovered.DiscoverFromLockfile() || !discovered.IsValid()) {
+        return false;
+    }
+    auto session = std::make_shared<core::LCUSession>(core::CreatePlatformTransport(connection_timeout_));
+    session->UpdateCredentials({discovered.GetPort(), discovered.GetAuthToken()});
+    core::HttpResponse probe = session->Get(GAMEFLOW_ENDPOINT);
+    if (!probe.IsSuccess() && probe.status_code != 404) {
+        return false;
+    }
 
-    // Set authentication
-    http_client_->set_basic_auth("riot", connection_info_.GetAuthToken());
+    discovered.SetConnectionState(models::LCUConnectionState::CONNECTED);
+    bool new_client;
+    {
+        std::lock_guard<std::mutex> lock(session_mutex_);
+        new_client = !session_ || session_->GetCredentials() != session->GetCredentials();
+        session_ = session;
+        connection_info_ = discovered;
+        auth_header_ = core::BuildBasicAuthValue(connection_info_.GetAuthToken());
+    }
+    request_pool_.UpdateCredentials(session->GetCredentials());
+    // A restarted client may be a different build. The same client found
+    // again keeps its breakers, or probing would start over at every reconnect.
+    reset_endpoint_cache_ = true;
+    if (new_client) {
+        health_.Reset();
+    }
+    UpdateConnectionState(true);
+    return true;
 }
 
-void LCUClient::ConfigureSSLSettings() {
-    if (http_client_) {
-        // LCU uses self-signed certificates, so we need to disable verification
-        http_client_->enable_server_certificate_verification(false);
+void LCUClient::SetupSession() {
+    // Same keep-alive transport as the other front-ends; certificate checks are
+    // off in the transport since the LCU uses a self-signed certificate
+    auto session = std::make_shared<core::LCUSession>(core::CreatePlatformTransport(connection_timeout_));
+    {
+        std::lock_guard<std::mutex> lock(session_mutex_);
+        session->UpdateCredentials({connection_info_.GetPort(), connection_info_.GetAuthToken()});
+        session_ = session;
+        auth_header_ = core::BuildBasicAuthValue(connection_info_.GetAuthToken());
     }
+    // The async workers keep their own connections with the same credentials
+    request_pool_.UpdateCredentials(session->GetCredentials());
 }
 
 void LCUClient::UpdateConnectionState(bool connected, const std::string& error) {
@@ -366,26 +630,24 @@ void LCUClient::RecordRequestMetrics(const LCUResponse& response) {
     }
 }
 
-LCUResponse LCUClient::ProcessHTTPResponse(std::shared_ptr<httplib::Response> response,
-                                          std::chrono::steady_clock::time_point start_time) {
-    auto end_time = std::chrono::steady_clock::now();
-    auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time);
-
+LCUResponse LCUClient::ProcessHTTPResponse(core::HttpResponse&& response) {
     LCUResponse result;
-    result.latency = latency;
+    result.latency = std::chrono::duration_cast<std::chrono::milliseconds>(response.latency);
 
-    if (!response) {
+    if (response.IsTransportError()) {
         result.result = LCURequestResult::CONNECTION_ERROR;
         result.error_message = "No response from LCU";
         return result;
     }
 
-    result.status_code = response->status;
-    result.body = response->body;
-    result.result = MapHTTPStatusToResult(response->status);
+    result.status_code = response.status_code;
+    // Moved: the session already copied it out of its connection buffer
+    result.body = std::move(response.body);
+    result.result = MapHTTPStatusToResult(response.status_code);
 
     if (!result.IsSuccess()) {
-        result.error_message = "HTTP " + std::to_string(response->status) + ": " + response->reason;
+        result.error_message = "HTTP " + std::to_string(response.status_code) + ": " +
+                               core::HttpStatusReason(response.status_code);
     }
 
     return result;
@@ -412,19 +674,9 @@ LCURequestResult LCUClient::MapHTTPStatusToResult(int status_code) {
 }
 
 std::string LCUClient::GetAuthHeader() const {
-    return "Basic " + httplib::detail::base64_encode("riot:" + connection_info_.GetAuthToken());
-}
-
-bool LCUClient::ValidateGameflowResponse(const nlohmann::json& json) const {
-    return json.is_string() && !json.get<std::string>().empty();
-}
-
-bool LCUClient::ValidateReadyCheckResponse(const nlohmann::json& json) const {
-    return json.is_object() &&
-           json.contains("state") &&
-           json.contains("timer") &&
-           json["state"].is_string() &&
-           json["timer"].is_number();
+    // Encoded once per connection
+    std::lock_guard<std::mutex> lock(session_mutex_);
+    return auth_header_;
 }
 
-} // namespace league_auto_accept
\ No newline at end of file
+} // namespace league_auto_accept
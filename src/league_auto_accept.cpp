@@ -1,47 +1,20 @@
 #include <windows.h>
-#include <winhttp.h>
 #include <shellapi.h>
 #include <iostream>
 #include <string>
 #include <fstream>
-#include <sstream>
-#include <vector>
-#include <thread>
 #include <chrono>
 #include <atomic>
+#include <mutex>
+#include "league_auto_accept/core/auto_accept_engine.h"
 
-// Base64 encoding for authentication
-std::string base64_encode(const std::string& input) {
-    static const char encoding_table[] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-        'w', 'x', 'y', 'z', '0', '1', '2', '3',
-        '4', '5', '6', '7', '8', '9', '+', '/'
-    };
-
-    std::string encoded;
-    int val = 0, valb = -6;
-    for (unsigned char c : input) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            encoded.push_back(encoding_table[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6) encoded.push_back(encoding_table[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (encoded.size() % 4) encoded.push_back('=');
-    return encoded;
-}
+#define WM_ACCEPT_RESULT WM_USER + 2
 
 class LeagueAutoAccept {
 private:
-    std::string lcu_token;
-    int lcu_port = 0;
+    // Detection runs on the engine's thread; this class only owns the tray and hotkey
+    std::unique_ptr<league_auto_accept::core::AutoAcceptEngine> engine;
+    std::mutex console_mutex;
     std::atomic<bool> running{false};
     std::atomic<bool> auto_accept_enabled{false};
     std::atomic<bool> emergency_stop{false};
@@ -49,8 +22,11 @@ private:
     // Configuration
     struct Config {
         bool auto_accept_enabled = true;
-        int polling_interval_ms = 250;
+        int polling_interval_ms = 250;           // Matchmaking / ready check
+        int idle_polling_interval_ms = 2000;     // Lobby / no queue
+        int dormant_polling_interval_ms = 15000; // In game / end of game
         int lcu_timeout_ms = 5000;
+        bool elevate_priority_in_queue = false;  // Detection thread, Matchmaking / ready check
         std::string emergency_hotkey = "F9";
         bool enable_notifications = true;
         bool startup_enabled = false;
@@ -79,6 +55,22 @@ public:
         return true;
     }
 
+    // Integer value of a `"key": value,` config line
+    static void ReadConfigInt(const std::string& line, int& value) {
+        size_t pos = line.find(":") + 1;
+        size_t end = line.find(",", pos);
+        if (end == std::string::npos) end = line.find("}", pos);
+        std::string text = line.substr(pos, end - pos);
+        // Remove whitespace and quotes
+        text.erase(0, text.find_first_not_of(" \t\""));
+        text.erase(text.find_last_not_of(" \t\",") + 1);
+        try {
+            value = std::stoi(text);
+        } catch (const std::exception&) {
+            // Keep the default
+        }
+    }
+
     bool LoadConfiguration() {
         std::cout << "[>] Loading configuration..." << std::endl;
 
@@ -96,14 +88,16 @@ public:
                 config.auto_accept_enabled = line.find("true") != std::string::npos;
             }
             else if (line.find("\"polling_interval_ms\"") != std::string::npos) {
-                size_t pos = line.find(":") + 1;
-                size_t end = line.find(",", pos);
-                if (end == std::string::npos) end = line.find("}", pos);
-                std::string value = line.substr(pos, end - pos);
-                // Remove whitespace and quotes
-                value.erase(0, value.find_first_not_of(" \t\""));
-                value.erase(value.find_last_not_of(" \t\",") + 1);
-                config.polling_interval_ms = std::stoi(value);
+                ReadConfigInt(line, config.polling_interval_ms);
+            }
+            else if (line.find("\"idle_polling_interval_ms\"") != std::string::npos) {
+                ReadConfigInt(line, config.idle_polling_interval_ms);
+            }
+            else if (line.find("\"dormant_polling_interval_ms\"") != std::string::npos) {
+                ReadConfigInt(line, config.dormant_polling_interval_ms);
+            }
+            else if (line.find("\"elevate_priority_in_queue\"") != std::string::npos) {
+                config.elevate_priority_in_queue = line.find("true") != std::string::npos;
             }
         }
         file.close();
@@ -119,7 +113,10 @@ public:
             file << "{\n";
             file << "  \"auto_accept_enabled\": " << (config.auto_accept_enabled ? "true" : "false") << ",\n";
             file << "  \"polling_interval_ms\": " << config.polling_interval_ms << ",\n";
+            file << "  \"idle_polling_interval_ms\": " << config.idle_polling_interval_ms << ",\n";
+            file << "  \"dormant_polling_interval_ms\": " << config.dormant_polling_interval_ms << ",\n";
             file << "  \"lcu_timeout_ms\": " << config.lcu_timeout_ms << ",\n";
+            file << "  \"elevate_priority_in_queue\": " << (config.elevate_priority_in_queue ? "true" : "false") << ",\n";
             file << "  \"emergency_hotkey\": \"" << config.emergency_hotkey << "\",\n";
             file << "  \"enable_notifications\": " << (config.enable_notifications ? "true" : "false") << ",\n";
             file << "  \"startup_enabled\": " << (config.startup_enabled ? "true" : "false") << "\n";
@@ -129,126 +126,17 @@ public:
         }
     }
 
-    bool ReadLCULockfile() {
-        char* appdata = getenv("LOCALAPPDATA");
-        if (!appdata) return false;
-
-        std::string lockfile_path = std::string(appdata) + "\\Riot Games\\Riot Client\\Config\\lockfile";
-        std::ifstream file(lockfile_path);
-        if (!file.is_open()) return false;
-
-        std::string content;
-        std::getline(file, content);
-        file.close();
-
-        std::vector<std::string> parts;
-        std::stringstream ss(content);
-        std::string item;
-        while (std::getline(ss, item, ':')) {
-            parts.push_back(item);
-        }
-
-        if (parts.size() >= 4) {
-            lcu_port = std::stoi(parts[2]);
-            lcu_token = parts[3];
-            return true;
-        }
-        return false;
+    void PrintLine(const std::string& line) {
+        std::lock_guard<std::mutex> lock(console_mutex);
+        std::cout << line << std::endl;
     }
 
-    std::string MakeLCURequest(const std::wstring& endpoint, const std::wstring& method = L"GET", const std::string& body = "") {
-        if (lcu_port == 0 || lcu_token.empty()) {
-            if (!ReadLCULockfile()) return "";
+    void SetAutoAcceptEnabled(bool enabled) {
+        auto_accept_enabled = enabled;
+        if (engine) {
+            engine->SetAutoAcceptEnabled(enabled);
         }
-
-        HINTERNET hSession = WinHttpOpen(
-            L"League Auto-Accept/1.0",
-            WINHTTP_ACCESS_TYPE_DEFAULT_PROXY,
-            WINHTTP_NO_PROXY_NAME,
-            WINHTTP_NO_PROXY_BYPASS, 0);
-
-        if (!hSession) return "";
-
-        HINTERNET hConnect = WinHttpConnect(hSession, L"127.0.0.1", lcu_port, 0);
-        if (!hConnect) {
-            WinHttpCloseHandle(hSession);
-            return "";
-        }
-
-        HINTERNET hRequest = WinHttpOpenRequest(
-            hConnect, method.c_str(), endpoint.c_str(),
-            NULL, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES,
-            WINHTTP_FLAG_SECURE);
-
-        if (!hRequest) {
-            WinHttpCloseHandle(hConnect);
-            WinHttpCloseHandle(hSession);
-            return "";
-        }
-
-        // Set SSL options (ignore certificate errors for self-signed cert)
-        DWORD flags = SECURITY_FLAG_IGNORE_CERT_CN_INVALID |
-                      SECURITY_FLAG_IGNORE_CERT_DATE_INVALID |
-                      SECURITY_FLAG_IGNORE_UNKNOWN_CA |
-                      SECURITY_FLAG_IGNORE_CERT_WRONG_USAGE;
-        WinHttpSetOption(hRequest, WINHTTP_OPTION_SECURITY_FLAGS, &flags, sizeof(flags));
-
-        // Set authorization header
-        std::string auth_string = "riot:" + lcu_token;
-        std::string encoded_auth = base64_encode(auth_string);
-        std::string auth_header = "Authorization: Basic " + encoded_auth;
-        std::wstring wauth_header(auth_header.begin(), auth_header.end());
-
-        WinHttpAddRequestHeaders(hRequest, wauth_header.c_str(), -1, WINHTTP_ADDREQ_FLAG_ADD);
-
-        // Send request
-        BOOL result;
-        if (body.empty()) {
-            result = WinHttpSendRequest(hRequest, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
-                WINHTTP_NO_REQUEST_DATA, 0, 0, 0);
-        } else {
-            result = WinHttpSendRequest(hRequest, L"Content-Type: application/json\r\n", -1,
-                (LPVOID)body.c_str(), body.length(), body.length(), 0);
-        }
-
-        std::string response;
-        if (result && WinHttpReceiveResponse(hRequest, NULL)) {
-            DWORD dwSize = 0;
-            do {
-                DWORD dwDownloaded = 0;
-                if (!WinHttpQueryDataAvailable(hRequest, &dwSize)) break;
-
-                if (dwSize > 0) {
-                    std::vector<char> buffer(dwSize + 1);
-                    if (WinHttpReadData(hRequest, buffer.data(), dwSize, &dwDownloaded)) {
-                        buffer[dwDownloaded] = 0;
-                        response += buffer.data();
-                    }
-                }
-            } while (dwSize > 0);
-        }
-
-        WinHttpCloseHandle(hRequest);
-        WinHttpCloseHandle(hConnect);
-        WinHttpCloseHandle(hSession);
-
-        return response;
-    }
-
-    std::string GetGameflowPhase() {
-        std::string response = MakeLCURequest(L"/lol-gameflow/v1/gameflow-phase");
-        if (!response.empty()) {
-            // Remove quotes from JSON string response
-            if (response.front() == '"' && response.back() == '"') {
-                response = response.substr(1, response.length() - 2);
-            }
-        }
-        return response;
-    }
-
-    bool AcceptReadyCheck() {
-        std::string response = MakeLCURequest(L"/lol-matchmaking/v1/ready-check/accept", L"POST");
-        return !response.empty();
+        UpdateTrayIcon();
     }
 
     void CreateHiddenWindow() {
@@ -306,60 +194,45 @@ public:
         std::cout << "[>] Press F9 for emergency disable" << std::endl;
         std::cout << "[>] Check system tray for status" << std::endl;
 
-        running = true;
-        auto last_phase = std::string();
-        int consecutive_errors = 0;
-
-        while (running && !emergency_stop) {
-            try {
-                if (auto_accept_enabled) {
-                    std::string current_phase = GetGameflowPhase();
-
-                    if (!current_phase.empty()) {
-                        consecutive_errors = 0;
-
-                        if (current_phase != last_phase) {
-                            std::cout << "[>] Phase: " << current_phase << std::endl;
-                            last_phase = current_phase;
-                        }
-
-                        if (current_phase == "ReadyCheck") {
-                            std::cout << "[!] READY CHECK DETECTED - Auto-accepting..." << std::endl;
-
-                            if (AcceptReadyCheck()) {
-                                std::cout << "[+] Ready check accepted successfully!" << std::endl;
-                                ShowNotification("Ready check accepted!");
-                            } else {
-                                std::cout << "[!] Failed to accept ready check" << std::endl;
-                                ShowNotification("Failed to accept ready check");
-                            }
-                        }
-                    } else {
-                        consecutive_errors++;
-                        if (consecutive_errors == 5) {
-                            std::cout << "[!] Cannot connect to League client" << std::endl;
-                        }
-                    }
-                }
-
-                // Process Windows messages (for hotkeys and tray)
-                MSG msg;
-                while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
-                    if (msg.message == WM_QUIT) {
-                        running = false;
-                        break;
-                    }
-                    TranslateMessage(&msg);
-                    DispatchMessage(&msg);
-                }
+        league_auto_accept::core::EngineConfig engine_config;
+        engine_config.poll_schedule.active = std::chrono::milliseconds(config.polling_interval_ms);
+        engine_config.poll_schedule.idle = std::chrono::milliseconds(config.idle_polling_interval_ms);
+        engine_config.poll_schedule.dormant = std::chrono::milliseconds(config.dormant_polling_interval_ms);
+        if (!engine_config.poll_schedule.IsValid()) {
+            std::cout << "[!] Invalid polling intervals in config.json - using defaults" << std::endl;
+            engine_config.poll_schedule = league_auto_accept::core::PollSchedule();
+        }
+        engine_config.request_timeout = std::chrono::milliseconds(config.lcu_timeout_ms);
+        engine_config.elevate_priority_in_queue = config.elevate_priority_in_queue;
+
+        engine = std::make_unique<league_auto_accept::core::AutoAcceptEngine>(engine_config);
+        engine->SetAutoAcceptEnabled(auto_accept_enabled);
+        engine->SetLogCallback([this](std::string_view message) {
+            PrintLine("[>] " + std::string(message));
+        });
+        engine->SetPhaseCallback([this](const std::string& phase) {
+            PrintLine("[>] Phase: " + phase);
+        });
+        engine->SetAcceptCallback([this](const league_auto_accept::core::AcceptResult& result) {
+            PrintLine(result.accepted ? "[+] Ready check accepted successfully!"
+                                      : "[!] Failed to accept ready check");
+            // The tray icon belongs to the message thread
+            PostMessage(hidden_window, WM_ACCEPT_RESULT, result.accepted ? 1 : 0, 0);
+        });
 
-                std::this_thread::sleep_for(std::chrono::milliseconds(config.polling_interval_ms));
+        running = true;
+        engine->Start();
 
-            } catch (...) {
-                std::cout << "[X] Exception in main loop" << std::endl;
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            }
+        // Windows messages (hotkeys and tray) until Exit or the emergency hotkey
+        MSG msg;
+        while (running && GetMessage(&msg, NULL, 0, 0) > 0) {
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
         }
+        running = false;
+        engine->Stop();
+        std::cout << "[>] Adaptive polling saved " << engine->GetPollScheduler().GetRequestsSaved()
+                  << " requests" << std::endl;
 
         if (emergency_stop) {
             std::cout << "[!] EMERGENCY STOP activated!" << std::endl;
@@ -385,8 +258,8 @@ public:
                 if (wParam == 1) { // F9 emergency disable
                     if (app) {
                         app->emergency_stop = true;
-                        app->auto_accept_enabled = false;
-                        app->UpdateTrayIcon();
+                        app->SetAutoAcceptEnabled(false);
+                        PostQuitMessage(0);
                     }
                 }
                 break;
@@ -396,17 +269,18 @@ public:
                     if (app) app->ShowTrayMenu();
                 } else if (lParam == WM_LBUTTONUP) {
                     if (app) {
-                        app->auto_accept_enabled = !app->auto_accept_enabled;
-                        app->UpdateTrayIcon();
-                        if (app->auto_accept_enabled) {
-                            std::cout << "[+] Auto-accept ENABLED" << std::endl;
-                        } else {
-                            std::cout << "[!] Auto-accept DISABLED" << std::endl;
-                        }
+                        app->SetAutoAcceptEnabled(!app->auto_accept_enabled);
+                        app->PrintLine(app->auto_accept_enabled ? "[+] Auto-accept ENABLED" : "[!] Auto-accept DISABLED");
                     }
                 }
                 break;
 
+            case WM_ACCEPT_RESULT:
+                if (app) {
+                    app->ShowNotification(wParam ? "Ready check accepted!" : "Failed to accept ready check");
+                }
+                break;
+
             case WM_DESTROY:
                 PostQuitMessage(0);
                 break;
@@ -431,8 +305,7 @@ public:
 
         switch (cmd) {
             case 1: // Toggle auto-accept
-                auto_accept_enabled = !auto_accept_enabled;
-                UpdateTrayIcon();
+                SetAutoAcceptEnabled(!auto_accept_enabled);
                 break;
             case 2: // Exit
                 running = false;
@@ -447,6 +320,9 @@ public:
         std::cout << "[>] Shutting down..." << std::endl;
 
         running = false;
+        if (engine) {
+            engine->Stop();
+        }
 
         // Unregister hotkey
         UnregisterHotKey(hidden_window, 1);
@@ -1,19 +1,22 @@
 #include <windows.h>
-#include <winhttp.h>
 #include <shellapi.h>
 #include <commctrl.h>
+#include <algorithm>
 #include <string>
 #include <fstream>
-#include <sstream>
-#include <vector>
-#include <thread>
 #include <chrono>
 #include <atomic>
+#include <ctime>
+#include <memory>
+#include <vector>
+#include "league_auto_accept/core/auto_accept_engine.h"
+#include "league_auto_accept/core/log_history.h"
+#include "league_auto_accept/core/log_ring.h"
+#include "league_auto_accept/models/gameflow_state.h"
 // Resource definitions
 #define IDI_APP_ICON    101
 #define IDI_TRAY_ICON   102
 
-#pragma comment(lib, "winhttp.lib")
 #pragma comment(lib, "shell32.lib")
 #pragma comment(lib, "user32.lib")
 #pragma comment(lib, "gdi32.lib")
@@ -34,36 +37,15 @@
 #define IDM_EXIT 2003
 #define IDM_COPY_LOGS 2004
 #define IDM_SELECT_ALL_LOGS 2005
+#define IDT_LOG_FLUSH 3001
 #define WM_TRAY_CALLBACK WM_USER + 1
 #define WM_ADD_LOG WM_USER + 2
 
-// Base64 encoding for authentication
-std::string base64_encode(const std::string& input) {
-    static const char encoding_table[] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
-        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',
-        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-        'w', 'x', 'y', 'z', '0', '1', '2', '3',
-        '4', '5', '6', '7', '8', '9', '+', '/'
-    };
-
-    std::string encoded;
-    int val = 0, valb = -6;
-    for (unsigned char c : input) {
-        val = (val << 8) + c;
-        valb += 8;
-        while (valb >= 0) {
-            encoded.push_back(encoding_table[(val >> valb) & 0x3F]);
-            valb -= 6;
-        }
-    }
-    if (valb > -6) encoded.push_back(encoding_table[((val << 8) >> (valb + 8)) & 0x3F]);
-    while (encoded.size() % 4) encoded.push_back('=');
-    return encoded;
-}
+// Activity log: queued lines, lines kept on screen, and the backstop drain
+// for lines whose WM_ADD_LOG could not be posted
+#define LOG_QUEUE_CAPACITY 1024
+#define LOG_HISTORY_LINES 500
+#define LOG_FLUSH_INTERVAL_MS 250
 
 class LeagueAutoAcceptGUI {
 private:
@@ -79,23 +61,28 @@ private:
     NOTIFYICONDATAA nid = {0};
     HICON app_icon;
 
-    std::string lcu_token;
-    int lcu_port = 0;
+    // Detection loop; created per monitoring session with the current config
+    std::unique_ptr<league_auto_accept::core::AutoAcceptEngine> engine;
     std::atomic<bool> running{false};
     std::atomic<bool> auto_accept_enabled{false};
-    std::atomic<bool> emergency_stop{false};
-    std::thread worker_thread;
 
-    // Cache working endpoint to avoid repeated testing
-    std::string working_gameflow_endpoint = "";
-    bool endpoints_tested = false;
-    bool connection_logged = false;  // Track if we've logged connection for this session
+    // Log lines from any thread, drained by the UI thread in batches; one
+    // WM_ADD_LOG is outstanding at a time however many lines are queued
+    league_auto_accept::core::LogRing log_queue{LOG_QUEUE_CAPACITY};
+    std::atomic<bool> log_flush_posted{false};
+    // What the log control shows; the control's text mirrors it
+    league_auto_accept::core::LogHistory log_history{LOG_HISTORY_LINES};
+    std::vector<league_auto_accept::core::LogEntry> log_batch;
+    uint64_t reported_log_drops = 0;
 
     // Configuration
     struct Config {
         bool auto_accept_enabled = true;
-        int polling_interval_ms = 250;
+        int polling_interval_ms = 250;           // Matchmaking / ready check
+        int idle_polling_interval_ms = 2000;     // Lobby / no queue
+        int dormant_polling_interval_ms = 15000; // In game / end of game
         int lcu_timeout_ms = 5000;
+        bool elevate_priority_in_queue = false;  // Detection thread, Matchmaking / ready check
         std::string emergency_hotkey = "F9";
         bool enable_notifications = true;
         bool startup_enabled = false;
@@ -106,7 +93,7 @@ private:
 public:
     static LeagueAutoAcceptGUI* instance;
 
-    LeagueAutoAcceptGUI() : main_window(nullptr), app_icon(nullptr) {
+    LeagueAutoAcceptGUI() : main_window(nullptr), log_listbox(nullptr), app_icon(nullptr) {
         instance = this;
     }
 
@@ -178,6 +165,7 @@ public:
         }
 
         CreateControls();
+        SetTimer(main_window, IDT_LOG_FLUSH, LOG_FLUSH_INTERVAL_MS, nullptr);
         ShowWindow(main_window, SW_SHOW);
         UpdateWindow(main_window);
 
@@ -243,6 +231,8 @@ public:
             10, 140, 450, 180,
             main_window, (HMENU)IDC_LOG_LISTBOX, GetModuleHandle(nullptr), nullptr);
         SendMessage(log_listbox, WM_SETFONT, (WPARAM)default_font, TRUE);
+        // The line budget of log_history bounds the text, not the control
+        SendMessage(log_listbox, EM_SETLIMITTEXT, 0, 0);
 
         // Set a fixed-width font for better log readability
         HFONT mono_font = CreateFontA(
@@ -258,47 +248,68 @@ public:
                     auto_accept_enabled ? BST_CHECKED : BST_UNCHECKED, 0);
     }
 
+    // UI thread: queued behind any pending worker lines and shown right away
     void AddLogMessage(const std::string& message) {
-        // Get current time
-        SYSTEMTIME st;
-        GetLocalTime(&st);
-
-        char timestamp[32];
-        sprintf_s(timestamp, "[%02d:%02d:%02d] ", st.wHour, st.wMinute, st.wSecond);
+        log_queue.Push(message);
+        FlushLogs();
+    }
 
-        std::string full_message = timestamp + message + "\r\n";
+    // Shows every queued line with one edit of the log control: lines pushed
+    // out of log_history are cut from the front, the batch is appended
+    void FlushLogs() {
+        if (!log_listbox) return;
 
-        // Get current text length
-        int current_length = GetWindowTextLengthA(log_listbox);
+        log_batch.clear();
+        if (log_queue.Drain(log_batch) == 0) return;
 
-        // Limit log size to prevent memory issues (keep last 50KB of text)
-        if (current_length > 50000) {
-            // Get all text
-            char* all_text = new char[current_length + 1];
-            GetWindowTextA(log_listbox, all_text, current_length + 1);
+        uint64_t drops = log_queue.GetDroppedCount();
+        if (drops != reported_log_drops) {
+            log_batch.push_back({std::chrono::system_clock::now(),
+                                 std::to_string(drops - reported_log_drops) + " log lines dropped (log queue full)"});
+            reported_log_drops = drops;
+        }
 
-            // Keep only the last portion
-            std::string text_str(all_text);
-            delete[] all_text;
+        size_t shown_length = log_history.GetTextLength();
+        size_t evicted_length = 0;
+        std::string appended;
+        for (const auto& entry : log_batch) {
+            std::string line = FormatLogLine(entry);
+            appended += line;
+            evicted_length += log_history.Append(std::move(line));
+        }
 
-            // Find a good breaking point (after a newline)
-            size_t break_pos = text_str.find("\r\n", text_str.length() / 2);
-            if (break_pos != std::string::npos) {
-                text_str = text_str.substr(break_pos + 2);
+        SendMessage(log_listbox, WM_SETREDRAW, FALSE, 0);
+        if (evicted_length > shown_length) {
+            // The batch alone overflowed the history
+            SetWindowTextA(log_listbox, log_history.GetText().c_str());
+        } else {
+            if (evicted_length > 0) {
+                SendMessage(log_listbox, EM_SETSEL, 0, evicted_length);
+                SendMessageA(log_listbox, EM_REPLACESEL, FALSE, (LPARAM)"");
             }
-
-            SetWindowTextA(log_listbox, text_str.c_str());
-            current_length = text_str.length();
+            int end = GetWindowTextLengthA(log_listbox);
+            SendMessage(log_listbox, EM_SETSEL, end, end);
+            SendMessageA(log_listbox, EM_REPLACESEL, FALSE, (LPARAM)appended.c_str());
         }
-
-        // Move cursor to end and append new message
-        SendMessage(log_listbox, EM_SETSEL, current_length, current_length);
-        SendMessageA(log_listbox, EM_REPLACESEL, FALSE, (LPARAM)full_message.c_str());
+        SendMessage(log_listbox, WM_SETREDRAW, TRUE, 0);
+        InvalidateRect(log_listbox, nullptr, TRUE);
 
         // Auto-scroll to bottom
+        int end = GetWindowTextLengthA(log_listbox);
+        SendMessage(log_listbox, EM_SETSEL, end, end);
         SendMessage(log_listbox, EM_SCROLLCARET, 0, 0);
     }
 
+    static std::string FormatLogLine(const league_auto_accept::core::LogEntry& entry) {
+        std::time_t time = std::chrono::system_clock::to_time_t(entry.time);
+        std::tm local = {};
+        localtime_s(&local, &time);
+
+        char timestamp[32];
+        sprintf_s(timestamp, "[%02d:%02d:%02d] ", local.tm_hour, local.tm_min, local.tm_sec);
+        return timestamp + entry.message + "\r\n";
+    }
+
     void CopyLogsToClipboard() {
         // Select all text first
         SendMessage(log_listbox, EM_SETSEL, 0, -1);
@@ -365,6 +376,11 @@ public:
         SendMessage(enable_checkbox, BM_SETCHECK,
                     auto_accept_enabled ? BST_CHECKED : BST_UNCHECKED, 0);
 
+        // Keep the engine in step with the checkbox and tray toggles
+        if (engine) {
+            engine->SetAutoAcceptEnabled(auto_accept_enabled);
+        }
+
         // Update system tray tooltip
         UpdateTrayIcon();
     }
@@ -416,8 +432,27 @@ public:
     void StartMonitoring() {
         if (running) return;
 
+        league_auto_accept::core::EngineConfig engine_config;
+        engine_config.poll_schedule.active = std::chrono::milliseconds(config.polling_interval_ms);
+        engine_config.poll_schedule.idle = std::chrono::milliseconds(config.idle_polling_interval_ms);
+        engine_config.poll_schedule.dormant = std::chrono::milliseconds(config.dormant_polling_interval_ms);
+        if (!engine_config.poll_schedule.IsValid()) {
+            AddLogMessage("Invalid polling intervals in config.json - using defaults");
+            engine_config.poll_schedule = league_auto_accept::core::PollSchedule();
+        }
+        engine_config.request_timeout = std::chrono::milliseconds(config.lcu_timeout_ms);
+        engine_config.elevate_priority_in_queue = config.elevate_priority_in_queue;
+
+        engine = std::make_unique<league_auto_accept::core::AutoAcceptEngine>(engine_config);
+        engine->SetAutoAcceptEnabled(auto_accept_enabled);
+        engine->SetLogCallback([this](std::string_view message) { PostLogMessage(std::string(message)); });
+        engine->SetPhaseCallback([this](const std::string& phase) { OnPhaseChanged(phase); });
+        engine->SetAcceptCallback([this](const league_auto_accept::core::AcceptResult& result) {
+            OnReadyCheckAccepted(result);
+        });
+
         running = true;
-        worker_thread = std::thread([this]() { WorkerLoop(); });
+        engine->Start();
 
         AddLogMessage("Started monitoring League client");
         UpdateUI();
@@ -430,463 +465,51 @@ public:
         running = false;
         UpdateUI();
 
-        // Detach the worker thread immediately to avoid blocking
-        // The worker thread will exit on its own when it sees running = false
-        if (worker_thread.joinable()) {
-            AddLogMessage("Detaching worker thread to avoid UI freeze");
-            worker_thread.detach();
-        }
-
-        AddLogMessage("Stopped monitoring");
-    }
-
-    void WorkerLoop() {
-        AddLogMessage("Worker thread started");
-
-        std::string last_phase = "";
-        bool lcu_connected = false;
-        int connection_attempts = 0;
-        bool api_endpoints_tested = false;
-        std::chrono::steady_clock::time_point client_connect_time;
-        int api_test_delay_seconds = 3; // Wait 3 seconds after connection before testing APIs
-        bool ready_check_handled = false; // Track if we already handled current ready check
-
-        while (running && !emergency_stop) {
-            try {
-                // Try to read LCU lockfile
-                if (ReadLCULockfile()) {
-                    if (!lcu_connected) {
-                        lcu_connected = true;
-                        connection_attempts = 0;
-                        api_endpoints_tested = false;
-                        client_connect_time = std::chrono::steady_clock::now();
-                    }
-
-                    // Wait for client initialization
-                    if (lcu_connected && !api_endpoints_tested) {
-                        auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
-                            std::chrono::steady_clock::now() - client_connect_time
-                        ).count();
-
-                        if (elapsed >= api_test_delay_seconds) {
-                            api_endpoints_tested = true;
-                            working_gameflow_endpoint.clear(); // Clear cache to force retesting
-                        }
-                    }
-
-                    // Get current game phase
-                    std::string current_phase = GetGameflowPhase();
-
-                    if (!current_phase.empty()) {
-                        // Only log important phase changes
-                        if (current_phase != last_phase) {
-                            if (current_phase == "ReadyCheck" || current_phase == "Matchmaking" ||
-                                current_phase == "ChampSelect" || current_phase == "InGame") {
-                                AddLogMessage("Game phase: " + current_phase);
-                            }
-                            last_phase = current_phase;
-
-                            // Reset ready check handling when phase changes
-                            if (current_phase != "ReadyCheck") {
-                                ready_check_handled = false;
-                            }
-                        }
-
-                        // Check for ready check - multiple detection methods
-                        bool ready_check_detected = false;
-                        std::string detection_method = "";
-
-                        if (current_phase == "ReadyCheck") {
-                            ready_check_detected = true;
-                            detection_method = "gameflow phase";
-                        }
-                        else if (current_phase.empty() || current_phase == "None") {
-                            // Phase detection failed - try alternative methods
-                            if (CheckForReadyCheckAlternatives()) {
-                                ready_check_detected = true;
-                                detection_method = "alternative endpoint scanning";
-                            }
-                        }
-
-                        if (ready_check_detected && !ready_check_handled) {
-                            ready_check_handled = true; // Mark as handled to prevent repeated attempts
-
-                            if (auto_accept_enabled) {
-                                AddLogMessage("READY CHECK DETECTED via " + detection_method + " - Auto-accepting...");
-                                if (AcceptReadyCheck()) {
-                                    AddLogMessage("Ready check accepted successfully!");
-                                    if (config.show_notifications) {
-                                        ShowNotification("Ready check accepted!");
-                                    }
-                                } else {
-                                    AddLogMessage("Failed to accept ready check - all API methods failed");
-                                }
-                            } else {
-                                AddLogMessage("Ready check detected via " + detection_method + " but auto-accept is DISABLED");
-                            }
-                        }
-                    } else {
-                        // API call failed
-                        if (lcu_connected) {
-                            AddLogMessage("Failed to get game phase - LCU API error");
-                        }
-                    }
-                } else {
-                    // Could not read lockfile
-                    if (lcu_connected) {
-                        AddLogMessage("Lost connection to League client");
-                        lcu_connected = false;
-                        last_phase = "";
-                    } else {
-                        connection_attempts++;
-                        if (connection_attempts == 1) {
-                            AddLogMessage("Waiting for League client to start...");
-                        } else if (connection_attempts % 40 == 0) {  // Every 10 seconds (40 * 250ms)
-                            AddLogMessage("Still waiting for League client (make sure it's running)");
-                        }
-                    }
-                }
-
-                std::this_thread::sleep_for(std::chrono::milliseconds(config.polling_interval_ms));
-            } catch (const std::exception& e) {
-                AddLogMessage("Exception in worker loop: " + std::string(e.what()));
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            } catch (...) {
-                AddLogMessage("Unknown exception in worker loop");
-                std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-            }
-        }
-
-        if (emergency_stop) {
-            AddLogMessage("EMERGENCY STOP activated!");
-        }
-
-        AddLogMessage("Worker thread stopped");
-    }
-
-    // LCU API methods (same as original implementation)
-    bool ReadLCULockfile() {
-        // Try multiple potential League client lockfile locations
-        std::vector<std::string> potential_paths = {
-            std::string(getenv("LOCALAPPDATA")) + "\\Riot Games\\League of Legends\\lockfile",
-            "C:\\Riot Games\\League of Legends\\lockfile",
-            std::string(getenv("PROGRAMFILES")) + "\\Riot Games\\League of Legends\\lockfile",
-            std::string(getenv("PROGRAMFILES(X86)")) + "\\Riot Games\\League of Legends\\lockfile",
-            std::string(getenv("USERPROFILE")) + "\\AppData\\Local\\Riot Games\\League of Legends\\lockfile",
-            std::string(getenv("LOCALAPPDATA")) + "\\Riot Games\\Riot Client\\Config\\lockfile" // Riot Client as fallback
-        };
-
-        for (const std::string& lockfile_path : potential_paths) {
-            std::ifstream file(lockfile_path);
-            if (!file.is_open()) {
-                continue;
-            }
-
-            std::string line;
-            if (std::getline(file, line)) {
-                std::vector<std::string> parts;
-                std::stringstream ss(line);
-                std::string part;
-
-                while (std::getline(ss, part, ':')) {
-                    parts.push_back(part);
-                }
-
-                if (parts.size() >= 5) {
-                    lcu_port = std::stoi(parts[2]);
-                    lcu_token = parts[3];
-
-                    // Check if this is League client (not Riot Client)
-                    if (parts[0].find("League") != std::string::npos) {
-                        if (!connection_logged) {
-                            AddLogMessage("Connected to League client (port: " + std::to_string(lcu_port) + ")");
-                            connection_logged = true;
-                        }
-                        return true;
-                    } else if (parts[0].find("Riot Client") != std::string::npos) {
-                        file.close();
-                        continue; // Try next path - we want League client, not Riot client
-                    } else {
-                        if (!connection_logged) {
-                            AddLogMessage("Connected to " + parts[0] + " (port: " + std::to_string(lcu_port) + ")");
-                            connection_logged = true;
-                        }
-                        return true;
-                    }
-                }
-            }
-            file.close();
-        }
-
-        AddLogMessage("❌ Could not find League of Legends client lockfile");
-        return false;
-    }
-
-    std::string MakeLCURequest(const std::string& endpoint, const std::string& method = "GET") {
-        std::wstring host = L"127.0.0.1";
-        DWORD flags = WINHTTP_FLAG_SECURE;
-
-        // Silent connection - no debug spam
-
-        HINTERNET session = WinHttpOpen(L"LeagueAutoAccept/1.0",
-                                       WINHTTP_ACCESS_TYPE_NO_PROXY,
-                                       WINHTTP_NO_PROXY_NAME,
-                                       WINHTTP_NO_PROXY_BYPASS, 0);
-        if (!session) {
-            AddLogMessage("API Error: Failed to create HTTP session");
-            return "";
-        }
-
-        HINTERNET connect = WinHttpConnect(session, host.c_str(), lcu_port, 0);
-        if (!connect) {
-            AddLogMessage("API Error: Failed to connect to 127.0.0.1:" + std::to_string(lcu_port));
-            WinHttpCloseHandle(session);
-            return "";
-        }
-
-        std::wstring wendpoint(endpoint.begin(), endpoint.end());
-        std::wstring wmethod(method.begin(), method.end());
-
-        HINTERNET request = WinHttpOpenRequest(connect, wmethod.c_str(), wendpoint.c_str(),
-                                              nullptr, WINHTTP_NO_REFERER,
-                                              WINHTTP_DEFAULT_ACCEPT_TYPES, flags);
-        if (!request) {
-            AddLogMessage("API Error: Failed to create HTTP request for " + endpoint);
-            WinHttpCloseHandle(connect);
-            WinHttpCloseHandle(session);
-            return "";
-        }
-
-        // Skip SSL certificate verification
-        DWORD ssl_flags = SECURITY_FLAG_IGNORE_CERT_CN_INVALID |
-                         SECURITY_FLAG_IGNORE_CERT_DATE_INVALID |
-                         SECURITY_FLAG_IGNORE_UNKNOWN_CA;
-        if (!WinHttpSetOption(request, WINHTTP_OPTION_SECURITY_FLAGS, &ssl_flags, sizeof(ssl_flags))) {
-            AddLogMessage("API Warning: Failed to set SSL ignore flags");
-        }
-
-        // Add authorization header
-        std::string auth = "riot:" + lcu_token;
-        std::string encoded_auth = base64_encode(auth);
-        std::string auth_header = "Authorization: Basic " + encoded_auth;
-        std::wstring wauth_header(auth_header.begin(), auth_header.end());
-
-        if (!WinHttpAddRequestHeaders(request, wauth_header.c_str(), -1, WINHTTP_ADDREQ_FLAG_ADD)) {
-            // Silent - auth header failure is rare
-        }
-
-        if (!WinHttpSendRequest(request, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
-                               WINHTTP_NO_REQUEST_DATA, 0, 0, 0)) {
-            WinHttpCloseHandle(request);
-            WinHttpCloseHandle(connect);
-            WinHttpCloseHandle(session);
-            return "";
-        }
-
-        if (!WinHttpReceiveResponse(request, nullptr)) {
-            WinHttpCloseHandle(request);
-            WinHttpCloseHandle(connect);
-            WinHttpCloseHandle(session);
-            return "";
-        }
-
-        // Check HTTP status code silently
-        DWORD status_code = 0;
-        DWORD status_code_size = sizeof(status_code);
-        WinHttpQueryHeaders(request, WINHTTP_QUERY_STATUS_CODE | WINHTTP_QUERY_FLAG_NUMBER,
-                           WINHTTP_HEADER_NAME_BY_INDEX, &status_code, &status_code_size, WINHTTP_NO_HEADER_INDEX);
+        // The engine wakes its loop and joins it; no request outlives the LCU timeout
+        if (engine) {
+            engine->Stop();
 
-        std::string result;
-        DWORD bytes_available = 0;
-
-        do {
-            if (!WinHttpQueryDataAvailable(request, &bytes_available)) {
-                AddLogMessage("API Error: Failed to query data availability");
-                break;
-            }
-
-            if (bytes_available > 0) {
-                std::vector<char> buffer(bytes_available + 1);
-                DWORD bytes_read = 0;
-
-                if (WinHttpReadData(request, buffer.data(), bytes_available, &bytes_read)) {
-                    buffer[bytes_read] = '\0';
-                    result += buffer.data();
-                } else {
-                    AddLogMessage("API Error: Failed to read response data");
-                    break;
-                }
-            }
-        } while (bytes_available > 0);
-
-        WinHttpCloseHandle(request);
-        WinHttpCloseHandle(connect);
-        WinHttpCloseHandle(session);
-
-        if (result.empty()) {
-            AddLogMessage("API Error: Empty response from " + endpoint);
-        }
-
-        return result;
-    }
-
-    std::string GetGameflowPhase() {
-        // If we have a working endpoint cached, use it
-        if (!working_gameflow_endpoint.empty()) {
-            std::string response = MakeLCURequest(working_gameflow_endpoint);
-            if (!response.empty() && response.find("errorCode") == std::string::npos) {
-                return ParseGameflowResponse(response, working_gameflow_endpoint);
-            } else {
-                working_gameflow_endpoint = "";
-            }
+            const auto& scheduler = engine->GetPollScheduler();
+            AddLogMessage("Adaptive polling: " + std::to_string(scheduler.GetPollCount()) + " polls, " +
+                          std::to_string(scheduler.GetRequestsSaved()) + " requests saved");
         }
 
-        // Try the primary gameflow endpoint
-        std::string response = MakeLCURequest("/lol-gameflow/v1/gameflow-phase");
-        if (!response.empty() && response.find("errorCode") == std::string::npos) {
-            working_gameflow_endpoint = "/lol-gameflow/v1/gameflow-phase";
-            return ParseGameflowResponse(response, working_gameflow_endpoint);
-        }
-
-        return "";
+        AddLogMessage("Stopped monitoring");
     }
 
-    std::string ParseGameflowResponse(const std::string& response, const std::string& endpoint) {
-        if (endpoint == "/lol-gameflow/v1/gameflow-phase") {
-            // Direct phase response - should be just "None", "Lobby", etc.
-            size_t start = response.find("\"");
-            if (start != std::string::npos) {
-                start += 1;
-                size_t end = response.find("\"", start);
-                if (end != std::string::npos) {
-                    return response.substr(start, end - start);
-                }
-            }
-        }
-        else if (endpoint == "/lol-gameflow/v1/session") {
-            // Parse session object for phase
-            size_t phase_pos = response.find("\"phase\":");
-            if (phase_pos != std::string::npos) {
-                size_t quote_start = response.find("\"", phase_pos + 8);
-                if (quote_start != std::string::npos) {
-                    size_t quote_end = response.find("\"", quote_start + 1);
-                    if (quote_end != std::string::npos) {
-                        return response.substr(quote_start + 1, quote_end - quote_start - 1);
-                    }
-                }
-            }
-        }
-        else if (endpoint == "/lol-lobby/v2/lobby") {
-            // Lobby exists = we're in lobby
-            if (response.find("\"gameConfig\"") != std::string::npos) {
-                return "Lobby";
-            }
-        }
-        else if (endpoint == "/lol-matchmaking/v1/search") {
-            // Matchmaking active
-            if (response.find("\"searchState\"") != std::string::npos &&
-                response.find("\"Searching\"") != std::string::npos) {
-                return "Matchmaking";
-            }
-        }
-        else if (endpoint == "/lol-champ-select/v1/session") {
-            // Champion select active
-            if (response.find("\"phase\"") != std::string::npos) {
-                return "ChampSelect";
-            }
+    // Engine callbacks run on its detection thread, which StopMonitoring joins
+    // from the UI thread; a synchronous SendMessage from there could deadlock.
+    // The line is queued without blocking and the window woken to drain it.
+    void PostLogMessage(const std::string& message) {
+        log_queue.Push(message);
+        if (!log_flush_posted.exchange(true) && !PostMessageA(main_window, WM_ADD_LOG, 0, 0)) {
+            log_flush_posted = false; // The flush timer picks it up
         }
-
-        return "";
     }
 
-    bool CheckForReadyCheckAlternatives() {
-        // Test multiple ready check detection endpoints
-        std::vector<std::pair<std::string, std::string>> ready_endpoints = {
-            {"/lol-matchmaking/v1/ready-check", "ready check status"},
-            {"/lol-matchmaking/v1/search", "matchmaking search state"},
-            {"/lol-gameflow/v1/gameflow-phase", "gameflow phase check"},
-            {"/lol-lobby/v2/ready-check", "lobby ready check"},
-            {"/lol-gameflow/v1/session", "gameflow session check"}
-        };
-
-        for (const auto& endpoint_pair : ready_endpoints) {
-            const std::string& endpoint = endpoint_pair.first;
-            const std::string& description = endpoint_pair.second;
-
-            std::string response = MakeLCURequest(endpoint);
-            if (!response.empty() && response.find("errorCode") == std::string::npos) {
-                AddLogMessage("Testing " + description + ":");
-
-                // Check for ready check indicators
-                if (response.find("\"state\":\"InProgress\"") != std::string::npos ||
-                    response.find("\"readyCheck\"") != std::string::npos ||
-                    response.find("\"ReadyCheck\"") != std::string::npos ||
-                    response.find("\"playerResponse\":\"None\"") != std::string::npos) {
-
-                    AddLogMessage("  ✓ Ready check detected via " + description);
-                    AddLogMessage("  Response: " + response.substr(0, 150) + "...");
-                    return true;
-                }
-            }
+    void OnPhaseChanged(const std::string& phase) {
+        // Only log important phase changes
+        switch (league_auto_accept::models::GameflowPhaseFromWire(phase)) {
+        case league_auto_accept::models::GameflowPhase::MATCHMAKING:
+        case league_auto_accept::models::GameflowPhase::READY_CHECK:
+        case league_auto_accept::models::GameflowPhase::CHAMPION_SELECT:
+        case league_auto_accept::models::GameflowPhase::IN_PROGRESS:
+            PostLogMessage("Game phase: " + phase);
+            break;
+        default:
+            break;
         }
-        return false;
     }
 
-    bool AcceptReadyCheck() {
-        AddLogMessage("=== READY CHECK ACCEPTANCE ATTEMPT ===");
-
-        // First try to get ready check status
-        std::string status_response = MakeLCURequest("/lol-matchmaking/v1/ready-check");
-        if (!status_response.empty() && status_response.find("errorCode") == std::string::npos) {
-            AddLogMessage("Ready check status: " + status_response.substr(0, 100) + "...");
-
-            // Check if already accepted
-            if (status_response.find("\"playerResponse\":\"Accepted\"") != std::string::npos) {
-                AddLogMessage("✓ Ready check already accepted - skipping");
-                return true;
+    void OnReadyCheckAccepted(const league_auto_accept::core::AcceptResult& result) {
+        if (result.accepted) {
+            PostLogMessage("Ready check accepted successfully!");
+            if (config.show_notifications) {
+                ShowNotification("Ready check accepted!");
             }
+        } else {
+            PostLogMessage("Failed to accept ready check - all API methods failed");
         }
-
-        // Try multiple acceptance endpoints (primary endpoint first)
-        std::vector<std::string> accept_endpoints = {
-            "/lol-matchmaking/v1/ready-check/accept",  // Primary endpoint per Riot docs
-            "/lol-lobby/v2/ready-check/accept",
-            "/lol-gameflow/v1/ready-check/accept"
-        };
-
-        for (const std::string& endpoint : accept_endpoints) {
-            AddLogMessage("Trying acceptance via: " + endpoint);
-            std::string response = MakeLCURequest(endpoint, "POST");
-
-            if (response.empty()) {
-                AddLogMessage("  → Empty response");
-                continue;
-            }
-
-            // Check for success response
-            if (response.find("errorCode") != std::string::npos) {
-                // Extract error details
-                size_t error_start = response.find("\"errorCode\":");
-                if (error_start != std::string::npos) {
-                    size_t quote_start = response.find("\"", error_start + 12);
-                    if (quote_start != std::string::npos) {
-                        size_t quote_end = response.find("\"", quote_start + 1);
-                        if (quote_end != std::string::npos) {
-                            std::string error_code = response.substr(quote_start + 1, quote_end - quote_start - 1);
-                            AddLogMessage("  → Error: " + error_code);
-                        }
-                    }
-                }
-                continue;
-            }
-
-            AddLogMessage("  ✓ Success! Response: " + response.substr(0, 100) + "...");
-            AddLogMessage("=== READY CHECK ACCEPTED SUCCESSFULLY ===");
-            return true;
-        }
-
-        AddLogMessage("=== ALL ACCEPTANCE METHODS FAILED ===");
-        return false;
     }
 
     void ShowNotification(const std::string& message) {
@@ -903,6 +526,24 @@ public:
         AddLogMessage("Emergency hotkey registered (F9)");
     }
 
+    // Integer value of a `"key": value,` config line
+    static void ReadConfigInt(const std::string& line, int& value) {
+        size_t pos = line.find(":");
+        if (pos == std::string::npos) return;
+        pos++;
+        size_t end = line.find(",", pos);
+        if (end == std::string::npos) end = line.find("}", pos);
+        if (end == std::string::npos) end = line.size();
+
+        std::string text = line.substr(pos, end - pos);
+        text.erase(std::remove_if(text.begin(), text.end(), ::isspace), text.end());
+        try {
+            value = std::stoi(text);
+        } catch (const std::exception&) {
+            // Keep the default
+        }
+    }
+
     bool LoadConfiguration() {
         std::ifstream file("config.json");
         if (!file.is_open()) {
@@ -917,14 +558,19 @@ public:
                 config.auto_accept_enabled = line.find("true") != std::string::npos;
             }
             else if (line.find("\"polling_interval_ms\"") != std::string::npos) {
-                size_t pos = line.find(":") + 1;
-                size_t end = line.find(",", pos);
-                if (end == std::string::npos) end = line.find("}", pos);
-                if (pos != std::string::npos && end != std::string::npos) {
-                    std::string value = line.substr(pos, end - pos);
-                    value.erase(std::remove_if(value.begin(), value.end(), ::isspace), value.end());
-                    config.polling_interval_ms = std::stoi(value);
-                }
+                ReadConfigInt(line, config.polling_interval_ms);
+            }
+            else if (line.find("\"idle_polling_interval_ms\"") != std::string::npos) {
+                ReadConfigInt(line, config.idle_polling_interval_ms);
+            }
+            else if (line.find("\"dormant_polling_interval_ms\"") != std::string::npos) {
+                ReadConfigInt(line, config.dormant_polling_interval_ms);
+            }
+            else if (line.find("\"lcu_timeout_ms\"") != std::string::npos) {
+                ReadConfigInt(line, config.lcu_timeout_ms);
+            }
+            else if (line.find("\"elevate_priority_in_queue\"") != std::string::npos) {
+                config.elevate_priority_in_queue = line.find("true") != std::string::npos;
             }
         }
 
@@ -937,7 +583,10 @@ public:
             file << "{\n";
             file << "  \"auto_accept_enabled\": " << (config.auto_accept_enabled ? "true" : "false") << ",\n";
             file << "  \"polling_interval_ms\": " << config.polling_interval_ms << ",\n";
+            file << "  \"idle_polling_interval_ms\": " << config.idle_polling_interval_ms << ",\n";
+            file << "  \"dormant_polling_interval_ms\": " << config.dormant_polling_interval_ms << ",\n";
             file << "  \"lcu_timeout_ms\": " << config.lcu_timeout_ms << ",\n";
+            file << "  \"elevate_priority_in_queue\": " << (config.elevate_priority_in_queue ? "true" : "false") << ",\n";
             file << "  \"emergency_hotkey\": \"" << config.emergency_hotkey << "\",\n";
             file << "  \"enable_notifications\": " << (config.enable_notifications ? "true" : "false") << ",\n";
             file << "  \"startup_enabled\": " << (config.startup_enabled ? "true" : "false") << ",\n";
@@ -959,8 +608,8 @@ public:
     }
 
     void Shutdown() {
-        emergency_stop = true;
         StopMonitoring();
+        KillTimer(main_window, IDT_LOG_FLUSH);
 
         // Remove system tray icon
         Shell_NotifyIconA(NIM_DELETE, &nid);
@@ -1044,6 +693,18 @@ public:
             }
             break;
 
+        case WM_ADD_LOG:
+            log_flush_posted = false;
+            FlushLogs();
+            return 0;
+
+        case WM_TIMER:
+            if (wParam == IDT_LOG_FLUSH) {
+                FlushLogs();
+                return 0;
+            }
+            break;
+
         case WM_TRAY_CALLBACK:
             if (lParam == WM_RBUTTONUP) {
                 ShowTrayMenu();
@@ -1057,7 +718,6 @@ public:
 
         case WM_HOTKEY:
             if (wParam == 1) { // F9 emergency hotkey
-                emergency_stop = true;
                 auto_accept_enabled = false;
                 StopMonitoring();
                 AddLogMessage("EMERGENCY STOP activated! (F9 pressed)");
@@ -1,23 +1,68 @@
 #include "league_auto_accept/models/gameflow_state.h"
+#include <algorithm>
 #include <stdexcept>
 
 namespace league_auto_accept {
 namespace models {
 
+static_assert(GameflowPhaseFromWire("ReadyCheck") == GameflowPhase::READY_CHECK, "phase hash");
+static_assert(GameflowPhaseFromWire("InGame") == GameflowPhase::IN_PROGRESS, "phase hash");
+static_assert(GameflowPhaseFromWire("Unknown") == GameflowPhase::UNKNOWN, "phase hash");
+static_assert(GameflowPhaseFromWire("ReadyChecks") == GameflowPhase::UNKNOWN, "phase hash");
+static_assert(IsValidGameflowTransition(GameflowPhase::MATCHMAKING, GameflowPhase::READY_CHECK), "transitions");
+static_assert(!IsValidGameflowTransition(GameflowPhase::MATCHMAKING, GameflowPhase::IN_PROGRESS), "transitions");
+static_assert(!IsValidGameflowTransition(GameflowPhase::LOBBY, GameflowPhase::LOBBY), "transitions");
+static_assert(IsValidGameflowTransition(GameflowPhase::IN_PROGRESS, GameflowPhase::NONE), "transitions");
+
 GameflowState::GameflowState()
     : phase_(GameflowPhase::NONE)
     , ready_check_active_(false)
     , ready_check_duration_(0)
     , ready_check_remaining_(0)
     , last_detection_time_(std::chrono::steady_clock::now())
-    , detection_source_(DetectionSource::LCU_API) {
+    , detection_source_(DetectionSource::LCU_API)
+    , detection_latency_(0)
+    , next_observer_id_(0) {
 }
 
 void GameflowState::SetPhase(GameflowPhase phase) {
+    if (phase == phase_) {
+        UpdateDetectionTime();
+        return;
+    }
     if (!CanTransitionTo(phase)) {
         throw std::invalid_argument("Invalid phase transition from " + 
             GetPhaseString() + " to " + GameflowPhaseToString(phase));
     }
+    ChangePhase(phase);
+}
+
+bool GameflowState::ApplyObservedPhase(GameflowPhase phase) {
+    UpdateDetectionTime();
+    if (phase == phase_) {
+        return false;
+    }
+    ChangePhase(phase);
+    return true;
+}
+
+size_t GameflowState::AddTransitionObserver(TransitionObserver observer) {
+    if (!observer) {
+        throw std::invalid_argument("Transition observer cannot be empty");
+    }
+    size_t id = next_observer_id_++;
+    observers_.emplace_back(id, std::move(observer));
+    return id;
+}
+
+void GameflowState::RemoveTransitionObserver(size_t id) {
+    observers_.erase(std::remove_if(observers_.begin(), observers_.end(),
+                                    [id](const auto& entry) { return entry.first == id; }),
+                     observers_.end());
+}
+
+void GameflowState::ChangePhase(GameflowPhase phase) {
+    GameflowPhase from = phase_;
     phase_ = phase;
     UpdateDetectionTime();
     
@@ -27,6 +72,10 @@ void GameflowState::SetPhase(GameflowPhase phase) {
         ready_check_duration_ = 0;
         ready_check_remaining_ = 0;
     }
+
+    for (const auto& entry : observers_) {
+        entry.second(from, phase);
+    }
 }
 
 void GameflowState::SetReadyCheckActive(bool active) {
@@ -56,8 +105,12 @@ void GameflowState::SetReadyCheckRemaining(int remaining) {
     ready_check_remaining_ = remaining;
 }
 
-void GameflowState::SetDetectionSource(DetectionSource source) {
+void GameflowState::SetDetectionSource(DetectionSource source, std::chrono::microseconds latency) {
+    if (latency.count() < 0) {
+        throw std::invalid_argument("Detection latency cannot be negative");
+    }
     detection_source_ = source;
+    detection_latency_ = latency;
     UpdateDetectionTime();
 }
 
@@ -72,16 +125,20 @@ bool GameflowState::IsStateRecent(std::chrono::seconds max_age) const {
 }
 
 void GameflowState::Reset() {
-    phase_ = GameflowPhase::NONE;
-    ready_check_active_ = false;
-    ready_check_duration_ = 0;
-    ready_check_remaining_ = 0;
     detection_source_ = DetectionSource::LCU_API;
-    UpdateDetectionTime();
+    detection_latency_ = std::chrono::microseconds(0);
+    if (phase_ != GameflowPhase::NONE) {
+        ChangePhase(GameflowPhase::NONE);
+    } else {
+        ready_check_active_ = false;
+        ready_check_duration_ = 0;
+        ready_check_remaining_ = 0;
+        UpdateDetectionTime();
+    }
 }
 
 bool GameflowState::CanTransitionTo(GameflowPhase new_phase) const {
-    return IsValidTransition(phase_, new_phase);
+    return new_phase == phase_ || IsValidGameflowTransition(phase_, new_phase);
 }
 
 void GameflowState::TransitionTo(GameflowPhase new_phase) {
@@ -110,34 +167,6 @@ bool GameflowState::IsValid() const {
     }
 }
 
-bool GameflowState::IsValidTransition(GameflowPhase from, GameflowPhase to) const {
-    // Allow any transition to/from NONE (represents unknown state)
-    if (from == GameflowPhase::NONE || to == GameflowPhase::NONE) {
-        return true;
-    }
-    
-    // Define valid transitions based on League client workflow
-    switch (from) {
-    case GameflowPhase::LOBBY:
-        return to == GameflowPhase::MATCHMAKING || to == GameflowPhase::IN_GAME;
-        
-    case GameflowPhase::MATCHMAKING:
-        return to == GameflowPhase::READY_CHECK || to == GameflowPhase::LOBBY;
-        
-    case GameflowPhase::READY_CHECK:
-        return to == GameflowPhase::CHAMPION_SELECT || to == GameflowPhase::LOBBY;
-        
-    case GameflowPhase::CHAMPION_SELECT:
-        return to == GameflowPhase::IN_GAME || to == GameflowPhase::LOBBY;
-        
-    case GameflowPhase::IN_GAME:
-        return to == GameflowPhase::LOBBY;
-        
-    default:
-        return false;
-    }
-}
-
 void GameflowState::ValidateReadyCheckTiming() const {
     if (ready_check_remaining_ > ready_check_duration_) {
         throw std::runtime_error("Ready check remaining time exceeds duration");
@@ -150,26 +179,18 @@ void GameflowState::ValidateReadyCheckTiming() const {
 
 // Utility functions
 std::string GameflowPhaseToString(GameflowPhase phase) {
-    switch (phase) {
-    case GameflowPhase::NONE: return "None";
-    case GameflowPhase::LOBBY: return "Lobby";
-    case GameflowPhase::MATCHMAKING: return "Matchmaking";
-    case GameflowPhase::READY_CHECK: return "ReadyCheck";
-    case GameflowPhase::CHAMPION_SELECT: return "ChampSelect";
-    case GameflowPhase::IN_GAME: return "InGame";
-    default: return "Unknown";
+    if (static_cast<size_t>(phase) >= GAMEFLOW_PHASE_COUNT) {
+        return "Unknown";
     }
+    return std::string(GameflowPhaseName(phase));
 }
 
 GameflowPhase StringToGameflowPhase(const std::string& phase_str) {
-    if (phase_str == "None") return GameflowPhase::NONE;
-    if (phase_str == "Lobby") return GameflowPhase::LOBBY;
-    if (phase_str == "Matchmaking") return GameflowPhase::MATCHMAKING;
-    if (phase_str == "ReadyCheck") return GameflowPhase::READY_CHECK;
-    if (phase_str == "ChampSelect") return GameflowPhase::CHAMPION_SELECT;
-    if (phase_str == "InGame") return GameflowPhase::IN_GAME;
-    
-    throw std::invalid_argument("Unknown gameflow phase: " + phase_str);
+    GameflowPhase phase;
+    if (!TryParseGameflowPhase(phase_str, phase)) {
+        throw std::invalid_argument("Unknown gameflow phase: " + phase_str);
+    }
+    return phase;
 }
 
 std::string DetectionSourceToString(DetectionSource source) {
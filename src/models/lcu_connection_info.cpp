@@ -1,10 +1,16 @@
 #include "league_auto_accept/models/lcu_connection_info.h"
-#include <fstream>
-#include <sstream>
+#include "league_auto_accept/core/lockfile_watcher.h"
+#include "league_auto_accept/core/process_tracker.h"
+#include <algorithm>
 #include <stdexcept>
+
+#ifdef _WIN32
 #include <shlobj.h>
 #include <windows.h>
-#include <tlhelp32.h>
+#else
+#include <cerrno>
+#include <signal.h>
+#endif
 
 namespace league_auto_accept {
 namespace models {
@@ -33,44 +39,24 @@ bool LCUConnectionInfo::DiscoverFromLockfile() {
 bool LCUConnectionInfo::DiscoverFromLockfile(const std::filesystem::path& lockfile_path) {
     lockfile_path_ = lockfile_path;
 
-    if (!std::filesystem::exists(lockfile_path)) {
+    // Cached until the file system reports a change to the lockfile
+    core::LockfileInfo info;
+    if (!core::ReadWatchedLockfile(lockfile_path.string(), info)) {
         SetConnectionState(LCUConnectionState::DISCONNECTED);
         return false;
     }
 
-    try {
-        std::ifstream file(lockfile_path);
-        if (!file.is_open()) {
-            SetConnectionState(LCUConnectionState::ERROR_STATE);
-            return false;
-        }
-
-        std::string content;
-        std::getline(file, content);
-
-        if (!ValidateLockfileFormat(content)) {
-            SetConnectionState(LCUConnectionState::ERROR_STATE);
-            return false;
-        }
-
-        SetConnectionState(LCUConnectionState::CONNECTING);
-
-        if (ParseLockfileContent(content)) {
-            // Verify the process is still running
-            if (IsLeagueProcessRunning(process_id_)) {
-                ConstructBaseURL();
-                SetConnectionState(LCUConnectionState::CONNECTED);
-                ClearConnectionErrors();
-                return true;
-            }
-        }
-
-        SetConnectionState(LCUConnectionState::ERROR_STATE);
-        return false;
-    } catch (const std::exception&) {
-        SetConnectionState(LCUConnectionState::ERROR_STATE);
-        return false;
+    SetConnectionState(LCUConnectionState::CONNECTING);
+
+    if (ApplyLockfileInfo(info) && IsLeagueProcessRunning(process_id_)) {
+        ConstructBaseURL();
+        SetConnectionState(LCUConnectionState::CONNECTED);
+        ClearConnectionErrors();
+        return true;
     }
+
+    SetConnectionState(LCUConnectionState::ERROR_STATE);
+    return false;
 }
 
 void LCUConnectionInfo::SetConnectionState(LCUConnectionState state) {
@@ -91,12 +77,9 @@ void LCUConnectionInfo::UpdateLastSuccessfulRequest() {
 }
 
 void LCUConnectionInfo::IncrementConnectionErrors() {
+    // Only counted: the LCU client's circuit breakers decide when the
+    // client stops being asked, and a reconnect when it is gone
     connection_errors_++;
-
-    // After multiple consecutive errors, consider connection lost
-    if (connection_errors_ >= 5) {
-        SetConnectionState(LCUConnectionState::ERROR_STATE);
-    }
 }
 
 void LCUConnectionInfo::ClearConnectionErrors() {
@@ -157,20 +140,29 @@ std::string LCUConnectionInfo::GetFullAPIURL(const std::string& endpoint) const
 }
 
 std::filesystem::path LCUConnectionInfo::GetDefaultLockfilePath() {
+#ifdef _WIN32
     wchar_t* local_appdata = nullptr;
     if (SHGetKnownFolderPath(FOLDERID_LocalAppData, 0, nullptr, &local_appdata) == S_OK) {
         std::filesystem::path path(local_appdata);
         CoTaskMemFree(local_appdata);
         return path / "Riot Games" / "Riot Client" / "Config" / "lockfile";
     }
+#else
+    // No League client here; $LAA_LOCKFILE may point at a stand-in's
+    std::vector<std::string> paths = core::GetDefaultLockfilePaths();
+    if (!paths.empty()) {
+        return paths.front();
+    }
+#endif
 
     // Fallback
     return std::filesystem::temp_directory_path() / "lockfile";
 }
 
-bool LCUConnectionInfo::IsLeagueProcessRunning(DWORD process_id) {
+bool LCUConnectionInfo::IsLeagueProcessRunning(uint32_t process_id) {
     if (process_id == 0) return false;
 
+#ifdef _WIN32
     HANDLE process = OpenProcess(PROCESS_QUERY_INFORMATION, FALSE, process_id);
     if (process == NULL) return false;
 
@@ -179,60 +171,36 @@ bool LCUConnectionInfo::IsLeagueProcessRunning(DWORD process_id) {
     CloseHandle(process);
 
     return is_running;
-}
-
-DWORD LCUConnectionInfo::FindLeagueProcessId() {
-    HANDLE snapshot = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
-    if (snapshot == INVALID_HANDLE_VALUE) return 0;
-
-    PROCESSENTRY32W pe32;
-    pe32.dwSize = sizeof(PROCESSENTRY32W);
-
-    if (Process32FirstW(snapshot, &pe32)) {
-        do {
-            if (wcscmp(pe32.szExeFile, L"LeagueClient.exe") == 0) {
-                CloseHandle(snapshot);
-                return pe32.th32ProcessID;
-            }
-        } while (Process32NextW(snapshot, &pe32));
+#else
+    // EPERM: running, only under another user
+    return ::kill(static_cast<pid_t>(process_id), 0) == 0 || errno == EPERM;
+#endif
+}
+
+uint32_t LCUConnectionInfo::FindLeagueProcessId() {
+    // ToolHelp snapshot on Windows, /proc elsewhere
+    core::ProcessTracker tracker(core::CreatePlatformProcessSource());
+    uint32_t process_id = 0;
+    if (!tracker.Update() || !tracker.FindProcess("LeagueClient.exe", process_id)) {
+        return 0;
     }
-
-    CloseHandle(snapshot);
-    return 0;
+    return process_id;
 }
 
 bool LCUConnectionInfo::ParseLockfileContent(const std::string& content) {
     // Lockfile format: LeagueClient:PID:PORT:PASSWORD:PROTOCOL
-    std::istringstream iss(content);
-    std::string token;
-    std::vector<std::string> tokens;
-
-    while (std::getline(iss, token, ':')) {
-        tokens.push_back(token);
-    }
-
-    if (tokens.size() != 5) return false;
-
-    try {
-        // tokens[0] should be "LeagueClient"
-        if (tokens[0] != "LeagueClient") return false;
-
-        // Parse process ID
-        process_id_ = static_cast<DWORD>(std::stoul(tokens[1]));
-
-        // Parse port
-        port_ = std::stoi(tokens[2]);
+    core::LockfileInfo info;
+    return core::ParseLockfile(content, info) && ApplyLockfileInfo(info);
+}
 
-        // Auth token (password)
-        auth_token_ = tokens[3];
+bool LCUConnectionInfo::ApplyLockfileInfo(const core::LockfileInfo& info) {
+    if (info.process_name != "LeagueClient" || info.protocol != "https") return false;
 
-        // Protocol should be "https"
-        if (tokens[4] != "https") return false;
+    process_id_ = static_cast<uint32_t>(info.process_id);
+    port_ = info.port;
+    auth_token_ = info.password;
 
-        return ValidatePort() && !auth_token_.empty() && process_id_ > 0;
-    } catch (const std::exception&) {
-        return false;
-    }
+    return ValidatePort() && !auth_token_.empty() && process_id_ > 0;
 }
 
 void LCUConnectionInfo::ConstructBaseURL() {
@@ -1,21 +1,18 @@
 #include "league_auto_accept/models/performance_metrics.h"
-#include <windows.h>
-#include <psapi.h>
-#include <algorithm>
-#include <stdexcept>
+#include "league_auto_accept/core/process_stats.h"
 
 namespace league_auto_accept {
 namespace models {
 
+constexpr std::chrono::minutes PerformanceMetrics::LATENCY_TARGET_WINDOW;
+
 PerformanceMetrics::PerformanceMetrics()
     : detection_latency_ms_(0)
     , acceptance_latency_ms_(0)
-    , detection_count_(0)
-    , total_detection_latency_(0)
-    , acceptance_count_(0)
-    , total_acceptance_latency_(0)
+    , missed_ticks_(0)
     , total_matches_detected_(0)
     , total_matches_accepted_(0)
+    , accept_deadline_misses_(0)
     , memory_usage_mb_(0.0)
     , cpu_usage_percent_(0.0)
     , last_error_time_(std::chrono::system_clock::now())
@@ -23,6 +20,10 @@ PerformanceMetrics::PerformanceMetrics()
     , total_errors_(0)
     , start_time_(std::chrono::steady_clock::now()) {
     
+    for (size_t i = 0; i < core::ACCEPT_STAGE_COUNT; ++i) {
+        accept_stage_last_us_[i].store(0);
+    }
+
     // Initialize with current system metrics
     UpdateMemoryUsage();
     UpdateCPUUsage();
@@ -81,18 +82,39 @@ int PerformanceMetrics::GetTotalErrors() const {
     return total_errors_.load();
 }
 
-void PerformanceMetrics::RecordDetectionLatency(std::chrono::milliseconds latency) {
-    int latency_ms = static_cast<int>(latency.count());
-    detection_latency_ms_.store(latency_ms);
-    detection_count_.fetch_add(1);
-    total_detection_latency_.fetch_add(latency_ms);
+void PerformanceMetrics::RecordDetectionLatency(std::chrono::microseconds latency) {
+    detection_latency_ms_.store(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(latency).count()));
+    detection_histogram_.Record(latency);
+    recent_detection_.Record(latency);
+}
+
+void PerformanceMetrics::RecordAcceptanceLatency(std::chrono::microseconds latency) {
+    acceptance_latency_ms_.store(static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(latency).count()));
+    acceptance_histogram_.Record(latency);
+    recent_acceptance_.Record(latency);
 }
 
-void PerformanceMetrics::RecordAcceptanceLatency(std::chrono::milliseconds latency) {
-    int latency_ms = static_cast<int>(latency.count());
-    acceptance_latency_ms_.store(latency_ms);
-    acceptance_count_.fetch_add(1);
-    total_acceptance_latency_.fetch_add(latency_ms);
+void PerformanceMetrics::RecordAcceptStageLatency(core::AcceptStage stage, std::chrono::microseconds latency) {
+    size_t index = static_cast<size_t>(stage);
+    accept_stage_last_us_[index].store(latency.count());
+    accept_stage_histograms_[index].Record(latency);
+}
+
+void PerformanceMetrics::RecordAcceptResult(const core::AcceptResult& result) {
+    RecordAcceptStageLatency(core::AcceptStage::DISPATCH, result.GetStageLatency(core::AcceptStage::DISPATCH));
+    RecordAcceptStageLatency(core::AcceptStage::POST, result.GetStageLatency(core::AcceptStage::POST));
+    if (result.GetStageLatency(core::AcceptStage::VERIFY).count() > 0) {
+        RecordAcceptStageLatency(core::AcceptStage::VERIFY, result.GetStageLatency(core::AcceptStage::VERIFY));
+    }
+    RecordAcceptStageLatency(core::AcceptStage::TOTAL, result.GetStageLatency(core::AcceptStage::TOTAL));
+}
+
+void PerformanceMetrics::RecordTickJitter(std::chrono::microseconds jitter) {
+    tick_jitter_histogram_.Record(jitter);
+}
+
+void PerformanceMetrics::RecordMissedTicks(int count) {
+    missed_ticks_.fetch_add(count);
 }
 
 void PerformanceMetrics::RecordMatchDetected() {
@@ -104,6 +126,10 @@ void PerformanceMetrics::RecordMatchAccepted() {
     ClearConsecutiveErrors(); // Clear error count on successful acceptance
 }
 
+void PerformanceMetrics::RecordAcceptDeadlineMiss() {
+    accept_deadline_misses_.fetch_add(1);
+}
+
 void PerformanceMetrics::RecordError(const std::string& error_message) {
     {
         std::lock_guard<std::mutex> lock(error_mutex_);
@@ -135,13 +161,13 @@ bool PerformanceMetrics::MeetsPerformanceTargets() const {
 }
 
 bool PerformanceMetrics::MeetsDetectionTarget() const {
-    int latency = detection_latency_ms_.load();
-    return latency > 0 && latency < DETECTION_TARGET_MS;
+    return MeetsLatencyTarget(GetRecentDetectionHistogram(LATENCY_TARGET_WINDOW), GetDetectionHistogram(),
+                              DETECTION_TARGET_MS);
 }
 
 bool PerformanceMetrics::MeetsAcceptanceTarget() const {
-    int latency = acceptance_latency_ms_.load();
-    return latency > 0 && latency < ACCEPTANCE_TARGET_MS;
+    return MeetsLatencyTarget(GetRecentAcceptanceHistogram(LATENCY_TARGET_WINDOW), GetAcceptanceHistogram(),
+                              ACCEPTANCE_TARGET_MS);
 }
 
 bool PerformanceMetrics::MeetsMemoryTarget() const {
@@ -160,27 +186,87 @@ bool PerformanceMetrics::MeetsSuccessRateTarget() const {
 }
 
 double PerformanceMetrics::GetAverageDetectionLatency() const {
-    int count = detection_count_.load();
-    if (count == 0) return 0.0;
-    
-    int total = total_detection_latency_.load();
-    return static_cast<double>(total) / static_cast<double>(count);
+    return GetDetectionHistogram().GetMeanUs() / 1000.0;
 }
 
 double PerformanceMetrics::GetAverageAcceptanceLatency() const {
-    int count = acceptance_count_.load();
-    if (count == 0) return 0.0;
-    
-    int total = total_acceptance_latency_.load();
-    return static_cast<double>(total) / static_cast<double>(count);
+    return GetAcceptanceHistogram().GetMeanUs() / 1000.0;
+}
+
+std::chrono::microseconds PerformanceMetrics::GetLastAcceptStageLatency(core::AcceptStage stage) const {
+    return std::chrono::microseconds(accept_stage_last_us_[static_cast<size_t>(stage)].load());
+}
+
+double PerformanceMetrics::GetAverageAcceptStageLatencyUs(core::AcceptStage stage) const {
+    return GetAcceptStageHistogram(stage).GetMeanUs();
 }
 
 int PerformanceMetrics::GetDetectionCount() const {
-    return detection_count_.load();
+    return static_cast<int>(detection_histogram_.GetCount());
 }
 
 int PerformanceMetrics::GetAcceptanceCount() const {
-    return acceptance_count_.load();
+    return static_cast<int>(acceptance_histogram_.GetCount());
+}
+
+int PerformanceMetrics::GetMissedTicks() const {
+    return missed_ticks_.load();
+}
+
+int PerformanceMetrics::GetAcceptDeadlineMisses() const {
+    return accept_deadline_misses_.load();
+}
+
+std::chrono::microseconds PerformanceMetrics::GetDetectionLatencyPercentile(double percentile) const {
+    return GetDetectionHistogram().GetPercentile(percentile);
+}
+
+std::chrono::microseconds PerformanceMetrics::GetAcceptanceLatencyPercentile(double percentile) const {
+    return GetAcceptanceHistogram().GetPercentile(percentile);
+}
+
+std::chrono::microseconds PerformanceMetrics::GetAcceptStageLatencyPercentile(core::AcceptStage stage,
+                                                                             double percentile) const {
+    return GetAcceptStageHistogram(stage).GetPercentile(percentile);
+}
+
+std::chrono::microseconds PerformanceMetrics::GetTickJitterPercentile(double percentile) const {
+    return GetTickJitterHistogram().GetPercentile(percentile);
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetDetectionHistogram() const {
+    return detection_histogram_.TakeSnapshot();
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetAcceptanceHistogram() const {
+    return acceptance_histogram_.TakeSnapshot();
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetAcceptStageHistogram(core::AcceptStage stage) const {
+    return accept_stage_histograms_[static_cast<size_t>(stage)].TakeSnapshot();
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetTickJitterHistogram() const {
+    return tick_jitter_histogram_.TakeSnapshot();
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetRecentDetectionHistogram(std::chrono::seconds window) const {
+    return recent_detection_.TakeSnapshot(window);
+}
+
+core::LatencyHistogram::Snapshot PerformanceMetrics::GetRecentAcceptanceHistogram(std::chrono::seconds window) const {
+    return recent_acceptance_.TakeSnapshot(window);
+}
+
+void PerformanceMetrics::MergeLatencyStats(const PerformanceMetrics& other) {
+    if (&other == this) return;
+
+    detection_histogram_.Merge(other.GetDetectionHistogram());
+    acceptance_histogram_.Merge(other.GetAcceptanceHistogram());
+    for (size_t i = 0; i < core::ACCEPT_STAGE_COUNT; ++i) {
+        accept_stage_histograms_[i].Merge(other.accept_stage_histograms_[i].TakeSnapshot());
+    }
+    tick_jitter_histogram_.Merge(other.GetTickJitterHistogram());
 }
 
 void PerformanceMetrics::Reset() {
@@ -204,15 +290,32 @@ void PerformanceMetrics::Reset() {
 void PerformanceMetrics::ResetCounters() {
     total_matches_detected_.store(0);
     total_matches_accepted_.store(0);
+    accept_deadline_misses_.store(0);
 }
 
 void PerformanceMetrics::ResetLatencyStats() {
     detection_latency_ms_.store(0);
     acceptance_latency_ms_.store(0);
-    detection_count_.store(0);
-    total_detection_latency_.store(0);
-    acceptance_count_.store(0);
-    total_acceptance_latency_.store(0);
+    detection_histogram_.Reset();
+    acceptance_histogram_.Reset();
+    recent_detection_.Reset();
+    recent_acceptance_.Reset();
+
+    for (size_t i = 0; i < core::ACCEPT_STAGE_COUNT; ++i) {
+        accept_stage_last_us_[i].store(0);
+        accept_stage_histograms_[i].Reset();
+    }
+    tick_jitter_histogram_.Reset();
+    missed_ticks_.store(0);
+}
+
+bool PerformanceMetrics::MeetsLatencyTarget(const core::LatencyHistogram::Snapshot& recent,
+                                            const core::LatencyHistogram::Snapshot& all, int target_ms) {
+    const core::LatencyHistogram::Snapshot& samples = recent.IsEmpty() ? all : recent;
+    if (samples.IsEmpty()) {
+        return false;
+    }
+    return samples.GetPercentile(LATENCY_TARGET_PERCENTILE) < std::chrono::milliseconds(target_ms);
 }
 
 double PerformanceMetrics::CalculateSuccessRate() const {
@@ -225,58 +328,11 @@ double PerformanceMetrics::CalculateSuccessRate() const {
 }
 
 double PerformanceMetrics::GetCurrentMemoryUsageMB() const {
-    PROCESS_MEMORY_COUNTERS_EX pmc;
-    if (GetProcessMemoryInfo(GetCurrentProcess(), 
-                           reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&pmc), 
-                           sizeof(pmc))) {
-        // Convert bytes to MB
-        return static_cast<double>(pmc.WorkingSetSize) / (1024.0 * 1024.0);
-    }
-    return 0.0;
+    return core::GetProcessMemoryUsageMB();
 }
 
-double PerformanceMetrics::GetCurrentCPUUsagePercent() const {
-    // Windows CPU usage calculation is complex and requires multiple samples
-    // For now, return a simplified implementation
-    // TODO: Implement proper CPU usage monitoring with performance counters
-    static FILETIME last_idle_time, last_kernel_time, last_user_time;
-    static bool first_call = true;
-    
-    FILETIME idle_time, kernel_time, user_time;
-    
-    if (!GetSystemTimes(&idle_time, &kernel_time, &user_time)) {
-        return 0.0;
-    }
-    
-    if (first_call) {
-        last_idle_time = idle_time;
-        last_kernel_time = kernel_time;
-        last_user_time = user_time;
-        first_call = false;
-        return 0.0; // No previous measurement
-    }
-    
-    // Calculate time differences
-    auto FileTimeToULL = [](const FILETIME& ft) -> unsigned long long {
-        return static_cast<unsigned long long>(ft.dwHighDateTime) << 32 | ft.dwLowDateTime;
-    };
-    
-    unsigned long long idle_diff = FileTimeToULL(idle_time) - FileTimeToULL(last_idle_time);
-    unsigned long long kernel_diff = FileTimeToULL(kernel_time) - FileTimeToULL(last_kernel_time);
-    unsigned long long user_diff = FileTimeToULL(user_time) - FileTimeToULL(last_user_time);
-    
-    unsigned long long total_diff = kernel_diff + user_diff;
-    
-    if (total_diff == 0) return 0.0;
-    
-    double cpu_usage = 100.0 * (1.0 - static_cast<double>(idle_diff) / static_cast<double>(total_diff));
-    
-    // Update last measurements
-    last_idle_time = idle_time;
-    last_kernel_time = kernel_time;
-    last_user_time = user_time;
-    
-    return std::max(0.0, std::min(100.0, cpu_usage));
+double PerformanceMetrics::GetCurrentCPUUsagePercent() {
+    return cpu_sampler_.Sample();
 }
 
 } // namespace models
@@ -0,0 +1,184 @@
+#include "lcu_mock_gameflow.h"
+#include "league_auto_accept/core/http_wire.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/ready_check_acceptor.h"
+#include <algorithm>
+#include <fstream>
+
+namespace league_auto_accept {
+namespace tools {
+
+namespace {
+constexpr const char* READY_CHECK_PHASE = "ReadyCheck";
+constexpr const char* READY_CHECK_PENDING =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"None","state":"InProgress","suppressUx":false,"timer":0.0})";
+constexpr const char* READY_CHECK_ACCEPTED =
+    R"({"declinerIds":[],"dodgeWarning":"None","playerResponse":"Accepted","state":"InProgress","suppressUx":false,"timer":0.0})";
+
+bool IsAcceptEndpoint(const std::string& path) {
+    return std::find_if(core::READY_CHECK_ACCEPT_ENDPOINTS.begin(), core::READY_CHECK_ACCEPT_ENDPOINTS.end(),
+                        [&path](const char* endpoint) { return path == endpoint; }) !=
+           core::READY_CHECK_ACCEPT_ENDPOINTS.end();
+}
+}
+
+MockGameflow::MockGameflow(LCUMockServer& server)
+    : server_(server)
+    , ready_check_up_(false)
+    , ready_check_accepted_(false)
+    , last_latency_(0)
+    , ready_check_count_(0)
+    , interrupted_(false) {
+    for (const char* endpoint : core::READY_CHECK_ACCEPT_ENDPOINTS) {
+        server_.SetResponse("POST", endpoint, {204, ""});
+    }
+    server_.SetRequestObserver([this](const std::string& method, const std::string& path) {
+        OnRequest(method, path);
+    });
+}
+
+MockGameflow::~MockGameflow() {
+    server_.SetRequestObserver(nullptr);
+}
+
+bool MockGameflow::LoadTimeline(const std::string& path, std::vector<PhaseStep>& steps) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    steps.clear();
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+
+        size_t delay_end = line.find(' ');
+        size_t delay_ms = 0;
+        if (delay_end == std::string::npos ||
+            !core::ParseUnsigned(std::string_view(line).substr(0, delay_end), delay_ms)) {
+            return false;
+        }
+
+        PhaseStep step;
+        step.delay = std::chrono::milliseconds(delay_ms);
+        step.phase = line.substr(delay_end + 1);
+        if (step.phase.empty()) {
+            return false;
+        }
+        steps.push_back(std::move(step));
+    }
+    return true;
+}
+
+void MockGameflow::SetAcceptCallback(AcceptCallback callback) {
+    accept_callback_ = std::move(callback);
+}
+
+void MockGameflow::SetPhase(const std::string& phase) {
+    bool create_ready_check = false;
+    bool delete_ready_check = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (phase == READY_CHECK_PHASE && !ready_check_up_) {
+            ready_check_up_ = true;
+            ready_check_accepted_ = false;
+            ready_check_count_++;
+            ready_check_time_ = std::chrono::steady_clock::now();
+            create_ready_check = true;
+        } else if (phase != READY_CHECK_PHASE && ready_check_up_) {
+            ready_check_up_ = false;
+            delete_ready_check = true;
+        }
+        phase_ = phase;
+    }
+
+    // Same order as the client: the ready check exists before the phase says so
+    if (create_ready_check) {
+        server_.PublishEvent(core::READY_CHECK_URI, READY_CHECK_PENDING, "Create");
+    } else if (delete_ready_check) {
+        server_.PublishEvent(core::READY_CHECK_URI, "null", "Delete");
+    }
+    server_.PublishEvent(core::GAMEFLOW_PHASE_URI, "\"" + phase + "\"");
+}
+
+bool MockGameflow::Play(const std::vector<PhaseStep>& steps) {
+    for (const PhaseStep& step : steps) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (cv_.wait_for(lock, step.delay, [this]() { return interrupted_; })) {
+                return false;
+            }
+        }
+        SetPhase(step.phase);
+    }
+    return true;
+}
+
+void MockGameflow::Interrupt() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    interrupted_ = true;
+    cv_.notify_all();
+}
+
+bool MockGameflow::WaitForAccept(std::chrono::milliseconds timeout, std::chrono::microseconds* latency) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    bool accepted = cv_.wait_for(lock, timeout, [this]() {
+        return interrupted_ || !ready_check_up_ || ready_check_accepted_;
+    });
+    if (!accepted || !ready_check_up_ || !ready_check_accepted_) {
+        return false;
+    }
+    if (latency) {
+        *latency = last_latency_;
+    }
+    return true;
+}
+
+std::string MockGameflow::GetPhase() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return phase_;
+}
+
+int MockGameflow::GetReadyCheckCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ready_check_count_;
+}
+
+int MockGameflow::GetAcceptCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(latencies_.size());
+}
+
+std::vector<std::chrono::microseconds> MockGameflow::GetAcceptLatencies() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return latencies_;
+}
+
+void MockGameflow::OnRequest(const std::string& method, const std::string& path) {
+    if (method != "POST" || !IsAcceptEndpoint(path)) {
+        return;
+    }
+
+    std::chrono::microseconds latency;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!ready_check_up_ || ready_check_accepted_) {
+            return;
+        }
+        latency = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - ready_check_time_);
+        ready_check_accepted_ = true;
+        last_latency_ = latency;
+        latencies_.push_back(latency);
+        cv_.notify_all();
+    }
+
+    server_.PublishEvent(core::READY_CHECK_URI, READY_CHECK_ACCEPTED);
+    if (accept_callback_) {
+        accept_callback_(latency);
+    }
+}
+
+} // namespace tools
+} // namespace league_auto_accept
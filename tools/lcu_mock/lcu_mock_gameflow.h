@@ -0,0 +1,82 @@
+#pragma once
+
+#include "lcu_mock_server.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace league_auto_accept {
+namespace tools {
+
+// One step of a scripted gameflow timeline
+struct PhaseStep {
+    std::chrono::milliseconds delay{0};   // Wait before entering the phase, relative to the previous step
+    std::string phase;
+};
+
+// Moves an LCUMockServer through gameflow phases the way the client does.
+//
+// Each phase is published on /lol-gameflow/v1/gameflow-phase, which also
+// answers later GETs. Entering ReadyCheck creates a pending ready check
+// before the phase update goes out; the first accept POST on any accept
+// endpoint marks it accepted, and leaving the phase deletes it. The time from
+// the ready check appearing to the accept POST arriving is recorded per
+// ready check.
+//
+// Installs itself as the server's request observer for its lifetime.
+class MockGameflow {
+public:
+    using AcceptCallback = std::function<void(std::chrono::microseconds latency)>;
+
+    explicit MockGameflow(LCUMockServer& server);
+    ~MockGameflow();
+
+    MockGameflow(const MockGameflow&) = delete;
+    MockGameflow& operator=(const MockGameflow&) = delete;
+
+    // Reads a timeline with one "<delay_ms> <Phase>" entry per line; blank
+    // lines and lines starting with '#' are skipped
+    static bool LoadTimeline(const std::string& path, std::vector<PhaseStep>& steps);
+
+    // Called on the server's connection thread; set before playing
+    void SetAcceptCallback(AcceptCallback callback);
+
+    void SetPhase(const std::string& phase);
+    // Enters each step's phase after its delay; blocks until the timeline is
+    // done or Interrupt() is called. False if interrupted.
+    bool Play(const std::vector<PhaseStep>& steps);
+    void Interrupt();
+
+    // Waits until the current ready check is accepted; false on timeout or
+    // when no ready check is up
+    bool WaitForAccept(std::chrono::milliseconds timeout, std::chrono::microseconds* latency = nullptr);
+
+    std::string GetPhase() const;
+    int GetReadyCheckCount() const;
+    int GetAcceptCount() const;
+    std::vector<std::chrono::microseconds> GetAcceptLatencies() const;
+
+private:
+    void OnRequest(const std::string& method, const std::string& path);
+
+    LCUMockServer& server_;
+    AcceptCallback accept_callback_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::string phase_;
+    bool ready_check_up_;
+    bool ready_check_accepted_;
+    std::chrono::steady_clock::time_point ready_check_time_;
+    std::chrono::microseconds last_latency_;
+    std::vector<std::chrono::microseconds> latencies_;
+    int ready_check_count_;
+    bool interrupted_;
+};
+
+} // namespace tools
+} // namespace league_auto_accept
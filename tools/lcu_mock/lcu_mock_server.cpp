@@ -0,0 +1,622 @@
+#include "lcu_mock_server.h"
+#include "league_auto_accept/core/base64.h"
+#include "league_auto_accept/core/http_wire.h"
+#include "league_auto_accept/core/json_scan.h"
+#include "league_auto_accept/core/lcu_event_stream.h"
+#include "league_auto_accept/core/websocket_frame.h"
+#include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace league_auto_accept {
+namespace tools {
+
+namespace {
+constexpr int ACCEPT_POLL_INTERVAL_MS = 50;
+constexpr size_t READ_CHUNK_SIZE = 16 * 1024;
+constexpr size_t MAX_CLIENT_MESSAGE_SIZE = 64 * 1024;
+constexpr int WAMP_UNSUBSCRIBE = 6;
+
+std::string RouteKey(const std::string& method, const std::string& path) {
+    return method + " " + path;
+}
+
+// Parses the [type,"topic"] calls clients send on the event bus
+bool ParseWampCall(std::string_view message, int& type, std::string& topic) {
+    message = core::SkipJsonWhitespace(message);
+    if (message.empty() || message.front() != '[') return false;
+    message = core::SkipJsonWhitespace(message.substr(1));
+
+    size_t length = core::MeasureJsonValue(message);
+    size_t value = 0;
+    if (length == 0 || !core::ParseUnsigned(message.substr(0, length), value)) return false;
+    type = static_cast<int>(value);
+
+    message = core::SkipJsonWhitespace(message.substr(length));
+    if (message.empty() || message.front() != ',') return false;
+    message = core::SkipJsonWhitespace(message.substr(1));
+
+    std::string_view raw_topic;
+    length = core::MeasureJsonValue(message);
+    if (length == 0 || !core::UnquoteJsonString(message.substr(0, length), raw_topic)) return false;
+    topic.assign(raw_topic);
+    return true;
+}
+}
+
+LCUMockServer::LCUMockServer(std::string auth_token)
+    : auth_token_(std::move(auth_token))
+    , expected_auth_(core::BuildBasicAuthValue(auth_token_))
+    , ssl_context_(nullptr)
+    , listen_fd_(-1)
+    , port_(0)
+    , running_(false)
+    , fault_random_(std::random_device{}())
+    , handshake_count_(0)
+    , request_count_(0)
+    , injected_error_count_(0) {
+}
+
+LCUMockServer::~LCUMockServer() {
+    Stop();
+    if (ssl_context_) {
+        SSL_CTX_free(ssl_context_);
+    }
+}
+
+bool LCUMockServer::CreateContext() {
+    if (ssl_context_) return true;
+
+    ssl_context_ = SSL_CTX_new(TLS_server_method());
+    if (!ssl_context_) {
+        return false;
+    }
+
+    // Self-signed certificate for 127.0.0.1, like the real client ships
+    EVP_PKEY* key = EVP_EC_gen("P-256");
+    X509* cert = X509_new();
+    bool ok = key && cert;
+
+    if (ok) {
+        X509_set_version(cert, 2);
+        ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+        X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+        X509_gmtime_adj(X509_getm_notAfter(cert), 24 * 60 * 60);
+        X509_set_pubkey(cert, key);
+
+        X509_NAME* name = X509_get_subject_name(cert);
+        X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+                                   reinterpret_cast<const unsigned char*>("127.0.0.1"), -1, -1, 0);
+        X509_set_issuer_name(cert, name);
+
+        ok = X509_sign(cert, key, EVP_sha256()) > 0 &&
+             SSL_CTX_use_certificate(ssl_context_, cert) == 1 &&
+             SSL_CTX_use_PrivateKey(ssl_context_, key) == 1;
+    }
+
+    X509_free(cert);
+    EVP_PKEY_free(key);
+
+    if (!ok) {
+        SSL_CTX_free(ssl_context_);
+        ssl_context_ = nullptr;
+    }
+    return ok;
+}
+
+bool LCUMockServer::Start(int port) {
+    if (running_) return false;
+
+    if (!CreateContext()) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Failed to create TLS server context";
+        return false;
+    }
+
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Failed to create listening socket";
+        return false;
+    }
+
+    int reuse = 1;
+    setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(static_cast<uint16_t>(port));
+
+    socklen_t length = sizeof(address);
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0 ||
+        ::listen(listen_fd_, SOMAXCONN) < 0 ||
+        ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        std::lock_guard<std::mutex> lock(error_mutex_);
+        last_error_ = "Failed to bind 127.0.0.1:" + std::to_string(port);
+        return false;
+    }
+
+    port_ = ntohs(address.sin_port);
+    running_ = true;
+    accept_thread_ = std::thread([this]() { AcceptLoop(); });
+    return true;
+}
+
+void LCUMockServer::Stop() {
+    if (!running_.exchange(false)) return;
+
+    if (accept_thread_.joinable()) {
+        accept_thread_.join();
+    }
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+
+    std::unique_lock<std::mutex> lock(connections_mutex_);
+    for (int fd : client_fds_) {
+        ::shutdown(fd, SHUT_RDWR);
+    }
+    connections_cv_.wait(lock, [this]() { return client_fds_.empty(); });
+}
+
+bool LCUMockServer::IsRunning() const {
+    return running_;
+}
+
+int LCUMockServer::GetPort() const {
+    return port_;
+}
+
+const std::string& LCUMockServer::GetAuthToken() const {
+    return auth_token_;
+}
+
+void LCUMockServer::SetResponse(const std::string& method, const std::string& path, MockResponse response) {
+    std::lock_guard<std::mutex> lock(routes_mutex_);
+    routes_[RouteKey(method, path)] = std::move(response);
+}
+
+void LCUMockServer::ClearResponses() {
+    std::lock_guard<std::mutex> lock(routes_mutex_);
+    routes_.clear();
+}
+
+void LCUMockServer::SetFaults(const MockFaults& faults) {
+    std::lock_guard<std::mutex> lock(faults_mutex_);
+    faults_ = faults;
+}
+
+MockFaults LCUMockServer::GetFaults() const {
+    std::lock_guard<std::mutex> lock(faults_mutex_);
+    return faults_;
+}
+
+bool LCUMockServer::WriteLockfile(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << "LeagueClient:" << ::getpid() << ":" << port_ << ":" << auth_token_ << ":https";
+    return static_cast<bool>(file.flush());
+}
+
+void LCUMockServer::SetRequestObserver(
+    std::function<void(const std::string& method, const std::string& path)> observer) {
+    std::lock_guard<std::mutex> lock(routes_mutex_);
+    request_observer_ = std::move(observer);
+}
+
+void LCUMockServer::PublishEvent(const std::string& uri, const std::string& data, const std::string& event_type) {
+    {
+        std::lock_guard<std::mutex> lock(routes_mutex_);
+        if (event_type == "Delete") {
+            routes_.erase(RouteKey("GET", uri));
+        } else {
+            routes_[RouteKey("GET", uri)] = MockResponse{200, data};
+        }
+    }
+
+    std::string payload = ",{\"data\":" + data + ",\"eventType\":\"" + event_type + "\",\"uri\":\"" + uri + "\"}]";
+    std::string endpoint_topic = core::BuildEndpointEventTopic(uri);
+
+    std::vector<std::shared_ptr<WebSocketSession>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        sessions.assign(sessions_.begin(), sessions_.end());
+    }
+
+    std::string frame;
+    for (const auto& session : sessions) {
+        std::lock_guard<std::mutex> lock(session->ssl_mutex);
+        if (!session->ssl) continue;
+
+        const char* topic = nullptr;
+        if (session->topics.count(endpoint_topic)) {
+            topic = endpoint_topic.c_str();
+        } else if (session->topics.count(core::JSON_API_EVENT_TOPIC)) {
+            topic = core::JSON_API_EVENT_TOPIC;
+        } else {
+            continue;
+        }
+
+        std::string message = "[" + std::to_string(core::WAMP_EVENT) + ",\"" + topic + "\"" + payload;
+        frame.clear();
+        core::EncodeWebSocketFrame(core::WebSocketOpcode::TEXT, message, false, frame);
+        SSL_write(session->ssl, frame.data(), static_cast<int>(frame.size()));
+    }
+}
+
+void LCUMockServer::ReplayEvents(const std::vector<MockEvent>& events) {
+    for (const MockEvent& event : events) {
+        if (event.delay.count() > 0) {
+            std::this_thread::sleep_for(event.delay);
+        }
+        PublishEvent(event.uri, event.data, event.event_type);
+    }
+}
+
+bool LCUMockServer::LoadEventRecording(const std::string& path, std::vector<MockEvent>& events) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    events.clear();
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty() || line[0] == '#') continue;
+
+        size_t delay_end = line.find(' ');
+        size_t type_end = line.find(' ', delay_end + 1);
+        size_t uri_end = line.find(' ', type_end + 1);
+        if (delay_end == std::string::npos || type_end == std::string::npos || uri_end == std::string::npos) {
+            return false;
+        }
+
+        size_t delay_ms = 0;
+        if (!core::ParseUnsigned(std::string_view(line).substr(0, delay_end), delay_ms)) {
+            return false;
+        }
+
+        MockEvent event;
+        event.delay = std::chrono::milliseconds(delay_ms);
+        event.event_type = line.substr(delay_end + 1, type_end - delay_end - 1);
+        event.uri = line.substr(type_end + 1, uri_end - type_end - 1);
+        event.data = line.substr(uri_end + 1);
+        events.push_back(std::move(event));
+    }
+    return true;
+}
+
+int LCUMockServer::GetSubscriberCount() const {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    int count = 0;
+    for (const auto& session : sessions_) {
+        std::lock_guard<std::mutex> session_lock(session->ssl_mutex);
+        if (!session->topics.empty()) count++;
+    }
+    return count;
+}
+
+int LCUMockServer::GetHandshakeCount() const {
+    return handshake_count_.load();
+}
+
+int LCUMockServer::GetRequestCount() const {
+    return request_count_.load();
+}
+
+int LCUMockServer::GetInjectedErrorCount() const {
+    return injected_error_count_.load();
+}
+
+std::string LCUMockServer::GetLastError() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    return last_error_;
+}
+
+void LCUMockServer::AcceptLoop() {
+    while (running_) {
+        pollfd pfd{listen_fd_, POLLIN, 0};
+        if (::poll(&pfd, 1, ACCEPT_POLL_INTERVAL_MS) <= 0) {
+            continue;
+        }
+
+        int client_fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client_fd < 0) {
+            continue;
+        }
+
+        int no_delay = 1;
+        setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &no_delay, sizeof(no_delay));
+
+        {
+            std::lock_guard<std::mutex> lock(connections_mutex_);
+            client_fds_.insert(client_fd);
+        }
+        std::thread([this, client_fd]() { ServeConnection(client_fd); }).detach();
+    }
+}
+
+void LCUMockServer::ServeConnection(int client_fd) {
+    SSL* ssl = SSL_new(ssl_context_);
+    if (ssl && SSL_set_fd(ssl, client_fd) == 1 && SSL_accept(ssl) == 1) {
+        handshake_count_++;
+
+        std::string buffer;
+        Request request;
+        while (running_ && WaitForRequest(ssl, client_fd, buffer) && ReadRequest(ssl, buffer, request)) {
+            request_count_++;
+
+            std::string_view upgrade;
+            if (core::FindHeaderValue(request.headers, "Upgrade", upgrade) &&
+                core::EqualsIgnoreCase(upgrade, "websocket")) {
+                ServeWebSocket(ssl, client_fd, request, buffer);
+                break;
+            }
+
+            MockResponse response = HandleRequest(request);
+            if (!WriteResponse(ssl, response)) {
+                break;
+            }
+        }
+        SSL_shutdown(ssl);
+    }
+
+    if (ssl) {
+        SSL_free(ssl);
+    }
+    ERR_clear_error();
+    ::close(client_fd);
+
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    client_fds_.erase(client_fd);
+    connections_cv_.notify_all();
+}
+
+bool LCUMockServer::WaitForRequest(SSL* ssl, int client_fd, const std::string& buffer) {
+    std::chrono::milliseconds idle_timeout = GetFaults().idle_timeout;
+    if (idle_timeout.count() <= 0 || !buffer.empty() || SSL_pending(ssl) > 0) {
+        return true;
+    }
+
+    pollfd poll_fd{client_fd, POLLIN, 0};
+    return ::poll(&poll_fd, 1, static_cast<int>(idle_timeout.count())) > 0;
+}
+
+bool LCUMockServer::ReadRequest(SSL* ssl, std::string& buffer, Request& request) {
+    char chunk[READ_CHUNK_SIZE];
+
+    size_t header_end;
+    while ((header_end = core::FindHeaderEnd(buffer)) == std::string::npos) {
+        int received = SSL_read(ssl, chunk, sizeof(chunk));
+        if (received <= 0) return false;
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+
+    std::string_view headers(buffer.data(), header_end);
+    std::string_view request_line = headers.substr(0, headers.find("\r\n"));
+    size_t method_end = request_line.find(' ');
+    size_t path_end = request_line.find(' ', method_end + 1);
+    if (method_end == std::string_view::npos || path_end == std::string_view::npos) {
+        return false;
+    }
+
+    request.method.assign(request_line.substr(0, method_end));
+    request.path.assign(request_line.substr(method_end + 1, path_end - method_end - 1));
+    request.headers.assign(headers);
+
+    size_t content_length = 0;
+    std::string_view value;
+    if (core::FindHeaderValue(headers, "Content-Length", value)) {
+        core::ParseUnsigned(value, content_length);
+    }
+
+    while (buffer.size() < header_end + content_length) {
+        int received = SSL_read(ssl, chunk, sizeof(chunk));
+        if (received <= 0) return false;
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+
+    request.body.assign(buffer, header_end, content_length);
+    buffer.erase(0, header_end + content_length);
+    return true;
+}
+
+bool LCUMockServer::IsAuthorized(const Request& request) const {
+    std::string_view auth;
+    return core::FindHeaderValue(request.headers, "Authorization", auth) && auth == expected_auth_;
+}
+
+MockResponse LCUMockServer::HandleRequest(const Request& request) {
+    if (!IsAuthorized(request)) {
+        return MockResponse{401, R"({"errorCode":"RPC_ERROR","httpStatus":401,"message":"Unauthorized"})"};
+    }
+
+    if (!ApplyFaults()) {
+        int status = GetFaults().error_status;
+        return MockResponse{status, "{\"errorCode\":\"RPC_ERROR\",\"httpStatus\":" + std::to_string(status) +
+                                    ",\"message\":\"Injected failure\"}"};
+    }
+
+    std::function<void(const std::string&, const std::string&)> observer;
+    {
+        std::lock_guard<std::mutex> lock(routes_mutex_);
+        observer = request_observer_;
+    }
+    if (observer) {
+        observer(request.method, request.path);
+    }
+
+    std::lock_guard<std::mutex> lock(routes_mutex_);
+    auto it = routes_.find(RouteKey(request.method, request.path));
+    if (it == routes_.end()) {
+        return MockResponse{404, R"({"errorCode":"RPC_ERROR","httpStatus":404,"message":"Invalid URI format"})"};
+    }
+    return it->second;
+}
+
+bool LCUMockServer::ApplyFaults() {
+    std::chrono::milliseconds delay;
+    bool fail;
+    {
+        std::lock_guard<std::mutex> lock(faults_mutex_);
+        delay = faults_.latency;
+        if (faults_.jitter.count() > 0) {
+            std::uniform_int_distribution<long long> jitter(0, faults_.jitter.count());
+            delay += std::chrono::milliseconds(jitter(fault_random_));
+        }
+        fail = faults_.error_rate > 0.0 &&
+               std::uniform_real_distribution<double>(0.0, 1.0)(fault_random_) < faults_.error_rate;
+    }
+
+    if (delay.count() > 0) {
+        std::this_thread::sleep_for(delay);
+    }
+    if (fail) {
+        injected_error_count_++;
+    }
+    return !fail;
+}
+
+bool LCUMockServer::WriteResponse(SSL* ssl, const MockResponse& response) {
+    std::string message = "HTTP/1.1 " + std::to_string(response.status_code) + " " +
+                          core::HttpStatusReason(response.status_code) + "\r\n";
+    message += "Content-Type: application/json\r\n";
+    if (response.status_code == 204) {
+        message += "\r\n";
+    } else if (response.chunk_size > 0) {
+        message += "Transfer-Encoding: chunked\r\n\r\n";
+        for (size_t pos = 0; pos < response.body.size(); pos += response.chunk_size) {
+            size_t length = std::min(response.chunk_size, response.body.size() - pos);
+            char size_line[32];
+            std::snprintf(size_line, sizeof(size_line), "%zx\r\n", length);
+            message += size_line;
+            message.append(response.body, pos, length);
+            message += "\r\n";
+        }
+        message += "0\r\n\r\n";
+    } else {
+        message += "Content-Length: " + std::to_string(response.body.size()) + "\r\n\r\n";
+        message += response.body;
+    }
+
+    return SSL_write(ssl, message.data(), static_cast<int>(message.size())) == static_cast<int>(message.size());
+}
+
+void LCUMockServer::ServeWebSocket(SSL* ssl, int client_fd, const Request& request, std::string& buffer) {
+    std::string_view key;
+    if (!IsAuthorized(request)) {
+        WriteResponse(ssl, MockResponse{401, R"({"errorCode":"RPC_ERROR","httpStatus":401,"message":"Unauthorized"})"});
+        return;
+    }
+    if (!core::FindHeaderValue(request.headers, "Sec-WebSocket-Key", key)) {
+        WriteResponse(ssl, MockResponse{400, R"({"errorCode":"RPC_ERROR","httpStatus":400,"message":"Missing Sec-WebSocket-Key"})"});
+        return;
+    }
+
+    std::string upgrade = "HTTP/1.1 101 Switching Protocols\r\n"
+                          "Upgrade: websocket\r\n"
+                          "Connection: Upgrade\r\n"
+                          "Sec-WebSocket-Accept: " + core::ComputeWebSocketAccept(key) + "\r\n\r\n";
+    if (SSL_write(ssl, upgrade.data(), static_cast<int>(upgrade.size())) != static_cast<int>(upgrade.size())) {
+        return;
+    }
+
+    auto session = std::make_shared<WebSocketSession>();
+    session->ssl = ssl;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        sessions_.insert(session);
+    }
+
+    char chunk[READ_CHUNK_SIZE];
+    core::WebSocketFrame frame;
+    std::string reply;
+    bool open = true;
+
+    while (open && running_) {
+        size_t consumed;
+        while (open && (consumed = core::DecodeWebSocketFrame(buffer, frame, MAX_CLIENT_MESSAGE_SIZE)) != 0) {
+            if (consumed == std::string::npos) {
+                open = false;
+                break;
+            }
+            buffer.erase(0, consumed);
+
+            std::lock_guard<std::mutex> lock(session->ssl_mutex);
+            int type = 0;
+            std::string topic;
+            reply.clear();
+
+            switch (frame.opcode) {
+            case core::WebSocketOpcode::TEXT:
+                if (ParseWampCall(frame.payload, type, topic)) {
+                    if (type == core::WAMP_SUBSCRIBE) {
+                        session->topics.insert(topic);
+                    } else if (type == WAMP_UNSUBSCRIBE) {
+                        session->topics.erase(topic);
+                    }
+                }
+                break;
+            case core::WebSocketOpcode::PING:
+                core::EncodeWebSocketFrame(core::WebSocketOpcode::PONG, frame.payload, false, reply);
+                break;
+            case core::WebSocketOpcode::CLOSE:
+                core::EncodeWebSocketFrame(core::WebSocketOpcode::CLOSE, frame.payload, false, reply);
+                open = false;
+                break;
+            default:
+                break;
+            }
+
+            if (!reply.empty()) {
+                SSL_write(ssl, reply.data(), static_cast<int>(reply.size()));
+            }
+        }
+        if (!open) break;
+
+        // Poll outside the lock so publishers can push while the client is idle
+        bool pending;
+        {
+            std::lock_guard<std::mutex> lock(session->ssl_mutex);
+            pending = SSL_pending(ssl) > 0;
+        }
+        if (!pending) {
+            pollfd pfd{client_fd, POLLIN, 0};
+            if (::poll(&pfd, 1, ACCEPT_POLL_INTERVAL_MS) <= 0) continue;
+        }
+
+        int received;
+        {
+            std::lock_guard<std::mutex> lock(session->ssl_mutex);
+            received = SSL_read(ssl, chunk, sizeof(chunk));
+        }
+        if (received <= 0) break;
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        sessions_.erase(session);
+    }
+    std::lock_guard<std::mutex> lock(session->ssl_mutex);
+    session->ssl = nullptr;
+}
+
+} // namespace tools
+} // namespace league_auto_accept
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef struct ssl_st SSL;
+typedef struct ssl_ctx_st SSL_CTX;
+
+namespace league_auto_accept {
+namespace tools {
+
+struct MockResponse {
+    int status_code = 200;
+    std::string body;
+    // Non-zero sends the body with Transfer-Encoding: chunked, in chunks
+    // this long
+    size_t chunk_size = 0;
+};
+
+// Faults applied to every authorized HTTP request; the event bus is not affected
+struct MockFaults {
+    std::chrono::milliseconds latency{0};   // Added before answering
+    std::chrono::milliseconds jitter{0};    // Uniform extra delay in [0, jitter]
+    double error_rate = 0.0;                // Share of requests answered with error_status
+    int error_status = 500;
+    // Keep-alive connections idle this long are closed, as servers do; 0 keeps them
+    std::chrono::milliseconds idle_timeout{0};
+};
+
+// One entry of a recorded OnJsonApiEvent sequence
+struct MockEvent {
+    std::chrono::milliseconds delay{0};   // Wait before publishing, relative to the previous event
+    std::string event_type = "Update";
+    std::string uri;
+    std::string data;                     // Raw JSON value
+};
+
+// Local HTTPS stand-in for the League client API.
+//
+// Serves canned responses on 127.0.0.1 with a freshly generated self-signed
+// certificate and checks the same "riot:<token>" basic auth as the LCU.
+// Connections are kept alive so clients can be benchmarked with and
+// without connection reuse. A WebSocket upgrade on "/" serves the WAMP event
+// bus: clients subscribe with [5,"<topic>"] and receive OnJsonApiEvent pushes.
+class LCUMockServer {
+public:
+    static constexpr const char* DEFAULT_AUTH_TOKEN = "mock-lcu-auth-token";
+
+    explicit LCUMockServer(std::string auth_token = DEFAULT_AUTH_TOKEN);
+    ~LCUMockServer();
+
+    LCUMockServer(const LCUMockServer&) = delete;
+    LCUMockServer& operator=(const LCUMockServer&) = delete;
+
+    // Port 0 picks a free ephemeral port
+    bool Start(int port = 0);
+    void Stop();
+    bool IsRunning() const;
+
+    int GetPort() const;
+    const std::string& GetAuthToken() const;
+
+    void SetResponse(const std::string& method, const std::string& path, MockResponse response);
+    void ClearResponses();
+
+    void SetFaults(const MockFaults& faults);
+    MockFaults GetFaults() const;
+
+    // Writes a client lockfile ("LeagueClient:<pid>:<port>:<token>:https")
+    // pointing at this server; call after Start()
+    bool WriteLockfile(const std::string& path) const;
+
+    // Called on the connection thread for every authorized HTTP request that
+    // was not failed by fault injection
+    void SetRequestObserver(std::function<void(const std::string& method, const std::string& path)> observer);
+
+    // Pushes an event to every subscriber of `uri` and makes later GETs of
+    // `uri` return `data`, like the real client's resource state
+    void PublishEvent(const std::string& uri, const std::string& data, const std::string& event_type = "Update");
+
+    // Publishes the events in order, sleeping for each delay; blocks
+    void ReplayEvents(const std::vector<MockEvent>& events);
+
+    // Reads a recording with one "<delay_ms> <eventType> <uri> <json>" entry
+    // per line; blank lines and lines starting with '#' are skipped
+    static bool LoadEventRecording(const std::string& path, std::vector<MockEvent>& events);
+
+    int GetHandshakeCount() const;
+    int GetRequestCount() const;
+    int GetSubscriberCount() const;
+    int GetInjectedErrorCount() const;
+    std::string GetLastError() const;
+
+private:
+    struct Request {
+        std::string method;
+        std::string path;
+        std::string headers;
+        std::string body;
+    };
+
+    // Upgraded connection; the mutex serializes the connection thread's reads
+    // with event pushes from publishing threads
+    struct WebSocketSession {
+        SSL* ssl = nullptr;
+        std::mutex ssl_mutex;
+        std::set<std::string> topics;
+    };
+
+    bool CreateContext();
+    void AcceptLoop();
+    void ServeConnection(int client_fd);
+    // False once the connection sat idle past faults.idle_timeout
+    bool WaitForRequest(SSL* ssl, int client_fd, const std::string& buffer);
+    bool ReadRequest(SSL* ssl, std::string& buffer, Request& request);
+    bool IsAuthorized(const Request& request) const;
+    // Sleeps for the injected latency; false if the request should fail
+    bool ApplyFaults();
+    MockResponse HandleRequest(const Request& request);
+    bool WriteResponse(SSL* ssl, const MockResponse& response);
+    void ServeWebSocket(SSL* ssl, int client_fd, const Request& request, std::string& buffer);
+
+    std::string auth_token_;
+    std::string expected_auth_;
+    SSL_CTX* ssl_context_;
+    int listen_fd_;
+    int port_;
+    std::atomic<bool> running_;
+    std::thread accept_thread_;
+
+    // Connection threads are detached; Stop() waits for client_fds_ to drain
+    std::mutex connections_mutex_;
+    std::condition_variable connections_cv_;
+    std::set<int> client_fds_;
+
+    mutable std::mutex routes_mutex_;
+    std::map<std::string, MockResponse> routes_;
+    std::function<void(const std::string&, const std::string&)> request_observer_;
+
+    mutable std::mutex faults_mutex_;
+    MockFaults faults_;
+    std::mt19937 fault_random_;
+
+    mutable std::mutex sessions_mutex_;
+    std::set<std::shared_ptr<WebSocketSession>> sessions_;
+
+    std::atomic<int> handshake_count_;
+    std::atomic<int> request_count_;
+    std::atomic<int> injected_error_count_;
+    mutable std::mutex error_mutex_;
+    std::string last_error_;
+};
+
+} // namespace tools
+} // namespace league_auto_accept
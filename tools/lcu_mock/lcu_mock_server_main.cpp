@@ -0,0 +1,133 @@
+// Standalone LCU stand-in: serves the gameflow, ready-check and accept
+// endpoints plus the event bus on 127.0.0.1, writes a lockfile for the tool to
+// find, and plays a gameflow timeline. Runs until interrupted.
+//
+//   lcu_mock_server [--port N] [--token T] [--lockfile PATH]
+//                   [--timeline PATH] [--loop]
+//                   [--latency MS] [--jitter MS] [--error-rate R] [--error-status N]
+
+#include "lcu_mock_gameflow.h"
+#include "lcu_mock_server.h"
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+using namespace league_auto_accept;
+
+namespace {
+
+std::atomic<bool> g_stop_requested{false};
+
+void HandleStopSignal(int) {
+    g_stop_requested = true;
+}
+
+const char* FindArg(int argc, char* argv[], const char* name) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == name) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+bool HasFlag(int argc, char* argv[], const char* name) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string GetStringArg(int argc, char* argv[], const char* name, const std::string& default_value) {
+    const char* value = FindArg(argc, argv, name);
+    return value ? value : default_value;
+}
+
+long GetIntArg(int argc, char* argv[], const char* name, long default_value) {
+    const char* value = FindArg(argc, argv, name);
+    return value ? std::strtol(value, nullptr, 10) : default_value;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, HandleStopSignal);
+    std::signal(SIGTERM, HandleStopSignal);
+
+    if (HasFlag(argc, argv, "--help")) {
+        std::printf("usage: lcu_mock_server [--port N] [--token T] [--lockfile PATH] [--timeline PATH] [--loop]\n"
+                    "                       [--latency MS] [--jitter MS] [--error-rate R] [--error-status N]\n");
+        return 0;
+    }
+
+    tools::MockFaults faults;
+    faults.latency = std::chrono::milliseconds(GetIntArg(argc, argv, "--latency", 0));
+    faults.jitter = std::chrono::milliseconds(GetIntArg(argc, argv, "--jitter", 0));
+    faults.error_rate = std::strtod(GetStringArg(argc, argv, "--error-rate", "0").c_str(), nullptr);
+    faults.error_status = static_cast<int>(GetIntArg(argc, argv, "--error-status", 500));
+    if (faults.latency.count() < 0 || faults.jitter.count() < 0 || faults.error_rate < 0.0 || faults.error_rate > 1.0) {
+        std::fprintf(stderr, "Latency and jitter must be >= 0 and the error rate within [0, 1]\n");
+        return 1;
+    }
+
+    std::vector<tools::PhaseStep> timeline;
+    std::string timeline_path = GetStringArg(argc, argv, "--timeline", "");
+    if (!timeline_path.empty() && !tools::MockGameflow::LoadTimeline(timeline_path, timeline)) {
+        std::fprintf(stderr, "Failed to load timeline %s\n", timeline_path.c_str());
+        return 1;
+    }
+
+    tools::LCUMockServer server(GetStringArg(argc, argv, "--token", tools::LCUMockServer::DEFAULT_AUTH_TOKEN));
+    server.SetFaults(faults);
+    if (!server.Start(static_cast<int>(GetIntArg(argc, argv, "--port", 0)))) {
+        std::fprintf(stderr, "Failed to start LCU stand-in: %s\n", server.GetLastError().c_str());
+        return 1;
+    }
+
+    std::string lockfile_path = GetStringArg(argc, argv, "--lockfile", "lockfile");
+    if (!server.WriteLockfile(lockfile_path)) {
+        std::fprintf(stderr, "Failed to write lockfile %s\n", lockfile_path.c_str());
+        return 1;
+    }
+
+    std::printf("LCU stand-in on 127.0.0.1:%d, token %s, lockfile %s\n", server.GetPort(),
+                server.GetAuthToken().c_str(), lockfile_path.c_str());
+    std::printf("Faults: latency %lldms + up to %lldms jitter, error rate %.3f (status %d)\n",
+                static_cast<long long>(faults.latency.count()), static_cast<long long>(faults.jitter.count()),
+                faults.error_rate, faults.error_status);
+    std::fflush(stdout);
+
+    tools::MockGameflow gameflow(server);
+    gameflow.SetAcceptCallback([](std::chrono::microseconds latency) {
+        std::printf("Ready check accepted after %.1fms\n", static_cast<double>(latency.count()) / 1000.0);
+        std::fflush(stdout);
+    });
+    gameflow.SetPhase(timeline.empty() ? "None" : timeline.front().phase);
+
+    bool loop = HasFlag(argc, argv, "--loop");
+    std::thread player([&]() {
+        do {
+            if (!gameflow.Play(timeline)) break;
+        } while (loop && !timeline.empty());
+    });
+
+    while (!g_stop_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    gameflow.Interrupt();
+    player.join();
+    server.Stop();
+    std::remove(lockfile_path.c_str());
+
+    std::printf("%d ready checks, %d accepted, %d requests, %d injected errors\n",
+                gameflow.GetReadyCheckCount(), gameflow.GetAcceptCount(), server.GetRequestCount(),
+                server.GetInjectedErrorCount());
+    return 0;
+}